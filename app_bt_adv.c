@@ -0,0 +1,569 @@
+/******************************************************************************
+* File Name:   app_bt_adv.c
+*
+* Description: This file implements the advertising scheduler. Advertising starts at a
+*              fast interval for quick discovery and backs off through the configured
+*              stages to save power; connections, disconnections and alerts restart it
+*              from the fast stage. The time to connect is recorded per stage.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_adv.h"
+#include "app_bt_ext_adv.h"
+#include "app_bt_conn.h"
+#include "app_log.h"
+#include "wiced_timer.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One advertising stage */
+typedef struct
+{
+    wiced_bt_ble_advert_mode_t mode;
+    uint32_t                   duration_ms;
+} app_bt_adv_stage_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static const app_bt_adv_stage_t app_bt_adv_stages[] = APP_BT_ADV_STAGES;
+
+#define APP_BT_ADV_NUM_STAGES \
+    ((uint8_t)(sizeof(app_bt_adv_stages) / sizeof(app_bt_adv_stages[0])))
+
+_Static_assert(sizeof(app_bt_adv_stages) / sizeof(app_bt_adv_stages[0]) <= APP_BT_ADV_MAX_STAGES,
+               "Too many advertising stages");
+_Static_assert(APP_BT_ADV_REPEAT_STAGE < sizeof(app_bt_adv_stages) / sizeof(app_bt_adv_stages[0]),
+               "APP_BT_ADV_REPEAT_STAGE is not a stage");
+
+static app_bt_adv_stage_stats_t app_bt_adv_stats[APP_BT_ADV_MAX_STAGES];
+static wiced_timer_t            app_bt_adv_timer;
+static wiced_bool_t             app_bt_adv_active;          /* Scheduler running */
+static uint8_t                  app_bt_adv_stage;           /* Current stage */
+static uint32_t                 app_bt_adv_start_time;      /* RTOS tick count of the last restart */
+
+/* Fast reconnection to the client that disconnected last */
+static wiced_bt_device_address_t    app_bt_adv_peer;
+static wiced_bt_ble_address_type_t  app_bt_adv_peer_type;
+static wiced_bt_ble_advert_mode_t   app_bt_adv_directed_mode;   /* BTM_BLE_ADVERT_OFF outside the window */
+static wiced_bool_t                 app_bt_adv_reconnect_pending;
+static uint32_t                     app_bt_adv_disconnect_time;
+static app_bt_adv_reconnect_stats_t app_bt_adv_reconnect_stats;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static wiced_result_t app_bt_adv_enter_stage(uint8_t stage);
+static void app_bt_adv_record_latency(app_bt_adv_latency_t *p_latency, uint32_t time_ms);
+static wiced_result_t app_bt_adv_set_mode(wiced_bt_ble_advert_mode_t mode,
+                                          wiced_bt_ble_address_type_t peer_addr_type,
+                                          wiced_bt_device_address_t peer_addr);
+static wiced_bt_ble_advert_mode_t app_bt_adv_get_mode(void);
+static void app_bt_adv_timer_cb(WICED_TIMER_PARAM_TYPE arg);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_adv_init
+********************************************************************************
+* Summary:
+*   Clears the counters and creates the stage timer. Must be called from the
+*   BT stack context after BTM_ENABLED_EVT.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_init(void)
+{
+    memset(app_bt_adv_stats, 0, sizeof(app_bt_adv_stats));
+    memset(&app_bt_adv_reconnect_stats, 0, sizeof(app_bt_adv_reconnect_stats));
+    app_bt_adv_active = WICED_FALSE;
+    app_bt_adv_stage = 0;
+    app_bt_adv_directed_mode = BTM_BLE_ADVERT_OFF;
+    app_bt_adv_reconnect_pending = WICED_FALSE;
+    wiced_init_timer(&app_bt_adv_timer, app_bt_adv_timer_cb, 0, WICED_MILLI_SECONDS_TIMER);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_start
+********************************************************************************
+* Summary:
+*   Starts advertising from the first stage. The time to connect of the next
+*   connection is measured from here.
+*
+* Parameters:
+*   app_bt_adv_event_t event: Reason of the restart
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS if advertising started
+*
+*******************************************************************************/
+wiced_result_t app_bt_adv_start(app_bt_adv_event_t event)
+{
+    APP_LOG(APP_LOG_ID_ADV_RESTART, event, app_bt_adv_stage);
+
+    app_bt_adv_active = WICED_TRUE;
+    app_bt_adv_directed_mode = BTM_BLE_ADVERT_OFF;
+    app_bt_adv_start_time = xTaskGetTickCount();
+    return app_bt_adv_enter_stage(0);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_kick
+********************************************************************************
+* Summary:
+*   Goes back to the first stage on an event that makes a connection likely,
+*   if the scheduler is running and has backed off. Nothing is done while
+*   advertising is stopped because the connection table is full, or during
+*   the directed window of a fast reconnection.
+*
+* Parameters:
+*   app_bt_adv_event_t event: Reason of the restart
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_kick(app_bt_adv_event_t event)
+{
+    if (app_bt_adv_active && (BTM_BLE_ADVERT_OFF == app_bt_adv_directed_mode) &&
+        (0 != app_bt_adv_stage))
+    {
+        (void)app_bt_adv_start(event);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_connected
+********************************************************************************
+* Summary:
+*   Records the time to connect against the current stage, and the
+*   reconnection latency when the client that left last comes back. The
+*   controller stops advertising on a connection, so the scheduler stops too;
+*   the caller restarts it if more clients can be accepted.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr: Address of the client
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_connected(wiced_bt_device_address_t bd_addr)
+{
+    app_bt_adv_stage_stats_t *p_stats = &app_bt_adv_stats[app_bt_adv_stage];
+    uint32_t now = xTaskGetTickCount();
+    uint32_t time_ms;
+
+    if (app_bt_adv_reconnect_pending && (0 == memcmp(app_bt_adv_peer, bd_addr, BD_ADDR_LEN)))
+    {
+        time_ms = (now - app_bt_adv_disconnect_time) * portTICK_PERIOD_MS;
+        app_bt_adv_record_latency((BTM_BLE_ADVERT_OFF != app_bt_adv_directed_mode) ?
+                                  &app_bt_adv_reconnect_stats.directed :
+                                  &app_bt_adv_reconnect_stats.undirected, time_ms);
+        APP_LOG(APP_LOG_ID_ADV_RECONNECTED, (BTM_BLE_ADVERT_OFF != app_bt_adv_directed_mode), time_ms);
+        app_bt_adv_reconnect_pending = WICED_FALSE;
+    }
+
+#ifdef APP_BT_EXT_ADV
+    app_bt_ext_adv_findme_stopped();
+#endif
+
+    if (!app_bt_adv_active)
+    {
+        return;
+    }
+
+    if (BTM_BLE_ADVERT_OFF == app_bt_adv_directed_mode)
+    {
+        time_ms = (now - app_bt_adv_start_time) * portTICK_PERIOD_MS;
+        p_stats->connect_count++;
+        p_stats->connect_time_ms += time_ms;
+        if (time_ms > p_stats->max_connect_time_ms)
+        {
+            p_stats->max_connect_time_ms = time_ms;
+        }
+        APP_LOG(APP_LOG_ID_ADV_TIME_TO_CONNECT, app_bt_adv_stage, time_ms);
+    }
+
+    app_bt_adv_active = WICED_FALSE;
+    app_bt_adv_directed_mode = BTM_BLE_ADVERT_OFF;
+    wiced_stop_timer(&app_bt_adv_timer);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_reconnect
+********************************************************************************
+* Summary:
+*   Restarts advertising after a disconnection. The client that left is
+*   invited back with directed advertising, high duty first and low duty for
+*   the rest of APP_BT_ADV_DIRECTED_WINDOW_MS; the undirected stages follow
+*   if it does not come back. The undirected stages start right away if the
+*   client is still connected over another link.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr       : Address of the client that left
+*   wiced_bt_ble_address_type_t addr_type   : Address type of the client
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS if advertising started
+*
+*******************************************************************************/
+wiced_result_t app_bt_adv_reconnect(wiced_bt_device_address_t bd_addr,
+                                    wiced_bt_ble_address_type_t addr_type)
+{
+    memcpy(app_bt_adv_peer, bd_addr, BD_ADDR_LEN);
+    app_bt_adv_peer_type = addr_type;
+    app_bt_adv_reconnect_pending = (NULL == app_bt_conn_find_by_bda(bd_addr));
+    app_bt_adv_disconnect_time = xTaskGetTickCount();
+
+    if (!app_bt_adv_reconnect_pending || (0 == APP_BT_ADV_DIRECTED_WINDOW_MS))
+    {
+        return app_bt_adv_start(APP_BT_ADV_EVENT_DISCONNECT);
+    }
+
+    APP_LOG_BDA(APP_LOG_ID_ADV_DIRECTED, app_bt_adv_peer);
+
+    app_bt_adv_active = WICED_TRUE;
+    app_bt_adv_directed_mode = BTM_BLE_ADVERT_DIRECTED_HIGH;
+    wiced_stop_timer(&app_bt_adv_timer);
+    wiced_start_timer(&app_bt_adv_timer,
+                      (APP_BT_ADV_DIRECTED_HIGH_MS < APP_BT_ADV_DIRECTED_WINDOW_MS) ?
+                      APP_BT_ADV_DIRECTED_HIGH_MS : APP_BT_ADV_DIRECTED_WINDOW_MS);
+
+    return app_bt_adv_set_mode(BTM_BLE_ADVERT_DIRECTED_HIGH, app_bt_adv_peer_type, app_bt_adv_peer);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_stop
+********************************************************************************
+* Summary:
+*   Stops the scheduler and advertising.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_stop(void)
+{
+    app_bt_adv_active = WICED_FALSE;
+    wiced_stop_timer(&app_bt_adv_timer);
+
+    if (BTM_BLE_ADVERT_OFF != app_bt_adv_get_mode())
+    {
+        (void)app_bt_adv_set_mode(BTM_BLE_ADVERT_OFF, 0, NULL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_is_active
+********************************************************************************
+* Summary:
+*   Tells whether the scheduler is running. Advertising may still be paused
+*   by a BTM_BLE_ADVERT_OFF stage.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the scheduler is running
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_is_active(void)
+{
+    return app_bt_adv_active;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_get_stats
+********************************************************************************
+* Summary:
+*   Returns a copy of the counters of a stage.
+*
+* Parameters:
+*   uint8_t stage                      : Stage index
+*   app_bt_adv_stage_stats_t *p_stats  : Destination of the copy
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_get_stats(uint8_t stage, app_bt_adv_stage_stats_t *p_stats)
+{
+    if (stage < APP_BT_ADV_NUM_STAGES)
+    {
+        *p_stats = app_bt_adv_stats[stage];
+    }
+    else
+    {
+        memset(p_stats, 0, sizeof(*p_stats));
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_get_reconnect_stats
+********************************************************************************
+* Summary:
+*   Returns a copy of the reconnection counters.
+*
+* Parameters:
+*   app_bt_adv_reconnect_stats_t *p_stats: Destination of the copy
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_get_reconnect_stats(app_bt_adv_reconnect_stats_t *p_stats)
+{
+    *p_stats = app_bt_adv_reconnect_stats;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_log_stats
+********************************************************************************
+* Summary:
+*   Prints the counters of every stage with the average time to connect, and
+*   the reconnection latencies of directed and undirected advertising.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_log_stats(void)
+{
+    app_bt_adv_stage_stats_t *p_stats;
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_ADV_NUM_STAGES; i++)
+    {
+        p_stats = &app_bt_adv_stats[i];
+        APP_LOG(APP_LOG_ID_ADV_STAGE_STATS, i, p_stats->enter_count, p_stats->connect_count,
+                (0 != p_stats->connect_count) ? (p_stats->connect_time_ms / p_stats->connect_count) : 0,
+                p_stats->max_connect_time_ms);
+    }
+
+    APP_LOG(APP_LOG_ID_ADV_RECONNECT_STATS,
+            app_bt_adv_reconnect_stats.directed.count,
+            (0 != app_bt_adv_reconnect_stats.directed.count) ?
+            (app_bt_adv_reconnect_stats.directed.time_ms / app_bt_adv_reconnect_stats.directed.count) : 0,
+            app_bt_adv_reconnect_stats.undirected.count,
+            (0 != app_bt_adv_reconnect_stats.undirected.count) ?
+            (app_bt_adv_reconnect_stats.undirected.time_ms / app_bt_adv_reconnect_stats.undirected.count) : 0,
+            app_bt_adv_reconnect_stats.fallback_count);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_enter_stage
+********************************************************************************
+* Summary:
+*   Switches advertising to the mode of a stage and arms the timer for its
+*   end.
+*
+* Parameters:
+*   uint8_t stage: Stage index
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS if advertising started
+*
+*******************************************************************************/
+static wiced_result_t app_bt_adv_enter_stage(uint8_t stage)
+{
+    const app_bt_adv_stage_t *p_stage = &app_bt_adv_stages[stage];
+    wiced_result_t result = WICED_BT_SUCCESS;
+
+    app_bt_adv_stage = stage;
+    app_bt_adv_stats[stage].enter_count++;
+
+    wiced_stop_timer(&app_bt_adv_timer);
+    if (0 != p_stage->duration_ms)
+    {
+        wiced_start_timer(&app_bt_adv_timer, p_stage->duration_ms);
+    }
+
+    if ((BTM_BLE_ADVERT_OFF != p_stage->mode) ||
+        (BTM_BLE_ADVERT_OFF != app_bt_adv_get_mode()))
+    {
+        result = app_bt_adv_set_mode(p_stage->mode, 0, NULL);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_record_latency
+********************************************************************************
+* Summary:
+*   Adds one reconnection to a latency counter.
+*
+* Parameters:
+*   app_bt_adv_latency_t *p_latency : Counter
+*   uint32_t time_ms                : Time from disconnection to reconnection
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_adv_record_latency(app_bt_adv_latency_t *p_latency, uint32_t time_ms)
+{
+    p_latency->count++;
+    p_latency->time_ms += time_ms;
+    if (time_ms > p_latency->max_time_ms)
+    {
+        p_latency->max_time_ms = time_ms;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_timer_cb
+********************************************************************************
+* Summary:
+*   Moves to the next stage at the end of the current one. In the directed
+*   window, moves from high to low duty directed advertising, then falls back
+*   to the first undirected stage.
+*
+* Parameters:
+*   WICED_TIMER_PARAM_TYPE arg: Unused
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_adv_timer_cb(WICED_TIMER_PARAM_TYPE arg)
+{
+    uint8_t next = (uint8_t)(app_bt_adv_stage + 1);
+
+    (void)arg;
+
+    if (!app_bt_adv_active)
+    {
+        return;
+    }
+
+    if ((BTM_BLE_ADVERT_DIRECTED_HIGH == app_bt_adv_directed_mode) &&
+        (APP_BT_ADV_DIRECTED_WINDOW_MS > APP_BT_ADV_DIRECTED_HIGH_MS))
+    {
+        app_bt_adv_directed_mode = BTM_BLE_ADVERT_DIRECTED_LOW;
+        wiced_start_timer(&app_bt_adv_timer, APP_BT_ADV_DIRECTED_WINDOW_MS - APP_BT_ADV_DIRECTED_HIGH_MS);
+        (void)app_bt_adv_set_mode(BTM_BLE_ADVERT_DIRECTED_LOW, app_bt_adv_peer_type, app_bt_adv_peer);
+        return;
+    }
+
+    if (BTM_BLE_ADVERT_OFF != app_bt_adv_directed_mode)
+    {
+        app_bt_adv_reconnect_stats.fallback_count++;
+        (void)app_bt_adv_start(APP_BT_ADV_EVENT_DISCONNECT);
+        return;
+    }
+
+    if (next >= APP_BT_ADV_NUM_STAGES)
+    {
+        next = APP_BT_ADV_REPEAT_STAGE;
+    }
+
+    (void)app_bt_adv_enter_stage(next);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_set_mode
+********************************************************************************
+* Summary:
+*   Switches the connectable advertising to a mode, through the legacy
+*   advertising API or, with APP_BT_EXT_ADV, through the Find Me advertising
+*   set. The controller does not accept legacy advertising commands once
+*   extended advertising is used, so only one of them is built in.
+*
+* Parameters:
+*   wiced_bt_ble_advert_mode_t mode            : Advertising mode
+*   wiced_bt_ble_address_type_t peer_addr_type : Address type of the peer of directed modes
+*   wiced_bt_device_address_t peer_addr        : Peer of directed modes, NULL otherwise
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS if the mode is set
+*
+*******************************************************************************/
+static wiced_result_t app_bt_adv_set_mode(wiced_bt_ble_advert_mode_t mode,
+                                          wiced_bt_ble_address_type_t peer_addr_type,
+                                          wiced_bt_device_address_t peer_addr)
+{
+#ifdef APP_BT_EXT_ADV
+    return app_bt_ext_adv_set_findme(mode, peer_addr_type, peer_addr);
+#else
+    return wiced_bt_start_advertisements(mode, peer_addr_type, peer_addr);
+#endif
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_get_mode
+********************************************************************************
+* Summary:
+*   Returns the mode of the connectable advertising.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bt_ble_advert_mode_t: Current mode
+*
+*******************************************************************************/
+static wiced_bt_ble_advert_mode_t app_bt_adv_get_mode(void)
+{
+#ifdef APP_BT_EXT_ADV
+    return app_bt_ext_adv_get_findme_mode();
+#else
+    return wiced_bt_ble_get_current_advert_mode();
+#endif
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,160 @@
+/******************************************************************************
+* File Name:   app_bt_adv.h
+*
+* Description: This file contains the declarations of the advertising scheduler that
+*              backs off from fast to slow advertising while no client connects.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_ADV_H__
+#define __APP_BT_ADV_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_ble.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Advertising stages: { advertising mode, duration in ms }. The scheduler
+ * starts with the first stage and moves to the next one when a stage ends.
+ * BTM_BLE_ADVERT_UNDIRECTED_HIGH and _LOW use the intervals set in
+ * design.cybt; a stage must not be longer than the advertising timeout of
+ * its mode there, since the stack stops advertising at the timeout.
+ * BTM_BLE_ADVERT_OFF pauses advertising. A duration of 0 keeps the stage
+ * until the next event */
+#ifndef APP_BT_ADV_STAGES
+#define APP_BT_ADV_STAGES \
+    { \
+        { BTM_BLE_ADVERT_UNDIRECTED_HIGH, 30000 }, \
+        { BTM_BLE_ADVERT_UNDIRECTED_LOW,  60000 }, \
+        { BTM_BLE_ADVERT_OFF,             60000 }, \
+    }
+#endif
+
+/* Stage the scheduler returns to after the last stage */
+#ifndef APP_BT_ADV_REPEAT_STAGE
+#define APP_BT_ADV_REPEAT_STAGE         (1u)
+#endif
+
+/* Maximum number of stages */
+#define APP_BT_ADV_MAX_STAGES           (8u)
+
+/* Fast reconnection: after a disconnection the scheduler advertises directed
+ * to the client that left for this long before falling back to the
+ * undirected stages. Other clients cannot discover the target in the
+ * meantime. 0 disables fast reconnection */
+#ifndef APP_BT_ADV_DIRECTED_WINDOW_MS
+#define APP_BT_ADV_DIRECTED_WINDOW_MS   (5000u)
+#endif
+
+/* Part of the window spent in high duty directed advertising, which the
+ * controller limits to 1.28 s; the rest uses low duty directed advertising */
+#ifndef APP_BT_ADV_DIRECTED_HIGH_MS
+#define APP_BT_ADV_DIRECTED_HIGH_MS     (1280u)
+#endif
+
+#if (APP_BT_ADV_DIRECTED_HIGH_MS > 1280u)
+#error "High duty directed advertising lasts at most 1.28 s"
+#endif
+
+/******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Events that restart advertising from the first stage */
+typedef enum
+{
+    APP_BT_ADV_EVENT_STARTUP,           /* Stack enabled */
+    APP_BT_ADV_EVENT_CONNECT,           /* Client connected, more clients can be accepted */
+    APP_BT_ADV_EVENT_DISCONNECT,        /* Client disconnected */
+    APP_BT_ADV_EVENT_ALERT,             /* Alert level changed */
+    APP_BT_ADV_EVENT_BUTTON,            /* User button pressed */
+} app_bt_adv_event_t;
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Counters of one advertising stage */
+typedef struct
+{
+    uint32_t enter_count;               /* Times the stage was entered */
+    uint32_t connect_count;             /* Connections made during the stage */
+    uint32_t connect_time_ms;           /* Sum of the times to connect of these connections */
+    uint32_t max_connect_time_ms;       /* Longest time to connect */
+} app_bt_adv_stage_stats_t;
+
+/* Reconnection latency of the client that left, by the kind of advertising
+ * it reconnected to */
+typedef struct
+{
+    uint32_t count;                     /* Reconnections */
+    uint32_t time_ms;                   /* Sum of the times from disconnection to reconnection */
+    uint32_t max_time_ms;               /* Longest reconnection */
+} app_bt_adv_latency_t;
+
+typedef struct
+{
+    app_bt_adv_latency_t directed;      /* Reconnected during the directed window */
+    app_bt_adv_latency_t undirected;    /* Reconnected to undirected advertising */
+    uint32_t             fallback_count;/* Directed windows that ended without the client */
+} app_bt_adv_reconnect_stats_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_adv_init(void);
+
+wiced_result_t app_bt_adv_start(app_bt_adv_event_t event);
+
+void app_bt_adv_kick(app_bt_adv_event_t event);
+
+void app_bt_adv_connected(wiced_bt_device_address_t bd_addr);
+
+wiced_result_t app_bt_adv_reconnect(wiced_bt_device_address_t bd_addr,
+                                    wiced_bt_ble_address_type_t addr_type);
+
+void app_bt_adv_stop(void);
+
+wiced_bool_t app_bt_adv_is_active(void);
+
+void app_bt_adv_get_stats(uint8_t stage, app_bt_adv_stage_stats_t *p_stats);
+
+void app_bt_adv_get_reconnect_stats(app_bt_adv_reconnect_stats_t *p_stats);
+
+void app_bt_adv_log_stats(void);
+
+#endif      /* __APP_BT_ADV_H__ */
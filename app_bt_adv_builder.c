@@ -0,0 +1,477 @@
+/******************************************************************************
+* File Name:   app_bt_adv_builder.c
+*
+* Description: This file implements the advertising data builder. AD structures are
+*              added to the idle one of two static buffers, without allocation, and the
+*              finished data is handed to the stack by app_bt_adv_builder_commit. The
+*              buffer in use by the stack is never modified.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_adv_builder.h"
+#include "app_bt_ext_adv.h"
+#include "app_log.h"
+#include <string.h>
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static uint8_t *app_bt_adv_builder_reserve(app_bt_adv_builder_t *p_builder, uint8_t type, uint8_t len);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_init
+********************************************************************************
+* Summary:
+*   Initializes a builder with two empty buffers.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_builder_init(app_bt_adv_builder_t *p_builder)
+{
+    memset(p_builder, 0, sizeof(*p_builder));
+    p_builder->active = 1;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_begin
+********************************************************************************
+* Summary:
+*   Starts new advertising data in the idle buffer.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_builder_begin(app_bt_adv_builder_t *p_builder)
+{
+    app_bt_adv_builder_buf_t *p_buf = &p_builder->buf[p_builder->active ^ 1];
+
+    p_buf->num_elems = 0;
+    p_buf->data_len = 0;
+    p_buf->len = 0;
+    p_builder->overflow = WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add
+********************************************************************************
+* Summary:
+*   Adds an AD structure with any type.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   uint8_t type                   : AD type
+*   const uint8_t *p_data          : AD data
+*   uint8_t len                    : Length of the data
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the structure fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add(app_bt_adv_builder_t *p_builder, uint8_t type,
+                                    const uint8_t *p_data, uint8_t len)
+{
+    uint8_t *p = app_bt_adv_builder_reserve(p_builder, type, len);
+
+    if (NULL == p)
+    {
+        return WICED_FALSE;
+    }
+
+    memcpy(p, p_data, len);
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_elems
+********************************************************************************
+* Summary:
+*   Adds a copy of existing elements, such as cy_bt_adv_packet_data generated
+*   in cycfg_gap.c.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder         : Builder
+*   const wiced_bt_ble_advert_elem_t *p_elems: Elements
+*   uint8_t num_elems                        : Number of elements
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if all elements fit
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_elems(app_bt_adv_builder_t *p_builder,
+                                          const wiced_bt_ble_advert_elem_t *p_elems, uint8_t num_elems)
+{
+    uint8_t i;
+
+    for (i = 0; i < num_elems; i++)
+    {
+        if ((p_elems[i].len > APP_BT_ADV_BUILDER_MAX_LEN) ||
+            !app_bt_adv_builder_add(p_builder, p_elems[i].advert_type,
+                                    p_elems[i].p_data, (uint8_t)p_elems[i].len))
+        {
+            p_builder->overflow = WICED_TRUE;
+            return WICED_FALSE;
+        }
+    }
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_flags
+********************************************************************************
+* Summary:
+*   Adds the flags, for example BTM_BLE_GENERAL_DISCOVERABLE_FLAG |
+*   BTM_BLE_BREDR_NOT_SUPPORTED.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   uint8_t flags                  : Flags
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the structure fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_flags(app_bt_adv_builder_t *p_builder, uint8_t flags)
+{
+    return app_bt_adv_builder_add(p_builder, BTM_BLE_ADVERT_TYPE_FLAG, &flags, 1);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_name
+********************************************************************************
+* Summary:
+*   Adds the complete local name. A name that does not fit in the remaining
+*   space is truncated and sent as the shortened local name.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   const char *p_name             : Null terminated name
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the complete name fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_name(app_bt_adv_builder_t *p_builder, const char *p_name)
+{
+    const app_bt_adv_builder_buf_t *p_buf = &p_builder->buf[p_builder->active ^ 1];
+    size_t len = strlen(p_name);
+    uint8_t room;
+
+    if (APP_BT_ADV_BUILDER_AD_LEN(len) <= (size_t)(APP_BT_ADV_BUILDER_MAX_LEN - p_buf->len))
+    {
+        return app_bt_adv_builder_add(p_builder, BTM_BLE_ADVERT_TYPE_NAME_COMPLETE,
+                                      (const uint8_t *)p_name, (uint8_t)len);
+    }
+
+    /* At least one character of the name is needed to be useful */
+    room = (uint8_t)(APP_BT_ADV_BUILDER_MAX_LEN - p_buf->len);
+    if (room > APP_BT_ADV_BUILDER_AD_LEN(0))
+    {
+        (void)app_bt_adv_builder_add(p_builder, BTM_BLE_ADVERT_TYPE_NAME_SHORT,
+                                     (const uint8_t *)p_name, (uint8_t)(room - APP_BT_ADV_BUILDER_AD_LEN(0)));
+    }
+    else
+    {
+        p_builder->overflow = WICED_TRUE;
+    }
+
+    return WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_uuid16
+********************************************************************************
+* Summary:
+*   Adds the complete list of 16-bit service UUIDs.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   const uint16_t *p_uuids        : Service UUIDs
+*   uint8_t count                  : Number of UUIDs
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the structure fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_uuid16(app_bt_adv_builder_t *p_builder,
+                                           const uint16_t *p_uuids, uint8_t count)
+{
+    uint8_t *p;
+    uint8_t i;
+
+    if (count > (APP_BT_ADV_BUILDER_MAX_LEN / 2))
+    {
+        p_builder->overflow = WICED_TRUE;
+        return WICED_FALSE;
+    }
+
+    p = app_bt_adv_builder_reserve(p_builder, BTM_BLE_ADVERT_TYPE_16SRV_COMPLETE, (uint8_t)(2 * count));
+    if (NULL == p)
+    {
+        return WICED_FALSE;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        *p++ = (uint8_t)(p_uuids[i] & 0xff);
+        *p++ = (uint8_t)(p_uuids[i] >> 8);
+    }
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_uuid128
+********************************************************************************
+* Summary:
+*   Adds a complete list with one 128-bit service UUID.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   const uint8_t *p_uuid          : UUID, 16 bytes in little endian order
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the structure fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_uuid128(app_bt_adv_builder_t *p_builder, const uint8_t *p_uuid)
+{
+    return app_bt_adv_builder_add(p_builder, BTM_BLE_ADVERT_TYPE_128SRV_COMPLETE, p_uuid, 16);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_manufacturer
+********************************************************************************
+* Summary:
+*   Adds manufacturer specific data: the company identifier followed by the
+*   data.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   uint16_t company_id            : Bluetooth SIG company identifier
+*   const uint8_t *p_data          : Manufacturer data
+*   uint8_t len                    : Length of the data
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the structure fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_manufacturer(app_bt_adv_builder_t *p_builder, uint16_t company_id,
+                                                 const uint8_t *p_data, uint8_t len)
+{
+    uint8_t *p;
+
+    if (len > (APP_BT_ADV_BUILDER_MAX_LEN - 2))
+    {
+        p_builder->overflow = WICED_TRUE;
+        return WICED_FALSE;
+    }
+
+    p = app_bt_adv_builder_reserve(p_builder, BTM_BLE_ADVERT_TYPE_MANUFACTURER, (uint8_t)(2 + len));
+    if (NULL == p)
+    {
+        return WICED_FALSE;
+    }
+
+    p[0] = (uint8_t)(company_id & 0xff);
+    p[1] = (uint8_t)(company_id >> 8);
+    memcpy(&p[2], p_data, len);
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_add_tx_power
+********************************************************************************
+* Summary:
+*   Adds the TX power level, which lets a scanner estimate the path loss.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   int8_t tx_power                : TX power in dBm
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the structure fits
+*
+*******************************************************************************/
+wiced_bool_t app_bt_adv_builder_add_tx_power(app_bt_adv_builder_t *p_builder, int8_t tx_power)
+{
+    uint8_t level = (uint8_t)tx_power;
+
+    return app_bt_adv_builder_add(p_builder, BTM_BLE_ADVERT_TYPE_TX_POWER, &level, 1);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_get_len
+********************************************************************************
+* Summary:
+*   Returns the encoded length of the data built so far.
+*
+* Parameters:
+*   const app_bt_adv_builder_t *p_builder: Builder
+*
+* Return:
+*   uint8_t: Length in bytes
+*
+*******************************************************************************/
+uint8_t app_bt_adv_builder_get_len(const app_bt_adv_builder_t *p_builder)
+{
+    return p_builder->buf[p_builder->active ^ 1].len;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_commit
+********************************************************************************
+* Summary:
+*   Hands the data built since app_bt_adv_builder_begin to the stack and, once
+*   it is accepted, makes it the active buffer. Data with an element that did
+*   not fit is not sent, so the previous data stays in use.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*
+* Return:
+*   wiced_result_t: WICED_BT_BADARG if an element did not fit, otherwise the
+*                   result of setting the advertising data
+*
+*******************************************************************************/
+wiced_result_t app_bt_adv_builder_commit(app_bt_adv_builder_t *p_builder)
+{
+    uint8_t next = (uint8_t)(p_builder->active ^ 1);
+    app_bt_adv_builder_buf_t *p_buf = &p_builder->buf[next];
+    wiced_result_t result;
+
+    if (p_builder->overflow)
+    {
+        p_builder->failures++;
+        return WICED_BT_BADARG;
+    }
+
+#ifdef APP_BT_EXT_ADV
+    result = app_bt_ext_adv_set_findme_data(p_buf->num_elems, p_buf->elems);
+#else
+    result = wiced_bt_ble_set_raw_advertisement_data(p_buf->num_elems, p_buf->elems);
+#endif
+
+    if (WICED_BT_SUCCESS == result)
+    {
+        p_builder->active = next;
+        p_builder->commits++;
+    }
+    else
+    {
+        p_builder->failures++;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_log_stats
+********************************************************************************
+* Summary:
+*   Prints the number of updates accepted and refused, and the length of the
+*   advertising data in use.
+*
+* Parameters:
+*   const app_bt_adv_builder_t *p_builder: Builder
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_builder_log_stats(const app_bt_adv_builder_t *p_builder)
+{
+    APP_LOG(APP_LOG_ID_ADV_BUILDER_STATS, p_builder->commits, p_builder->failures,
+            p_builder->buf[p_builder->active].len, APP_BT_ADV_BUILDER_MAX_LEN);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_builder_reserve
+********************************************************************************
+* Summary:
+*   Adds an element of len bytes to the idle buffer and returns where its data
+*   goes. Marks the builder as overflowed if it does not fit.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   uint8_t type                   : AD type
+*   uint8_t len                    : Length of the data
+*
+* Return:
+*   uint8_t *: Data of the element, NULL if it does not fit
+*
+*******************************************************************************/
+static uint8_t *app_bt_adv_builder_reserve(app_bt_adv_builder_t *p_builder, uint8_t type, uint8_t len)
+{
+    app_bt_adv_builder_buf_t *p_buf = &p_builder->buf[p_builder->active ^ 1];
+    wiced_bt_ble_advert_elem_t *p_elem;
+
+    if ((p_buf->num_elems >= APP_BT_ADV_BUILDER_MAX_ELEMS) ||
+        ((p_buf->len + APP_BT_ADV_BUILDER_AD_LEN(len)) > APP_BT_ADV_BUILDER_MAX_LEN))
+    {
+        p_builder->overflow = WICED_TRUE;
+        return NULL;
+    }
+
+    p_elem = &p_buf->elems[p_buf->num_elems++];
+    p_elem->advert_type = type;
+    p_elem->len = len;
+    p_elem->p_data = &p_buf->data[p_buf->data_len];
+
+    p_buf->data_len += len;
+    p_buf->len += APP_BT_ADV_BUILDER_AD_LEN(len);
+
+    return p_elem->p_data;
+}
+
+/* END OF FILE [] */
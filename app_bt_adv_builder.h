@@ -0,0 +1,131 @@
+/******************************************************************************
+* File Name:   app_bt_adv_builder.h
+*
+* Description: This file contains the declarations of the advertising data builder.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_ADV_BUILDER_H__
+#define __APP_BT_ADV_BUILDER_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_ble.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Largest legacy advertising data */
+#define APP_BT_ADV_BUILDER_MAX_LEN          (31u)
+
+/* Maximum number of AD structures, each takes at least 2 bytes */
+#ifndef APP_BT_ADV_BUILDER_MAX_ELEMS
+#define APP_BT_ADV_BUILDER_MAX_ELEMS        (8u)
+#endif
+
+/* Encoded length of the AD structures, with their length and type bytes.
+ * Used to check static advertising data at build time */
+#define APP_BT_ADV_BUILDER_AD_LEN(data_len)             (2u + (data_len))
+#define APP_BT_ADV_BUILDER_FLAGS_LEN                    APP_BT_ADV_BUILDER_AD_LEN(1u)
+#define APP_BT_ADV_BUILDER_NAME_LEN(name)               APP_BT_ADV_BUILDER_AD_LEN(sizeof(name) - 1u)
+#define APP_BT_ADV_BUILDER_UUID16_LEN(count)            APP_BT_ADV_BUILDER_AD_LEN(2u * (count))
+#define APP_BT_ADV_BUILDER_UUID128_LEN                  APP_BT_ADV_BUILDER_AD_LEN(16u)
+#define APP_BT_ADV_BUILDER_MANUFACTURER_LEN(data_len)   APP_BT_ADV_BUILDER_AD_LEN(2u + (data_len))
+#define APP_BT_ADV_BUILDER_TX_POWER_LEN                 APP_BT_ADV_BUILDER_AD_LEN(1u)
+
+/* Fails the build if static advertising data of length len does not fit */
+#define APP_BT_ADV_BUILDER_CHECK_LEN(len, msg) \
+    _Static_assert((len) <= APP_BT_ADV_BUILDER_MAX_LEN, msg)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One advertising data buffer. The elements point into data */
+typedef struct
+{
+    wiced_bt_ble_advert_elem_t elems[APP_BT_ADV_BUILDER_MAX_ELEMS];
+    uint8_t                    data[APP_BT_ADV_BUILDER_MAX_LEN];
+    uint8_t                    num_elems;
+    uint8_t                    data_len;    /* Bytes of data in use */
+    uint8_t                    len;         /* Encoded length of the elements */
+} app_bt_adv_builder_buf_t;
+
+/* Advertising data builder. The data is built in the idle buffer while the
+ * other one is in use by the stack; app_bt_adv_builder_commit swaps them */
+typedef struct
+{
+    app_bt_adv_builder_buf_t buf[2];
+    uint8_t                  active;        /* Buffer handed to the stack */
+    wiced_bool_t             overflow;      /* An element did not fit */
+    uint32_t                 commits;       /* Data accepted by the stack */
+    uint32_t                 failures;      /* Data that did not fit or was refused */
+} app_bt_adv_builder_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_adv_builder_init(app_bt_adv_builder_t *p_builder);
+
+void app_bt_adv_builder_begin(app_bt_adv_builder_t *p_builder);
+
+wiced_bool_t app_bt_adv_builder_add(app_bt_adv_builder_t *p_builder, uint8_t type,
+                                    const uint8_t *p_data, uint8_t len);
+
+wiced_bool_t app_bt_adv_builder_add_elems(app_bt_adv_builder_t *p_builder,
+                                          const wiced_bt_ble_advert_elem_t *p_elems, uint8_t num_elems);
+
+wiced_bool_t app_bt_adv_builder_add_flags(app_bt_adv_builder_t *p_builder, uint8_t flags);
+
+wiced_bool_t app_bt_adv_builder_add_name(app_bt_adv_builder_t *p_builder, const char *p_name);
+
+wiced_bool_t app_bt_adv_builder_add_uuid16(app_bt_adv_builder_t *p_builder,
+                                           const uint16_t *p_uuids, uint8_t count);
+
+wiced_bool_t app_bt_adv_builder_add_uuid128(app_bt_adv_builder_t *p_builder, const uint8_t *p_uuid);
+
+wiced_bool_t app_bt_adv_builder_add_manufacturer(app_bt_adv_builder_t *p_builder, uint16_t company_id,
+                                                 const uint8_t *p_data, uint8_t len);
+
+wiced_bool_t app_bt_adv_builder_add_tx_power(app_bt_adv_builder_t *p_builder, int8_t tx_power);
+
+uint8_t app_bt_adv_builder_get_len(const app_bt_adv_builder_t *p_builder);
+
+wiced_result_t app_bt_adv_builder_commit(app_bt_adv_builder_t *p_builder);
+
+void app_bt_adv_builder_log_stats(const app_bt_adv_builder_t *p_builder);
+
+#endif      /* __APP_BT_ADV_BUILDER_H__ */
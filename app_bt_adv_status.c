@@ -0,0 +1,198 @@
+/******************************************************************************
+* File Name:   app_bt_adv_status.c
+*
+* Description: This file implements the advertising status. The generated advertising
+*              data is extended with manufacturer specific data holding the alert level,
+*              so that a locator learns the alert state from a scan without connecting.
+*              Each update is built in the idle one of two buffers before it is handed
+*              to the stack, so the payload in use is never modified.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_adv_status.h"
+#include "app_bt_adv_builder.h"
+#include "app_log.h"
+#include "GeneratedSource/cycfg_gap.h"
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static app_bt_adv_builder_t app_bt_adv_status_builder;
+static uint8_t              app_bt_adv_status_alert_level;
+static uint8_t              app_bt_adv_status_counter;
+static wiced_bool_t         app_bt_adv_status_fits;     /* Status fits next to the generated data */
+
+/* The status must at least fit next to the flags */
+APP_BT_ADV_BUILDER_CHECK_LEN(APP_BT_ADV_BUILDER_FLAGS_LEN +
+                             APP_BT_ADV_BUILDER_MANUFACTURER_LEN(APP_BT_ADV_STATUS_DATA_LEN),
+                             "No room for the advertised status");
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static wiced_result_t app_bt_adv_status_publish(void);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_adv_status_init
+********************************************************************************
+* Summary:
+*   Sets the advertising data: the elements generated in cycfg_gap.c followed
+*   by the status. The status is left out if it does not fit in the 31 bytes
+*   of legacy advertising data next to the generated elements.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_result_t: Result of setting the advertising data
+*
+*******************************************************************************/
+wiced_result_t app_bt_adv_status_init(void)
+{
+    uint8_t len;
+
+    app_bt_adv_builder_init(&app_bt_adv_status_builder);
+    app_bt_adv_status_alert_level = 0;
+    app_bt_adv_status_counter = 0;
+    app_bt_adv_status_fits = WICED_TRUE;
+
+    app_bt_adv_builder_begin(&app_bt_adv_status_builder);
+    (void)app_bt_adv_builder_add_elems(&app_bt_adv_status_builder,
+                                       cy_bt_adv_packet_data, CY_BT_ADV_PACKET_DATA_SIZE);
+    len = app_bt_adv_builder_get_len(&app_bt_adv_status_builder);
+    if ((len + APP_BT_ADV_BUILDER_MANUFACTURER_LEN(APP_BT_ADV_STATUS_DATA_LEN)) > APP_BT_ADV_BUILDER_MAX_LEN)
+    {
+        app_bt_adv_status_fits = WICED_FALSE;
+        APP_LOG(APP_LOG_ID_ADV_STATUS_NO_ROOM,
+                len + APP_BT_ADV_BUILDER_MANUFACTURER_LEN(APP_BT_ADV_STATUS_DATA_LEN),
+                APP_BT_ADV_BUILDER_MAX_LEN);
+    }
+
+    return app_bt_adv_status_publish();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_status_set_alert_level
+********************************************************************************
+* Summary:
+*   Publishes a new alert level in the advertising data.
+*
+* Parameters:
+*   uint8_t alert_level: IAS alert level
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_status_set_alert_level(uint8_t alert_level)
+{
+    if (alert_level == app_bt_adv_status_alert_level)
+    {
+        return;
+    }
+
+    app_bt_adv_status_alert_level = alert_level;
+    app_bt_adv_status_counter++;
+    (void)app_bt_adv_status_publish();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_status_log_stats
+********************************************************************************
+* Summary:
+*   Prints the counters of the advertising data updates.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_adv_status_log_stats(void)
+{
+    app_bt_adv_builder_log_stats(&app_bt_adv_status_builder);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_adv_status_publish
+********************************************************************************
+* Summary:
+*   Builds the advertising data in the idle buffer of the builder and hands
+*   it to the stack. If the stack refuses it, the previous data stays in use.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_result_t: Result of setting the advertising data
+*
+*******************************************************************************/
+static wiced_result_t app_bt_adv_status_publish(void)
+{
+    uint8_t status[APP_BT_ADV_STATUS_DATA_LEN];
+    wiced_result_t result;
+
+    app_bt_adv_builder_begin(&app_bt_adv_status_builder);
+    (void)app_bt_adv_builder_add_elems(&app_bt_adv_status_builder,
+                                       cy_bt_adv_packet_data, CY_BT_ADV_PACKET_DATA_SIZE);
+
+    if (app_bt_adv_status_fits)
+    {
+        status[0] = APP_BT_ADV_STATUS_FORMAT;
+        status[1] = app_bt_adv_status_alert_level;
+        status[2] = app_bt_adv_status_counter;
+        (void)app_bt_adv_builder_add_manufacturer(&app_bt_adv_status_builder, APP_BT_ADV_STATUS_COMPANY_ID,
+                                                  status, sizeof(status));
+    }
+
+    result = app_bt_adv_builder_commit(&app_bt_adv_status_builder);
+    if (WICED_BT_SUCCESS == result)
+    {
+        APP_LOG(APP_LOG_ID_ADV_STATUS, app_bt_adv_status_alert_level, app_bt_adv_status_counter);
+    }
+
+    return result;
+}
+
+/* END OF FILE [] */
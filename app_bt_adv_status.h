@@ -0,0 +1,70 @@
+/******************************************************************************
+* File Name:   app_bt_adv_status.h
+*
+* Description: This file contains the declarations of the advertising status: the alert
+*              level and a rolling status counter carried in the advertising data.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_ADV_STATUS_H__
+#define __APP_BT_ADV_STATUS_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_ble.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Manufacturer specific data added to the advertising data:
+ * company identifier (2 bytes, little endian), format, alert level, status
+ * counter. The counter changes with every payload change, so a locator can
+ * tell a new status from one it has already seen */
+#define APP_BT_ADV_STATUS_COMPANY_ID        (0x0131u)   /* Cypress Semiconductor */
+#define APP_BT_ADV_STATUS_FORMAT            (0x01u)
+#define APP_BT_ADV_STATUS_DATA_LEN          (3u)    /* Following the company identifier */
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_adv_status_init(void);
+
+void app_bt_adv_status_set_alert_level(uint8_t alert_level);
+
+void app_bt_adv_status_log_stats(void);
+
+#endif      /* __APP_BT_ADV_STATUS_H__ */
@@ -0,0 +1,527 @@
+/******************************************************************************
+* File Name:   app_bt_bond.c
+*
+* Description: This file implements the bond store. The link keys of the bonded peers
+*              are kept in RAM behind an index hashed on the peer address, so a key
+*              request from the stack is answered without touching the flash, and every
+*              change is written through to the flash record store.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_bond.h"
+#include "app_nv.h"
+#include "app_log.h"
+#include <string.h>
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Empty bucket of the address index */
+#define APP_BT_BOND_INDEX_EMPTY         (0xFFu)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One bonded peer */
+typedef struct
+{
+    wiced_bool_t                in_use;
+    uint32_t                    last_used;      /* Value of app_bt_bond_use_count at the last use */
+    wiced_bt_device_link_keys_t keys;
+} app_bt_bond_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static app_bt_bond_t app_bt_bonds[APP_BT_BOND_MAX_DEVICES];
+static uint8_t       app_bt_bond_index[APP_BT_BOND_INDEX_SIZE];
+static uint32_t      app_bt_bond_use_count;
+
+/* Records not tied to a peer are stored under this address */
+static const wiced_bt_device_address_t app_bt_bond_no_addr = { 0 };
+
+_Static_assert(sizeof(wiced_bt_device_link_keys_t) <= APP_NV_MAX_DATA_LEN,
+               "Link keys do not fit in a flash record");
+_Static_assert(sizeof(wiced_bt_local_identity_keys_t) <= APP_NV_MAX_DATA_LEN,
+               "Local identity keys do not fit in a flash record");
+_Static_assert((APP_BT_BOND_MAX_DEVICES * BD_ADDR_LEN) <= APP_NV_MAX_DATA_LEN,
+               "The bond list does not fit in a flash record");
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static uint8_t app_bt_bond_hash(const wiced_bt_device_address_t bd_addr);
+static app_bt_bond_t *app_bt_bond_find(const wiced_bt_device_address_t bd_addr);
+static void app_bt_bond_build_index(void);
+static void app_bt_bond_save_list(void);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_bond_init
+********************************************************************************
+* Summary:
+*   Loads the bonds from the flash record store. Must be called after
+*   app_nv_init and before wiced_bt_stack_init, which already requests the
+*   keys.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_bond_init(void)
+{
+    uint8_t list[APP_BT_BOND_MAX_DEVICES * BD_ADDR_LEN];
+    uint8_t len;
+    uint8_t i;
+    uint8_t n = 0;
+
+    memset(app_bt_bonds, 0, sizeof(app_bt_bonds));
+    app_bt_bond_use_count = 0;
+
+    len = app_nv_read(APP_NV_TYPE_BOND_LIST, app_bt_bond_no_addr, list, sizeof(list));
+    for (i = 0; i < (len / BD_ADDR_LEN); i++)
+    {
+        if (sizeof(wiced_bt_device_link_keys_t) ==
+            app_nv_read(APP_NV_TYPE_LINK_KEYS, &list[i * BD_ADDR_LEN],
+                        (uint8_t *)&app_bt_bonds[n].keys, sizeof(wiced_bt_device_link_keys_t)))
+        {
+            /* Keep the order of the list as the order of use */
+            app_bt_bonds[n].in_use = WICED_TRUE;
+            app_bt_bonds[n].last_used = ++app_bt_bond_use_count;
+            n++;
+        }
+    }
+
+    app_bt_bond_build_index();
+    APP_LOG(APP_LOG_ID_BOND_LOADED, n, APP_BT_BOND_MAX_DEVICES);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_stack_enabled
+********************************************************************************
+* Summary:
+*   Adds the bonded peers to the address resolution list of the controller
+*   once the stack is enabled, so that peers using resolvable private
+*   addresses are recognized.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_bond_stack_enabled(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+    {
+        if (app_bt_bonds[i].in_use)
+        {
+            wiced_bt_dev_add_device_to_address_resolution_db(&app_bt_bonds[i].keys);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_save_keys
+********************************************************************************
+* Summary:
+*   Stores the link keys of a peer on BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT.
+*   When the store is full the bond used least recently is removed.
+*
+* Parameters:
+*   wiced_bt_device_link_keys_t *p_keys: Keys reported by the stack
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the keys are stored in flash
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_save_keys(wiced_bt_device_link_keys_t *p_keys)
+{
+    app_bt_bond_t *p_bond = app_bt_bond_find(p_keys->bd_addr);
+    app_bt_bond_t *p_oldest = &app_bt_bonds[0];
+    wiced_bool_t new_bond = (NULL == p_bond);
+    uint8_t i;
+
+    for (i = 0; (NULL == p_bond) && (i < APP_BT_BOND_MAX_DEVICES); i++)
+    {
+        if (!app_bt_bonds[i].in_use)
+        {
+            p_bond = &app_bt_bonds[i];
+        }
+        else if (app_bt_bonds[i].last_used < p_oldest->last_used)
+        {
+            p_oldest = &app_bt_bonds[i];
+        }
+    }
+
+    if (NULL == p_bond)
+    {
+        APP_LOG_BDA(APP_LOG_ID_BOND_REPLACED, p_oldest->keys.bd_addr);
+        app_bt_bond_remove(p_oldest->keys.bd_addr);
+        p_bond = p_oldest;
+    }
+
+    p_bond->in_use = WICED_TRUE;
+    p_bond->last_used = ++app_bt_bond_use_count;
+    memcpy(&p_bond->keys, p_keys, sizeof(wiced_bt_device_link_keys_t));
+
+    if (new_bond)
+    {
+        app_bt_bond_build_index();
+        app_bt_bond_save_list();
+    }
+
+    return app_nv_write(APP_NV_TYPE_LINK_KEYS, p_keys->bd_addr, (const uint8_t *)p_keys,
+                        sizeof(wiced_bt_device_link_keys_t));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_load_keys
+********************************************************************************
+* Summary:
+*   Answers BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT from the RAM copy of the
+*   bonds. A peer that was not the last one used moves to the end of the
+*   stored bond list, so that the order of use survives a reset.
+*
+* Parameters:
+*   wiced_bt_device_link_keys_t *p_keys: Request from the stack, the peer
+*                                        address is filled in and the keys
+*                                        are returned in it
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the peer is bonded
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_load_keys(wiced_bt_device_link_keys_t *p_keys)
+{
+    app_bt_bond_t *p_bond = app_bt_bond_find(p_keys->bd_addr);
+
+    if (NULL == p_bond)
+    {
+        return WICED_FALSE;
+    }
+
+    if (p_bond->last_used != app_bt_bond_use_count)
+    {
+        p_bond->last_used = ++app_bt_bond_use_count;
+        app_bt_bond_save_list();
+    }
+
+    memcpy(p_keys, &p_bond->keys, sizeof(wiced_bt_device_link_keys_t));
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_is_bonded
+********************************************************************************
+* Summary:
+*   Tells whether a peer is bonded.
+*
+* Parameters:
+*   const wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the peer is bonded
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_is_bonded(const wiced_bt_device_address_t bd_addr)
+{
+    return (NULL != app_bt_bond_find(bd_addr));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_remove
+********************************************************************************
+* Summary:
+*   Removes a bond with everything stored for the peer: link keys, CCCD
+*   values and its entry in the address resolution list.
+*
+* Parameters:
+*   const wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_bond_remove(const wiced_bt_device_address_t bd_addr)
+{
+    app_bt_bond_t *p_bond = app_bt_bond_find(bd_addr);
+
+    if (NULL == p_bond)
+    {
+        return;
+    }
+
+    wiced_bt_dev_remove_device_from_address_resolution_db(&p_bond->keys);
+    (void)app_nv_delete(APP_NV_TYPE_LINK_KEYS, bd_addr);
+    (void)app_nv_delete(APP_NV_TYPE_CCCD, bd_addr);
+
+    p_bond->in_use = WICED_FALSE;
+    app_bt_bond_build_index();
+    app_bt_bond_save_list();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_count
+********************************************************************************
+* Summary:
+*   Returns the number of bonded peers.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint8_t: Number of bonds
+*
+*******************************************************************************/
+uint8_t app_bt_bond_count(void)
+{
+    uint8_t i;
+    uint8_t count = 0;
+
+    for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+    {
+        count += app_bt_bonds[i].in_use ? 1 : 0;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_save_local_keys
+********************************************************************************
+* Summary:
+*   Stores the local identity keys on BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT. The
+*   bonds are only usable after a reset if these keys are kept too.
+*
+* Parameters:
+*   wiced_bt_local_identity_keys_t *p_keys: Keys reported by the stack
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the keys are stored in flash
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_save_local_keys(wiced_bt_local_identity_keys_t *p_keys)
+{
+    return app_nv_write(APP_NV_TYPE_LOCAL_KEYS, app_bt_bond_no_addr, (const uint8_t *)p_keys,
+                        sizeof(wiced_bt_local_identity_keys_t));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_load_local_keys
+********************************************************************************
+* Summary:
+*   Answers BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT. Without stored keys the stack
+*   generates new ones and reports them with BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT.
+*
+* Parameters:
+*   wiced_bt_local_identity_keys_t *p_keys: Destination of the keys
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if stored keys were returned
+*
+*******************************************************************************/
+wiced_bool_t app_bt_bond_load_local_keys(wiced_bt_local_identity_keys_t *p_keys)
+{
+    return (sizeof(wiced_bt_local_identity_keys_t) ==
+            app_nv_read(APP_NV_TYPE_LOCAL_KEYS, app_bt_bond_no_addr, (uint8_t *)p_keys,
+                        sizeof(wiced_bt_local_identity_keys_t)));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_hash
+********************************************************************************
+* Summary:
+*   Returns the first bucket of an address in the index.
+*
+* Parameters:
+*   const wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*   uint8_t: Bucket
+*
+*******************************************************************************/
+static uint8_t app_bt_bond_hash(const wiced_bt_device_address_t bd_addr)
+{
+    uint8_t hash = 0;
+    uint8_t i;
+
+    for (i = 0; i < BD_ADDR_LEN; i++)
+    {
+        hash = (uint8_t)((hash * 31u) + bd_addr[i]);
+    }
+
+    return (uint8_t)(hash & (APP_BT_BOND_INDEX_SIZE - 1));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_find
+********************************************************************************
+* Summary:
+*   Looks up the bond of a peer in the address index.
+*
+* Parameters:
+*   const wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*   app_bt_bond_t*: Bond of the peer, NULL if the peer is not bonded
+*
+*******************************************************************************/
+static app_bt_bond_t *app_bt_bond_find(const wiced_bt_device_address_t bd_addr)
+{
+    uint8_t bucket = app_bt_bond_hash(bd_addr);
+    uint8_t slot;
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_BOND_INDEX_SIZE; i++)
+    {
+        slot = app_bt_bond_index[bucket];
+        if (APP_BT_BOND_INDEX_EMPTY == slot)
+        {
+            break;
+        }
+        if (0 == memcmp(app_bt_bonds[slot].keys.bd_addr, bd_addr, BD_ADDR_LEN))
+        {
+            return &app_bt_bonds[slot];
+        }
+        bucket = (uint8_t)((bucket + 1) & (APP_BT_BOND_INDEX_SIZE - 1));
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_build_index
+********************************************************************************
+* Summary:
+*   Rebuilds the address index after a bond is added or removed. Collisions
+*   go to the next free bucket.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_bond_build_index(void)
+{
+    uint8_t bucket;
+    uint8_t i;
+
+    memset(app_bt_bond_index, APP_BT_BOND_INDEX_EMPTY, sizeof(app_bt_bond_index));
+
+    for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+    {
+        if (!app_bt_bonds[i].in_use)
+        {
+            continue;
+        }
+
+        bucket = app_bt_bond_hash(app_bt_bonds[i].keys.bd_addr);
+        while (APP_BT_BOND_INDEX_EMPTY != app_bt_bond_index[bucket])
+        {
+            bucket = (uint8_t)((bucket + 1) & (APP_BT_BOND_INDEX_SIZE - 1));
+        }
+        app_bt_bond_index[bucket] = i;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_bond_save_list
+********************************************************************************
+* Summary:
+*   Stores the addresses of the bonded peers, ordered from the least to the
+*   most recently used, so that the bonds can be loaded after a reset.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_bond_save_list(void)
+{
+    uint8_t list[APP_BT_BOND_MAX_DEVICES * BD_ADDR_LEN];
+    app_bt_bond_t *p_next;
+    uint32_t after = 0;
+    uint8_t len = 0;
+    uint8_t i;
+
+    do
+    {
+        p_next = NULL;
+        for (i = 0; i < APP_BT_BOND_MAX_DEVICES; i++)
+        {
+            if (app_bt_bonds[i].in_use && (app_bt_bonds[i].last_used > after) &&
+                ((NULL == p_next) || (app_bt_bonds[i].last_used < p_next->last_used)))
+            {
+                p_next = &app_bt_bonds[i];
+            }
+        }
+
+        if (NULL != p_next)
+        {
+            memcpy(&list[len], p_next->keys.bd_addr, BD_ADDR_LEN);
+            len += BD_ADDR_LEN;
+            after = p_next->last_used;
+        }
+    } while (NULL != p_next);
+
+    if (0 == len)
+    {
+        (void)app_nv_delete(APP_NV_TYPE_BOND_LIST, app_bt_bond_no_addr);
+    }
+    else
+    {
+        (void)app_nv_write(APP_NV_TYPE_BOND_LIST, app_bt_bond_no_addr, list, len);
+    }
+}
+
+/* END OF FILE [] */
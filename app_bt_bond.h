@@ -0,0 +1,91 @@
+/******************************************************************************
+* File Name:   app_bt_bond.h
+*
+* Description: This file contains the declarations of the bond store that keeps the
+*              link keys of bonded peers and the local identity keys in flash.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_BOND_H__
+#define __APP_BT_BOND_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Maximum number of bonded peers. Bonding with one more peer replaces the
+ * bond used least recently */
+#ifndef APP_BT_BOND_MAX_DEVICES
+#define APP_BT_BOND_MAX_DEVICES         (4u)
+#endif
+
+/* Buckets of the address index, a power of two at least twice the number
+ * of bonds so that lookups rarely probe more than one bucket */
+#ifndef APP_BT_BOND_INDEX_SIZE
+#define APP_BT_BOND_INDEX_SIZE          (8u)
+#endif
+
+#if ((APP_BT_BOND_INDEX_SIZE & (APP_BT_BOND_INDEX_SIZE - 1)) != 0) || \
+    (APP_BT_BOND_INDEX_SIZE < (2 * APP_BT_BOND_MAX_DEVICES))
+#error "APP_BT_BOND_INDEX_SIZE must be a power of two of at least 2 * APP_BT_BOND_MAX_DEVICES"
+#endif
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_bond_init(void);
+
+void app_bt_bond_stack_enabled(void);
+
+wiced_bool_t app_bt_bond_save_keys(wiced_bt_device_link_keys_t *p_keys);
+
+wiced_bool_t app_bt_bond_load_keys(wiced_bt_device_link_keys_t *p_keys);
+
+wiced_bool_t app_bt_bond_is_bonded(const wiced_bt_device_address_t bd_addr);
+
+void app_bt_bond_remove(const wiced_bt_device_address_t bd_addr);
+
+uint8_t app_bt_bond_count(void);
+
+wiced_bool_t app_bt_bond_save_local_keys(wiced_bt_local_identity_keys_t *p_keys);
+
+wiced_bool_t app_bt_bond_load_local_keys(wiced_bt_local_identity_keys_t *p_keys);
+
+#endif      /* __APP_BT_BOND_H__ */
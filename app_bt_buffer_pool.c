@@ -0,0 +1,330 @@
+/******************************************************************************
+* File Name:   app_bt_buffer_pool.c
+*
+* Description: This file implements size-class pools of fixed-size blocks used for GATT
+*              response buffers. Allocation and release are O(1) free-list operations;
+*              the FreeRTOS heap is used only when the matching pools are exhausted.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_buffer_pool.h"
+#include "app_log.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Free blocks are chained through their first word */
+typedef struct app_bt_buffer_pool_block
+{
+    struct app_bt_buffer_pool_block *p_next;
+} app_bt_buffer_pool_block_t;
+
+/* Control block of one size class */
+typedef struct
+{
+    uint8_t                    *p_start;    /* First byte of the class storage */
+    uint8_t                    *p_end;      /* One past the last byte of the class storage */
+    app_bt_buffer_pool_block_t *p_free;     /* Head of the free list */
+    app_bt_buffer_pool_class_stats_t stats;
+} app_bt_buffer_pool_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+/* Block storage, kept as words so that every block is word aligned */
+static uint32_t app_bt_buffer_pool_small_mem[(APP_BT_BUFFER_POOL_SMALL_SIZE / 4u) * APP_BT_BUFFER_POOL_SMALL_COUNT];
+static uint32_t app_bt_buffer_pool_large_mem[(APP_BT_BUFFER_POOL_LARGE_SIZE / 4u) * APP_BT_BUFFER_POOL_LARGE_COUNT];
+
+/* Size classes in increasing block size order */
+static app_bt_buffer_pool_t app_bt_buffer_pools[APP_BT_BUFFER_POOL_NUM_CLASSES];
+
+static uint32_t app_bt_buffer_pool_heap_alloc_count = 0;
+static uint32_t app_bt_buffer_pool_heap_fail_count = 0;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static void app_bt_buffer_pool_setup(app_bt_buffer_pool_t *p_pool, uint32_t *p_mem,
+                                     uint16_t block_size, uint16_t block_count);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_buffer_pool_setup
+********************************************************************************
+* Summary:
+*   Carves the storage of one size class into blocks and chains them into its
+*   free list.
+*
+* Parameters:
+*   app_bt_buffer_pool_t *p_pool: Size class to set up
+*   uint32_t *p_mem             : Storage of the size class
+*   uint16_t block_size         : Size of each block, multiple of 4 bytes
+*   uint16_t block_count        : Number of blocks
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_buffer_pool_setup(app_bt_buffer_pool_t *p_pool, uint32_t *p_mem,
+                                     uint16_t block_size, uint16_t block_count)
+{
+    uint16_t i;
+    app_bt_buffer_pool_block_t *p_block;
+
+    memset(p_pool, 0, sizeof(*p_pool));
+    p_pool->p_start = (uint8_t *)p_mem;
+    p_pool->p_end = p_pool->p_start + ((uint32_t)block_size * block_count);
+    p_pool->stats.block_size = block_size;
+    p_pool->stats.block_count = block_count;
+
+    /* Chain the blocks so that the lowest address is handed out first */
+    for (i = block_count; i > 0; i--)
+    {
+        p_block = (app_bt_buffer_pool_block_t *)(p_pool->p_start + ((uint32_t)block_size * (i - 1u)));
+        p_block->p_next = p_pool->p_free;
+        p_pool->p_free = p_block;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_buffer_pool_init
+********************************************************************************
+* Summary:
+*   Initializes all the size classes. Must be called before the Bluetooth
+*   stack is started.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_buffer_pool_init(void)
+{
+    app_bt_buffer_pool_setup(&app_bt_buffer_pools[0], app_bt_buffer_pool_small_mem,
+                             APP_BT_BUFFER_POOL_SMALL_SIZE, APP_BT_BUFFER_POOL_SMALL_COUNT);
+    app_bt_buffer_pool_setup(&app_bt_buffer_pools[1], app_bt_buffer_pool_large_mem,
+                             APP_BT_BUFFER_POOL_LARGE_SIZE, APP_BT_BUFFER_POOL_LARGE_COUNT);
+
+    app_bt_buffer_pool_heap_alloc_count = 0;
+    app_bt_buffer_pool_heap_fail_count = 0;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_buffer_pool_alloc
+********************************************************************************
+* Summary:
+*   Allocates a buffer from the smallest size class that fits the requested
+*   length and still has a free block. Falls back to the FreeRTOS heap when
+*   no size class can serve the request.
+*
+* Parameters:
+*   uint16_t len: Number of bytes required
+*
+* Return:
+*   void*: Allocated buffer, or NULL if both the pools and the heap are exhausted
+*
+*******************************************************************************/
+void *app_bt_buffer_pool_alloc(uint16_t len)
+{
+    uint32_t i;
+    app_bt_buffer_pool_t *p_pool;
+    app_bt_buffer_pool_block_t *p_block = NULL;
+    void *p_buf;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < APP_BT_BUFFER_POOL_NUM_CLASSES; i++)
+    {
+        p_pool = &app_bt_buffer_pools[i];
+        if (len > p_pool->stats.block_size)
+        {
+            continue;
+        }
+
+        if (NULL == p_pool->p_free)
+        {
+            /* Try the next larger class before falling back to the heap */
+            p_pool->stats.exhausted_count++;
+            continue;
+        }
+
+        p_block = p_pool->p_free;
+        p_pool->p_free = p_block->p_next;
+        p_pool->stats.alloc_count++;
+        p_pool->stats.in_use++;
+        if (p_pool->stats.in_use > p_pool->stats.high_water)
+        {
+            p_pool->stats.high_water = p_pool->stats.in_use;
+        }
+        break;
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL != p_block)
+    {
+        return p_block;
+    }
+
+    p_buf = pvPortMalloc(len);
+
+    taskENTER_CRITICAL();
+    if (NULL != p_buf)
+    {
+        app_bt_buffer_pool_heap_alloc_count++;
+    }
+    else
+    {
+        app_bt_buffer_pool_heap_fail_count++;
+    }
+    taskEXIT_CRITICAL();
+
+    return p_buf;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_buffer_pool_free
+********************************************************************************
+* Summary:
+*   Returns a buffer obtained from app_bt_buffer_pool_alloc. The owning size
+*   class is found from the buffer address; buffers outside every class came
+*   from the heap and are released with vPortFree.
+*
+* Parameters:
+*   void *p_buf: Buffer to release, NULL is ignored
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_buffer_pool_free(void *p_buf)
+{
+    uint32_t i;
+    app_bt_buffer_pool_t *p_pool;
+    app_bt_buffer_pool_block_t *p_block;
+
+    if (NULL == p_buf)
+    {
+        return;
+    }
+
+    for (i = 0; i < APP_BT_BUFFER_POOL_NUM_CLASSES; i++)
+    {
+        p_pool = &app_bt_buffer_pools[i];
+        if (((uint8_t *)p_buf >= p_pool->p_start) && ((uint8_t *)p_buf < p_pool->p_end))
+        {
+            p_block = (app_bt_buffer_pool_block_t *)p_buf;
+
+            taskENTER_CRITICAL();
+            p_block->p_next = p_pool->p_free;
+            p_pool->p_free = p_block;
+            p_pool->stats.in_use--;
+            taskEXIT_CRITICAL();
+            return;
+        }
+    }
+
+    vPortFree(p_buf);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_buffer_pool_get_stats
+********************************************************************************
+* Summary:
+*   Takes a snapshot of the usage counters of all the pools.
+*
+* Parameters:
+*   app_bt_buffer_pool_stats_t *p_stats: Filled with the current counters
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_buffer_pool_get_stats(app_bt_buffer_pool_stats_t *p_stats)
+{
+    uint32_t i;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < APP_BT_BUFFER_POOL_NUM_CLASSES; i++)
+    {
+        p_stats->pool[i] = app_bt_buffer_pools[i].stats;
+    }
+    p_stats->heap_alloc_count = app_bt_buffer_pool_heap_alloc_count;
+    p_stats->heap_fail_count = app_bt_buffer_pool_heap_fail_count;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_buffer_pool_log_stats
+********************************************************************************
+* Summary:
+*   Writes the usage counters of all the pools to the deferred logger.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_buffer_pool_log_stats(void)
+{
+    uint32_t i;
+    app_bt_buffer_pool_stats_t stats;
+
+    app_bt_buffer_pool_get_stats(&stats);
+
+    for (i = 0; i < APP_BT_BUFFER_POOL_NUM_CLASSES; i++)
+    {
+        APP_LOG(APP_LOG_ID_BUF_POOL_STATS, i,
+                stats.pool[i].block_size,
+                stats.pool[i].in_use,
+                stats.pool[i].block_count,
+                stats.pool[i].high_water,
+                stats.pool[i].exhausted_count);
+    }
+    APP_LOG(APP_LOG_ID_BUF_POOL_HEAP_STATS, stats.heap_alloc_count, stats.heap_fail_count);
+}
+
+/* END OF FILE [] */
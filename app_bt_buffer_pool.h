@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name:   app_bt_buffer_pool.h
+*
+* Description: This file contains the declarations of the fixed-block buffer pools used
+*              for GATT response buffers.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_BUFFER_POOL_H__
+#define __APP_BT_BUFFER_POOL_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include <stdint.h>
+#include "GeneratedSource/cycfg_bt_settings.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Rounds a block size up to a multiple of 4 bytes so every block is word aligned */
+#define APP_BT_BUFFER_POOL_ALIGN(len)       ((((uint32_t)(len)) + 3u) & ~3u)
+
+/* Bytes a caller may keep in front of a full ATT_MTU payload in a large
+ * block, such as the connection ID that app_gatt_notify stores ahead of
+ * every notification */
+#define APP_BT_BUFFER_POOL_HEADROOM         (4u)
+
+/* Block sizes of the two size classes. The large class holds a full ATT_MTU
+ * response with its headroom, the small class holds short responses such as
+ * read-by-type hits */
+#ifndef APP_BT_BUFFER_POOL_SMALL_SIZE
+#define APP_BT_BUFFER_POOL_SMALL_SIZE       APP_BT_BUFFER_POOL_ALIGN((CY_BT_MTU_SIZE + 1u) / 2u)
+#endif
+#ifndef APP_BT_BUFFER_POOL_LARGE_SIZE
+#define APP_BT_BUFFER_POOL_LARGE_SIZE       APP_BT_BUFFER_POOL_ALIGN(CY_BT_MTU_SIZE + APP_BT_BUFFER_POOL_HEADROOM)
+#endif
+
+/* Number of blocks in each size class */
+#ifndef APP_BT_BUFFER_POOL_SMALL_COUNT
+#define APP_BT_BUFFER_POOL_SMALL_COUNT      (4u)
+#endif
+#ifndef APP_BT_BUFFER_POOL_LARGE_COUNT
+#define APP_BT_BUFFER_POOL_LARGE_COUNT      (4u)
+#endif
+
+/* Number of size classes */
+#define APP_BT_BUFFER_POOL_NUM_CLASSES      (2u)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Usage counters of one size class */
+typedef struct
+{
+    uint16_t block_size;        /* Size of each block in bytes */
+    uint16_t block_count;       /* Number of blocks in the class */
+    uint16_t in_use;            /* Blocks currently allocated */
+    uint16_t high_water;        /* Largest number of blocks ever allocated at once */
+    uint32_t alloc_count;       /* Successful allocations from this class */
+    uint32_t exhausted_count;   /* Requests that fitted this class but found it empty */
+} app_bt_buffer_pool_class_stats_t;
+
+/* Usage counters of all the pools */
+typedef struct
+{
+    app_bt_buffer_pool_class_stats_t pool[APP_BT_BUFFER_POOL_NUM_CLASSES];
+    uint32_t heap_alloc_count;  /* Requests served by pvPortMalloc */
+    uint32_t heap_fail_count;   /* Requests that could not be served at all */
+} app_bt_buffer_pool_stats_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_buffer_pool_init(void);
+
+void *app_bt_buffer_pool_alloc(uint16_t len);
+
+void app_bt_buffer_pool_free(void *p_buf);
+
+void app_bt_buffer_pool_get_stats(app_bt_buffer_pool_stats_t *p_stats);
+
+void app_bt_buffer_pool_log_stats(void);
+
+#endif      /* __APP_BT_BUFFER_POOL_H__ */
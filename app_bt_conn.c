@@ -0,0 +1,518 @@
+/******************************************************************************
+* File Name:   app_bt_conn.c
+*
+* Description: This file implements the fixed-capacity connection table keyed by the
+*              GATT connection ID. Each entry holds the state of one connected client.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_conn.h"
+#include "app_nv.h"
+#include "app_gatt_db_index.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Flash record of the CCCDs of a bonded peer: the number of tracked CCCDs,
+ * a hash of their handles and the hash of the GATT DB the client has
+ * discovered (2 bytes each, little endian), then the notification and
+ * indication bits of each CCCD packed two bits per descriptor. A record
+ * written for a different set of CCCDs, or for the same CCCDs at other
+ * handles after a GATT DB change, is ignored */
+#define APP_BT_CONN_CCCD_BITS           (2u)
+#define APP_BT_CONN_CCCD_MASK           (0x0003u)
+#define APP_BT_CONN_CCCD_HDR_LEN        (5u)
+#define APP_BT_CONN_CCCD_RECORD_LEN     (APP_BT_CONN_CCCD_HDR_LEN + \
+                                         (((APP_BT_CONN_NUM_CCCD * APP_BT_CONN_CCCD_BITS) + 7u) / 8u))
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static app_bt_conn_t app_bt_conn_table[APP_BT_MAX_CONNECTIONS];
+static uint8_t       app_bt_conn_num_links = 0;
+
+static const uint16_t app_bt_conn_cccd_handles[APP_BT_CONN_NUM_CCCD] = APP_BT_CONN_CCCD_HANDLES;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static uint16_t app_bt_conn_cccd_hash(void);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_conn_init
+********************************************************************************
+* Summary:
+*   Clears the connection table.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_init(void)
+{
+    memset(app_bt_conn_table, 0, sizeof(app_bt_conn_table));
+    app_bt_conn_num_links = 0;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_add
+********************************************************************************
+* Summary:
+*   Allocates a table entry for a new connection and initializes its state.
+*
+* Parameters:
+*   uint16_t conn_id                      : GATT connection ID
+*   wiced_bt_device_address_t bd_addr     : Address of the peer
+*   wiced_bt_ble_address_type_t addr_type : Address type of the peer
+*
+* Return:
+*   app_bt_conn_t*: New entry, or NULL if the table is full
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_add(uint16_t conn_id,
+                               wiced_bt_device_address_t bd_addr,
+                               wiced_bt_ble_address_type_t addr_type)
+{
+    uint8_t i;
+    app_bt_conn_t *p_conn;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        p_conn = &app_bt_conn_table[i];
+        if (p_conn->in_use)
+        {
+            continue;
+        }
+
+        memset(p_conn, 0, sizeof(*p_conn));
+        p_conn->in_use = WICED_TRUE;
+        p_conn->conn_id = conn_id;
+        memcpy(p_conn->bd_addr, bd_addr, sizeof(wiced_bt_device_address_t));
+        p_conn->addr_type = addr_type;
+        p_conn->mtu = GATT_DEF_BLE_MTU_SIZE;
+        p_conn->db_hash = app_gatt_db_index_get_hash();
+        p_conn->connect_time = xTaskGetTickCount();
+        p_conn->last_activity_time = p_conn->connect_time;
+        app_bt_conn_num_links++;
+
+        return p_conn;
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_remove
+********************************************************************************
+* Summary:
+*   Releases the table entry of a connection.
+*
+* Parameters:
+*   uint16_t conn_id: GATT connection ID
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_remove(uint16_t conn_id)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(conn_id);
+
+    if (NULL != p_conn)
+    {
+        p_conn->in_use = WICED_FALSE;
+        app_bt_conn_num_links--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_find
+********************************************************************************
+* Summary:
+*   Finds the table entry of a connection.
+*
+* Parameters:
+*   uint16_t conn_id: GATT connection ID
+*
+* Return:
+*   app_bt_conn_t*: Matching entry, or NULL if the connection is not in the table
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_find(uint16_t conn_id)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if ((app_bt_conn_table[i].in_use) && (conn_id == app_bt_conn_table[i].conn_id))
+        {
+            return &app_bt_conn_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_find_by_bda
+********************************************************************************
+* Summary:
+*   Finds the table entry of a connection by the address of the peer. Used for
+*   management events, which identify the link by address only.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*   app_bt_conn_t*: Matching entry, or NULL if the peer is not connected
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_find_by_bda(wiced_bt_device_address_t bd_addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if ((app_bt_conn_table[i].in_use) &&
+            (0 == memcmp(app_bt_conn_table[i].bd_addr, bd_addr, sizeof(wiced_bt_device_address_t))))
+        {
+            return &app_bt_conn_table[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_get
+********************************************************************************
+* Summary:
+*   Returns a table entry by position, used to iterate over the connections.
+*
+* Parameters:
+*   uint8_t index: Position in the table, 0 to APP_BT_MAX_CONNECTIONS - 1
+*
+* Return:
+*   app_bt_conn_t*: Entry at that position, or NULL if it is not in use
+*
+*******************************************************************************/
+app_bt_conn_t *app_bt_conn_get(uint8_t index)
+{
+    if ((index < APP_BT_MAX_CONNECTIONS) && (app_bt_conn_table[index].in_use))
+    {
+        return &app_bt_conn_table[index];
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_count
+********************************************************************************
+* Summary:
+*   Returns the number of connected clients.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint8_t: Number of entries in use
+*
+*******************************************************************************/
+uint8_t app_bt_conn_count(void)
+{
+    return app_bt_conn_num_links;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_has_free_slot
+********************************************************************************
+* Summary:
+*   Checks whether another client can be accepted.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the table has a free entry
+*
+*******************************************************************************/
+wiced_bool_t app_bt_conn_has_free_slot(void)
+{
+    return (app_bt_conn_num_links < APP_BT_MAX_CONNECTIONS) ? WICED_TRUE : WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_get_max_alert_level
+********************************************************************************
+* Summary:
+*   Aggregates the Immediate Alert Service alert levels of all connected
+*   clients. The highest level written by any client wins.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint8_t: Highest alert level across connections, 0 (no alert) when none
+*
+*******************************************************************************/
+uint8_t app_bt_conn_get_max_alert_level(void)
+{
+    uint8_t i;
+    uint8_t level = 0;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if ((app_bt_conn_table[i].in_use) && (app_bt_conn_table[i].alert_level > level))
+        {
+            level = app_bt_conn_table[i].alert_level;
+        }
+    }
+
+    return level;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_set_mtu
+********************************************************************************
+* Summary:
+*   Records the ATT_MTU agreed in the MTU exchange, which is the smaller of
+*   the client's MTU and APP_BT_MAX_MTU.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Connection entry
+*   uint16_t remote_mtu  : MTU sent by the client in the Exchange MTU request
+*
+* Return:
+*   uint16_t: Negotiated MTU
+*
+*******************************************************************************/
+uint16_t app_bt_conn_set_mtu(app_bt_conn_t *p_conn, uint16_t remote_mtu)
+{
+    uint16_t mtu = remote_mtu;
+
+    if (mtu > APP_BT_MAX_MTU)
+    {
+        mtu = APP_BT_MAX_MTU;
+    }
+    if (mtu < GATT_DEF_BLE_MTU_SIZE)
+    {
+        mtu = GATT_DEF_BLE_MTU_SIZE;
+    }
+    p_conn->mtu = mtu;
+
+    return mtu;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_get_max_rsp_len
+********************************************************************************
+* Summary:
+*   Limits the length of a response buffer to what fits in one ATT PDU on
+*   the connection, i.e. the negotiated MTU minus the opcode.
+*
+* Parameters:
+*   uint16_t conn_id: GATT connection ID
+*   uint16_t len    : Requested buffer length
+*
+* Return:
+*   uint16_t: Buffer length to allocate. len is returned unchanged if the
+*             connection is not in the table
+*
+*******************************************************************************/
+uint16_t app_bt_conn_get_max_rsp_len(uint16_t conn_id, uint16_t len)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(conn_id);
+
+    if ((NULL != p_conn) && (len > (p_conn->mtu - 1u)))
+    {
+        len = p_conn->mtu - 1u;
+    }
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_get_cccd
+********************************************************************************
+* Summary:
+*   Returns the per-connection storage of a Client Characteristic
+*   Configuration descriptor.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Connection entry
+*   uint16_t handle      : Attribute handle of the descriptor
+*
+* Return:
+*   uint16_t*: Stored descriptor value, or NULL if the handle is not a tracked CCCD
+*
+*******************************************************************************/
+uint16_t *app_bt_conn_get_cccd(app_bt_conn_t *p_conn, uint16_t handle)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_CONN_NUM_CCCD; i++)
+    {
+        if (handle == app_bt_conn_cccd_handles[i])
+        {
+            return &p_conn->cccd[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_save_cccd
+********************************************************************************
+* Summary:
+*   Stores the CCCD values of a bonded peer in flash so that they are restored
+*   when it reconnects. The values of peers without a bond only last for the
+*   connection, as required by the Core specification. Called after every
+*   CCCD write; the store skips values that did not change.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Connection entry
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_save_cccd(app_bt_conn_t *p_conn)
+{
+    uint8_t record[APP_BT_CONN_CCCD_RECORD_LEN] = { APP_BT_CONN_NUM_CCCD };
+    uint16_t hash = app_bt_conn_cccd_hash();
+    uint8_t bit;
+    uint8_t i;
+
+    if (!p_conn->bonded)
+    {
+        return;
+    }
+
+    record[1] = (uint8_t)(hash & 0xff);
+    record[2] = (uint8_t)(hash >> 8);
+    record[3] = (uint8_t)(p_conn->db_hash & 0xff);
+    record[4] = (uint8_t)(p_conn->db_hash >> 8);
+
+    for (i = 0; i < APP_BT_CONN_NUM_CCCD; i++)
+    {
+        bit = (uint8_t)(i * APP_BT_CONN_CCCD_BITS);
+        record[APP_BT_CONN_CCCD_HDR_LEN + (bit / 8)] |= (uint8_t)((p_conn->cccd[i] & APP_BT_CONN_CCCD_MASK) << (bit % 8));
+    }
+
+    (void)app_nv_write(APP_NV_TYPE_CCCD, p_conn->bd_addr, record, sizeof(record));
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_restore_cccd
+********************************************************************************
+* Summary:
+*   Restores the CCCD values stored for a bonded peer, so that the client does
+*   not have to write its descriptors again after reconnecting, and the hash
+*   of the GATT DB the client discovered before.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Connection entry
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if stored values were restored
+*
+*******************************************************************************/
+wiced_bool_t app_bt_conn_restore_cccd(app_bt_conn_t *p_conn)
+{
+    uint8_t record[APP_BT_CONN_CCCD_RECORD_LEN];
+    uint8_t bit;
+    uint8_t i;
+
+    if ((sizeof(record) != app_nv_read(APP_NV_TYPE_CCCD, p_conn->bd_addr, record, sizeof(record))) ||
+        (APP_BT_CONN_NUM_CCCD != record[0]) ||
+        (app_bt_conn_cccd_hash() != (uint16_t)(record[1] | (record[2] << 8))))
+    {
+        return WICED_FALSE;
+    }
+
+    p_conn->db_hash = (uint16_t)(record[3] | (record[4] << 8));
+    for (i = 0; i < APP_BT_CONN_NUM_CCCD; i++)
+    {
+        bit = (uint8_t)(i * APP_BT_CONN_CCCD_BITS);
+        p_conn->cccd[i] = (uint16_t)((record[APP_BT_CONN_CCCD_HDR_LEN + (bit / 8)] >> (bit % 8)) &
+                                     APP_BT_CONN_CCCD_MASK);
+    }
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_cccd_hash
+********************************************************************************
+* Summary:
+*   Hashes the handles of the tracked CCCDs, so that stored bits are only
+*   restored onto the descriptors they were written for.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint16_t: Hash of APP_BT_CONN_CCCD_HANDLES
+*
+*******************************************************************************/
+static uint16_t app_bt_conn_cccd_hash(void)
+{
+    uint16_t hash = 0;
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_CONN_NUM_CCCD; i++)
+    {
+        hash = (uint16_t)((hash * 31u) + app_bt_conn_cccd_handles[i]);
+    }
+
+    return hash;
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,139 @@
+/******************************************************************************
+* File Name:   app_bt_conn.h
+*
+* Description: This file contains the declarations of the connection table that holds
+*              the per-link state of every connected client.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_CONN_H__
+#define __APP_BT_CONN_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+#include "wiced_bt_gatt.h"
+#include "GeneratedSource/cycfg_bt_settings.h"
+#include "GeneratedSource/cycfg_gatt_db.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Maximum number of simultaneously connected clients. Follows the maximum
+ * number of connections configured in design.cybt */
+#ifndef APP_BT_MAX_CONNECTIONS
+#define APP_BT_MAX_CONNECTIONS          (CY_BT_CLIENT_MAX_LINKS)
+#endif
+
+/* Largest ATT_MTU offered to clients in the MTU exchange. The stack accepts
+ * up to CY_BT_MTU_SIZE (MtuSize in design.cybt) */
+#ifndef APP_BT_MAX_MTU
+#define APP_BT_MAX_MTU                  (CY_BT_MTU_SIZE)
+#endif
+
+#if (APP_BT_MAX_MTU > CY_BT_MTU_SIZE) || (APP_BT_MAX_MTU < GATT_DEF_BLE_MTU_SIZE)
+#error "APP_BT_MAX_MTU must be between GATT_DEF_BLE_MTU_SIZE and CY_BT_MTU_SIZE"
+#endif
+
+/* Client Characteristic Configuration descriptors tracked per connection */
+#define APP_BT_CONN_CCCD_HANDLES        { HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG }
+#define APP_BT_CONN_NUM_CCCD            (1u)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* State of one connected client */
+typedef struct
+{
+    wiced_bool_t                in_use;
+    uint16_t                    conn_id;
+    wiced_bt_device_address_t   bd_addr;
+    wiced_bt_ble_address_type_t addr_type;
+    wiced_bool_t                bonded;                         /* Link encrypted with a bond, CCCDs are kept in flash */
+    uint16_t                    mtu;                            /* Negotiated ATT_MTU */
+    uint8_t                     alert_level;                    /* Last IAS alert level written by this client */
+    uint16_t                    cccd[APP_BT_CONN_NUM_CCCD];     /* Values of the tracked CCCDs */
+    uint16_t                    db_hash;                        /* Hash of the GATT DB the client has discovered */
+    uint32_t                    connect_time;                   /* RTOS tick count at connection */
+    uint32_t                    last_activity_time;             /* RTOS tick count of the last ATT request */
+    uint8_t                     tx_phy;                         /* Current transmitter PHY, see app_bt_link.h */
+    uint8_t                     rx_phy;                         /* Current receiver PHY */
+    uint16_t                    max_tx_octets;                  /* Largest LL payload sent on the link */
+    uint16_t                    max_rx_octets;                  /* Largest LL payload received on the link */
+    uint16_t                    conn_interval;                  /* Connection interval, 1.25 ms units */
+    uint16_t                    conn_latency;                   /* Peripheral latency in connection events */
+    uint16_t                    supervision_timeout;            /* Supervision timeout, 10 ms units */
+    uint8_t                     param_regime;                   /* Parameter set, see app_bt_conn_param.h */
+    uint8_t                     param_window_requests;          /* ATT requests in the current traffic window */
+    uint32_t                    param_window_start;             /* RTOS tick count at the start of the window */
+    uint32_t                    param_regime_start;             /* RTOS tick count when the regime was entered */
+} app_bt_conn_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_conn_init(void);
+
+app_bt_conn_t *app_bt_conn_add(uint16_t conn_id,
+                               wiced_bt_device_address_t bd_addr,
+                               wiced_bt_ble_address_type_t addr_type);
+
+void app_bt_conn_remove(uint16_t conn_id);
+
+app_bt_conn_t *app_bt_conn_find(uint16_t conn_id);
+
+app_bt_conn_t *app_bt_conn_find_by_bda(wiced_bt_device_address_t bd_addr);
+
+app_bt_conn_t *app_bt_conn_get(uint8_t index);
+
+uint8_t app_bt_conn_count(void);
+
+wiced_bool_t app_bt_conn_has_free_slot(void);
+
+uint8_t app_bt_conn_get_max_alert_level(void);
+
+uint16_t app_bt_conn_set_mtu(app_bt_conn_t *p_conn, uint16_t remote_mtu);
+
+uint16_t app_bt_conn_get_max_rsp_len(uint16_t conn_id, uint16_t len);
+
+uint16_t *app_bt_conn_get_cccd(app_bt_conn_t *p_conn, uint16_t handle);
+
+void app_bt_conn_save_cccd(app_bt_conn_t *p_conn);
+
+wiced_bool_t app_bt_conn_restore_cccd(app_bt_conn_t *p_conn);
+
+#endif      /* __APP_BT_CONN_H__ */
@@ -0,0 +1,382 @@
+/******************************************************************************
+* File Name:   app_bt_conn_param.c
+*
+* Description: This file implements the connection parameter policy. Every ATT request
+*              is counted per link; a burst of requests moves the link to a short
+*              connection interval for low response latency and a quiet period moves
+*              it to a long interval with peripheral latency to save radio power.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_conn_param.h"
+#include "app_log.h"
+#include "wiced_bt_l2c.h"
+#include "wiced_timer.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Connection parameters requested for a regime */
+typedef struct
+{
+    uint16_t min_interval;
+    uint16_t max_interval;
+    uint16_t latency;
+    uint16_t timeout;
+} app_bt_conn_param_set_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static const app_bt_conn_param_set_t app_bt_conn_param_sets[APP_BT_CONN_PARAM_NUM_REGIMES] =
+{
+    [APP_BT_CONN_PARAM_REGIME_ACTIVE] =
+    {
+        APP_BT_CONN_PARAM_ACTIVE_MIN_INTERVAL, APP_BT_CONN_PARAM_ACTIVE_MAX_INTERVAL,
+        APP_BT_CONN_PARAM_ACTIVE_LATENCY, APP_BT_CONN_PARAM_ACTIVE_TIMEOUT
+    },
+    [APP_BT_CONN_PARAM_REGIME_IDLE] =
+    {
+        APP_BT_CONN_PARAM_IDLE_MIN_INTERVAL, APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL,
+        APP_BT_CONN_PARAM_IDLE_LATENCY, APP_BT_CONN_PARAM_IDLE_TIMEOUT
+    },
+};
+
+static app_bt_conn_param_stats_t app_bt_conn_param_stats;
+static wiced_timer_t             app_bt_conn_param_timer;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static void app_bt_conn_param_timer_cb(WICED_TIMER_PARAM_TYPE arg);
+static void app_bt_conn_param_request(app_bt_conn_t *p_conn, app_bt_conn_param_regime_t regime);
+static void app_bt_conn_param_account_time(app_bt_conn_t *p_conn, uint32_t now);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_conn_param_init
+********************************************************************************
+* Summary:
+*   Clears the counters and creates the idle check timer. Must be called from
+*   the BT stack context after BTM_ENABLED_EVT.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_init(void)
+{
+    memset(&app_bt_conn_param_stats, 0, sizeof(app_bt_conn_param_stats));
+    wiced_init_timer(&app_bt_conn_param_timer, app_bt_conn_param_timer_cb, 0,
+                     WICED_MILLI_SECONDS_PERIODIC_TIMER);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_start
+********************************************************************************
+* Summary:
+*   Starts the policy on a new connection. The link keeps the parameters chosen
+*   by the central until it becomes active or idle.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Entry of the new connection
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_start(app_bt_conn_t *p_conn)
+{
+    uint32_t now = xTaskGetTickCount();
+
+    p_conn->param_regime = APP_BT_CONN_PARAM_REGIME_DEFAULT;
+    p_conn->param_regime_start = now;
+    p_conn->param_window_start = now;
+    p_conn->param_window_requests = 0;
+
+    if (!wiced_is_timer_in_use(&app_bt_conn_param_timer))
+    {
+        wiced_start_timer(&app_bt_conn_param_timer, APP_BT_CONN_PARAM_POLL_MS);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_stop
+********************************************************************************
+* Summary:
+*   Closes the time accounting of a connection that is going away.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Entry of the disconnected link
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_stop(app_bt_conn_t *p_conn)
+{
+    app_bt_conn_param_account_time(p_conn, xTaskGetTickCount());
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_on_traffic
+********************************************************************************
+* Summary:
+*   Counts one ATT request on the link and moves the link to the active
+*   regime right away when the request rate reaches the threshold.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Entry of the link that received the request
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_on_traffic(app_bt_conn_t *p_conn)
+{
+    uint32_t now = xTaskGetTickCount();
+
+    if ((now - p_conn->param_window_start) >= pdMS_TO_TICKS(APP_BT_CONN_PARAM_WINDOW_MS))
+    {
+        p_conn->param_window_start = now;
+        p_conn->param_window_requests = 0;
+    }
+
+    if (p_conn->param_window_requests < UINT8_MAX)
+    {
+        p_conn->param_window_requests++;
+    }
+
+    if ((APP_BT_CONN_PARAM_REGIME_ACTIVE != p_conn->param_regime) &&
+        (p_conn->param_window_requests >= APP_BT_CONN_PARAM_ACTIVE_THRESHOLD))
+    {
+        app_bt_conn_param_request(p_conn, APP_BT_CONN_PARAM_REGIME_ACTIVE);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_update
+********************************************************************************
+* Summary:
+*   Records the parameters in use after a connection parameter update and
+*   counts it against the regime of the link.
+*
+* Parameters:
+*   wiced_bt_ble_connection_param_update_t *p_update: Update event data
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_update(wiced_bt_ble_connection_param_update_t *p_update)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find_by_bda(p_update->bd_addr);
+    app_bt_conn_param_regime_stats_t *p_stats;
+
+    if (NULL == p_conn)
+    {
+        return;
+    }
+
+    p_stats = &app_bt_conn_param_stats.regime[p_conn->param_regime];
+    if (WICED_BT_SUCCESS == p_update->status)
+    {
+        p_conn->conn_interval = p_update->conn_interval;
+        p_conn->conn_latency = p_update->conn_latency;
+        p_conn->supervision_timeout = p_update->supervision_timeout;
+        p_stats->accept_count++;
+    }
+    else
+    {
+        p_stats->reject_count++;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_get_stats
+********************************************************************************
+* Summary:
+*   Returns a copy of the regime counters.
+*
+* Parameters:
+*   app_bt_conn_param_stats_t *p_stats: Destination of the copy
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_get_stats(app_bt_conn_param_stats_t *p_stats)
+{
+    *p_stats = app_bt_conn_param_stats;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_log_stats
+********************************************************************************
+* Summary:
+*   Prints the regime counters.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_conn_param_log_stats(void)
+{
+    uint8_t i;
+    app_bt_conn_param_regime_stats_t *p_stats;
+
+    for (i = 0; i < APP_BT_CONN_PARAM_NUM_REGIMES; i++)
+    {
+        p_stats = &app_bt_conn_param_stats.regime[i];
+        APP_LOG(APP_LOG_ID_CONN_PARAM_STATS, i, p_stats->request_count, p_stats->fail_count,
+                p_stats->accept_count, p_stats->reject_count, p_stats->time_ms);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_timer_cb
+********************************************************************************
+* Summary:
+*   Moves links without recent ATT traffic to the idle regime. The timer stops
+*   itself once no client is connected.
+*
+* Parameters:
+*   WICED_TIMER_PARAM_TYPE arg: Unused
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_conn_param_timer_cb(WICED_TIMER_PARAM_TYPE arg)
+{
+    uint8_t i;
+    app_bt_conn_t *p_conn;
+    uint32_t now = xTaskGetTickCount();
+
+    (void)arg;
+
+    if (0 == app_bt_conn_count())
+    {
+        wiced_stop_timer(&app_bt_conn_param_timer);
+        return;
+    }
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        p_conn = app_bt_conn_get(i);
+        if ((NULL != p_conn) &&
+            (APP_BT_CONN_PARAM_REGIME_IDLE != p_conn->param_regime) &&
+            ((now - p_conn->last_activity_time) >= pdMS_TO_TICKS(APP_BT_CONN_PARAM_IDLE_TIME_MS)))
+        {
+            app_bt_conn_param_request(p_conn, APP_BT_CONN_PARAM_REGIME_IDLE);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_request
+********************************************************************************
+* Summary:
+*   Asks the central for the parameters of a regime through the L2CAP
+*   connection parameter update procedure. The link is moved to the regime
+*   even if the request cannot be sent, so that it is not repeated on every
+*   request; the next regime change tries again.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn            : Entry of the link
+*   app_bt_conn_param_regime_t regime: Regime to move to
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_conn_param_request(app_bt_conn_t *p_conn, app_bt_conn_param_regime_t regime)
+{
+    const app_bt_conn_param_set_t *p_set = &app_bt_conn_param_sets[regime];
+    app_bt_conn_param_regime_stats_t *p_stats = &app_bt_conn_param_stats.regime[regime];
+
+    app_bt_conn_param_account_time(p_conn, xTaskGetTickCount());
+    p_conn->param_regime = regime;
+    p_stats->request_count++;
+
+    APP_LOG(APP_LOG_ID_CONN_PARAM_REQUEST, p_conn->conn_id, regime,
+            p_set->min_interval, p_set->max_interval, p_set->latency, p_set->timeout);
+
+    if (!wiced_bt_l2cap_update_ble_conn_params(p_conn->bd_addr, p_set->min_interval,
+                                               p_set->max_interval, p_set->latency,
+                                               p_set->timeout))
+    {
+        p_stats->fail_count++;
+        APP_LOG(APP_LOG_ID_CONN_PARAM_REQUEST_FAILED, p_conn->conn_id);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_conn_param_account_time
+********************************************************************************
+* Summary:
+*   Adds the time spent in the current regime to its counter.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Entry of the link
+*   uint32_t now         : Current RTOS tick count
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_bt_conn_param_account_time(app_bt_conn_t *p_conn, uint32_t now)
+{
+    app_bt_conn_param_stats.regime[p_conn->param_regime].time_ms +=
+        (now - p_conn->param_regime_start) * portTICK_PERIOD_MS;
+    p_conn->param_regime_start = now;
+}
+
+/* END OF FILE [] */
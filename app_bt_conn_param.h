@@ -0,0 +1,147 @@
+/******************************************************************************
+* File Name:   app_bt_conn_param.h
+*
+* Description: This file contains the declarations of the connection parameter policy
+*              that switches each link between a short interval while ATT traffic is
+*              active and a long interval with peripheral latency while it is idle.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_CONN_PARAM_H__
+#define __APP_BT_CONN_PARAM_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_ble.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Parameters requested while ATT traffic is active. Intervals are in
+ * 1.25 ms units, the supervision timeout in 10 ms units */
+#ifndef APP_BT_CONN_PARAM_ACTIVE_MIN_INTERVAL
+#define APP_BT_CONN_PARAM_ACTIVE_MIN_INTERVAL   (6u)        /* 7.5 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_ACTIVE_MAX_INTERVAL
+#define APP_BT_CONN_PARAM_ACTIVE_MAX_INTERVAL   (12u)       /* 15 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_ACTIVE_LATENCY
+#define APP_BT_CONN_PARAM_ACTIVE_LATENCY        (0u)
+#endif
+#ifndef APP_BT_CONN_PARAM_ACTIVE_TIMEOUT
+#define APP_BT_CONN_PARAM_ACTIVE_TIMEOUT        (200u)      /* 2 s */
+#endif
+
+/* Parameters requested once the link is idle */
+#ifndef APP_BT_CONN_PARAM_IDLE_MIN_INTERVAL
+#define APP_BT_CONN_PARAM_IDLE_MIN_INTERVAL     (320u)      /* 400 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL
+#define APP_BT_CONN_PARAM_IDLE_MAX_INTERVAL     (400u)      /* 500 ms */
+#endif
+#ifndef APP_BT_CONN_PARAM_IDLE_LATENCY
+#define APP_BT_CONN_PARAM_IDLE_LATENCY          (4u)
+#endif
+#ifndef APP_BT_CONN_PARAM_IDLE_TIMEOUT
+#define APP_BT_CONN_PARAM_IDLE_TIMEOUT          (600u)      /* 6 s */
+#endif
+
+/* A link is active once it carries this many ATT requests within one window */
+#ifndef APP_BT_CONN_PARAM_ACTIVE_THRESHOLD
+#define APP_BT_CONN_PARAM_ACTIVE_THRESHOLD      (4u)
+#endif
+#ifndef APP_BT_CONN_PARAM_WINDOW_MS
+#define APP_BT_CONN_PARAM_WINDOW_MS             (1000u)
+#endif
+
+/* A link is idle after this long without ATT requests */
+#ifndef APP_BT_CONN_PARAM_IDLE_TIME_MS
+#define APP_BT_CONN_PARAM_IDLE_TIME_MS          (5000u)
+#endif
+
+/* Period of the idle check */
+#ifndef APP_BT_CONN_PARAM_POLL_MS
+#define APP_BT_CONN_PARAM_POLL_MS               (1000u)
+#endif
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Parameter sets a link can be in */
+typedef enum
+{
+    APP_BT_CONN_PARAM_REGIME_DEFAULT,   /* Parameters chosen by the central */
+    APP_BT_CONN_PARAM_REGIME_ACTIVE,
+    APP_BT_CONN_PARAM_REGIME_IDLE,
+    APP_BT_CONN_PARAM_NUM_REGIMES
+} app_bt_conn_param_regime_t;
+
+/* Usage counters of one regime */
+typedef struct
+{
+    uint32_t request_count;     /* Updates requested from the central */
+    uint32_t fail_count;        /* Requests the stack could not send */
+    uint32_t accept_count;      /* Successful updates while in this regime */
+    uint32_t reject_count;      /* Failed updates while in this regime */
+    uint32_t time_ms;           /* Time links spent in this regime */
+} app_bt_conn_param_regime_stats_t;
+
+/* Usage counters of all regimes */
+typedef struct
+{
+    app_bt_conn_param_regime_stats_t regime[APP_BT_CONN_PARAM_NUM_REGIMES];
+} app_bt_conn_param_stats_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_conn_param_init(void);
+
+void app_bt_conn_param_start(app_bt_conn_t *p_conn);
+
+void app_bt_conn_param_stop(app_bt_conn_t *p_conn);
+
+void app_bt_conn_param_on_traffic(app_bt_conn_t *p_conn);
+
+void app_bt_conn_param_update(wiced_bt_ble_connection_param_update_t *p_update);
+
+void app_bt_conn_param_get_stats(app_bt_conn_param_stats_t *p_stats);
+
+void app_bt_conn_param_log_stats(void);
+
+#endif      /* __APP_BT_CONN_PARAM_H__ */
@@ -0,0 +1,488 @@
+/******************************************************************************
+* File Name:   app_bt_ext_adv.c
+*
+* Description: This file implements the extended advertising sets. The Find Me set
+*              uses legacy connectable PDUs so that every phone can discover it and
+*              follows the advertising scheduler; the beacon set advertises without
+*              connections on the secondary channels next to it.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_ext_adv.h"
+
+#ifdef APP_BT_EXT_ADV
+
+#include "app_log.h"
+#include "GeneratedSource/cycfg_gap.h"
+#include <string.h>
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+#define APP_BT_EXT_ADV_ALL_CHANNELS     (BTM_BLE_ADVERT_CHNL_37 | BTM_BLE_ADVERT_CHNL_38 | \
+                                         BTM_BLE_ADVERT_CHNL_39)
+
+/* Advertising SIDs, distinct per set so that scanners keep them apart */
+#define APP_BT_EXT_ADV_SID_FINDME       (0u)
+#define APP_BT_EXT_ADV_SID_BEACON       (1u)
+
+/* Let the controller choose the TX power */
+#define APP_BT_EXT_ADV_TX_POWER_ANY     (127)
+
+/* Company identifier of the beacon manufacturer data (Cypress Semiconductor) */
+#define APP_BT_EXT_ADV_COMPANY_ID       (0x0131u)
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+/* Default beacon payload: flags and manufacturer data with the company
+ * identifier followed by an application defined beacon ID */
+static const uint8_t app_bt_ext_adv_beacon_default[] =
+{
+    0x02, BTM_BLE_ADVERT_TYPE_FLAG, BTM_BLE_BREDR_NOT_SUPPORTED,
+    0x05, BTM_BLE_ADVERT_TYPE_MANUFACTURER,
+    (uint8_t)(APP_BT_EXT_ADV_COMPANY_ID & 0xff), (uint8_t)(APP_BT_EXT_ADV_COMPANY_ID >> 8),
+    0x46, 0x4D,     /* Beacon ID "FM" */
+};
+
+static uint8_t                    app_bt_ext_adv_findme_data[APP_BT_EXT_ADV_FINDME_MAX_LEN];
+static uint16_t                   app_bt_ext_adv_findme_len;
+static wiced_bool_t               app_bt_ext_adv_findme_has_data;  /* Set uses undirected PDUs and holds the data */
+static uint8_t                    app_bt_ext_adv_beacon_data[APP_BT_EXT_ADV_BEACON_MAX_LEN];
+static wiced_bt_ble_advert_mode_t app_bt_ext_adv_findme_mode = BTM_BLE_ADVERT_OFF;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static wiced_result_t app_bt_ext_adv_enable(wiced_bt_ble_ext_adv_handle_t handle, wiced_bool_t enable);
+static wiced_result_t app_bt_ext_adv_findme_params(wiced_bt_ble_ext_adv_event_property_t properties,
+                                                   wiced_bt_ble_ext_adv_interval_t interval,
+                                                   wiced_bt_ble_address_type_t peer_addr_type,
+                                                   wiced_bt_device_address_t peer_addr);
+static wiced_result_t app_bt_ext_adv_write_findme_data(void);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_init
+********************************************************************************
+* Summary:
+*   Configures both advertising sets and starts the beacon set. The Find Me
+*   set is created with undirected parameters, then given the advertising
+*   data generated in cycfg_gap.c; it is started by the advertising scheduler.
+*   The beacon uses extended PDUs: only the short ADV_EXT_IND header is sent
+*   on the primary channels, the payload follows on a secondary channel at
+*   2M PHY, so the beacon takes little primary channel air time from the
+*   Find Me set that phones scan for.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS if both sets are configured
+*
+*******************************************************************************/
+wiced_result_t app_bt_ext_adv_init(void)
+{
+    wiced_bt_device_address_t no_peer = { 0 };
+    wiced_result_t result;
+
+    /* The controller only takes data for a set that exists */
+    result = app_bt_ext_adv_findme_params(WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV |
+                                          WICED_BT_BLE_EXT_ADV_EVENT_SCANNABLE_ADV |
+                                          WICED_BT_BLE_EXT_ADV_EVENT_LEGACY_ADV,
+                                          APP_BT_EXT_ADV_SLOW_INTERVAL, BLE_ADDR_PUBLIC, no_peer);
+    if (WICED_BT_SUCCESS != result)
+    {
+        return result;
+    }
+    app_bt_ext_adv_findme_has_data = WICED_TRUE;
+
+    result = app_bt_ext_adv_set_findme_data(CY_BT_ADV_PACKET_DATA_SIZE, cy_bt_adv_packet_data);
+    if (WICED_BT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = wiced_bt_ble_set_ext_adv_parameters(APP_BT_EXT_ADV_SET_BEACON,
+                                                 WICED_BT_BLE_EXT_ADV_EVENT_NON_CONN_NON_SCAN_UNDIRECTED,
+                                                 APP_BT_EXT_ADV_BEACON_INTERVAL,
+                                                 APP_BT_EXT_ADV_BEACON_INTERVAL,
+                                                 APP_BT_EXT_ADV_ALL_CHANNELS,
+                                                 BLE_ADDR_PUBLIC, BLE_ADDR_PUBLIC, no_peer,
+                                                 BTM_BLE_ADV_POLICY_ACCEPT_CONN_AND_SCAN,
+                                                 APP_BT_EXT_ADV_TX_POWER_ANY,
+                                                 WICED_BT_BLE_EXT_ADV_PHY_1M, 0,
+                                                 WICED_BT_BLE_EXT_ADV_PHY_2M,
+                                                 APP_BT_EXT_ADV_SID_BEACON,
+                                                 WICED_BT_BLE_EXT_ADV_SCAN_REQ_NOTIFY_DISABLE);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_EXT_ADV_FAILED, APP_BT_EXT_ADV_SET_BEACON, result);
+        return result;
+    }
+
+    result = app_bt_ext_adv_set_beacon_data(app_bt_ext_adv_beacon_default,
+                                            sizeof(app_bt_ext_adv_beacon_default));
+    if (WICED_BT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    return app_bt_ext_adv_enable(APP_BT_EXT_ADV_SET_BEACON, WICED_TRUE);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_set_findme
+********************************************************************************
+* Summary:
+*   Runs the Find Me set in the mode chosen by the advertising scheduler. The
+*   legacy advertising modes are mapped to legacy PDUs of the set: high and
+*   low duty undirected use the fast and slow intervals, the directed modes
+*   address the given peer. The set is stopped while its parameters change.
+*   Legacy directed PDUs carry no advertising data, so the data is removed
+*   from the set before it turns directed and written again when it returns
+*   to undirected advertising.
+*
+* Parameters:
+*   wiced_bt_ble_advert_mode_t mode            : Advertising mode, BTM_BLE_ADVERT_OFF to stop
+*   wiced_bt_ble_address_type_t peer_addr_type : Address type of the peer of directed modes
+*   wiced_bt_device_address_t peer_addr        : Peer of directed modes, NULL otherwise
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS if the set runs in the mode
+*
+*******************************************************************************/
+wiced_result_t app_bt_ext_adv_set_findme(wiced_bt_ble_advert_mode_t mode,
+                                         wiced_bt_ble_address_type_t peer_addr_type,
+                                         wiced_bt_device_address_t peer_addr)
+{
+    wiced_bt_device_address_t no_peer = { 0 };
+    wiced_bt_ble_ext_adv_event_property_t properties;
+    wiced_bt_ble_ext_adv_interval_t interval;
+    wiced_bool_t directed = WICED_TRUE;
+    wiced_result_t result;
+
+    if (BTM_BLE_ADVERT_OFF != app_bt_ext_adv_findme_mode)
+    {
+        (void)app_bt_ext_adv_enable(APP_BT_EXT_ADV_SET_FINDME, WICED_FALSE);
+        app_bt_ext_adv_findme_mode = BTM_BLE_ADVERT_OFF;
+    }
+
+    switch (mode)
+    {
+        case BTM_BLE_ADVERT_UNDIRECTED_HIGH:
+        case BTM_BLE_ADVERT_UNDIRECTED_LOW:
+            properties = WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV | WICED_BT_BLE_EXT_ADV_EVENT_SCANNABLE_ADV |
+                         WICED_BT_BLE_EXT_ADV_EVENT_LEGACY_ADV;
+            interval = (BTM_BLE_ADVERT_UNDIRECTED_HIGH == mode) ? APP_BT_EXT_ADV_FAST_INTERVAL :
+                                                                 APP_BT_EXT_ADV_SLOW_INTERVAL;
+            peer_addr_type = BLE_ADDR_PUBLIC;
+            peer_addr = no_peer;
+            directed = WICED_FALSE;
+            break;
+
+        case BTM_BLE_ADVERT_DIRECTED_HIGH:
+            properties = WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV | WICED_BT_BLE_EXT_ADV_EVENT_DIRECTED_ADV |
+                         WICED_BT_BLE_EXT_ADV_EVENT_HIGH_DUTY_DIRECTED_CONNECTABLE_ADV |
+                         WICED_BT_BLE_EXT_ADV_EVENT_LEGACY_ADV;
+            interval = APP_BT_EXT_ADV_FAST_INTERVAL;
+            break;
+
+        case BTM_BLE_ADVERT_DIRECTED_LOW:
+            properties = WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV | WICED_BT_BLE_EXT_ADV_EVENT_DIRECTED_ADV |
+                         WICED_BT_BLE_EXT_ADV_EVENT_LEGACY_ADV;
+            interval = APP_BT_EXT_ADV_FAST_INTERVAL;
+            break;
+
+        default:
+            return WICED_BT_SUCCESS;
+    }
+
+    /* Legacy directed PDUs carry no data: empty the set before it turns directed */
+    if (directed && app_bt_ext_adv_findme_has_data)
+    {
+        result = wiced_bt_ble_set_ext_adv_data(APP_BT_EXT_ADV_SET_FINDME, 0, app_bt_ext_adv_findme_data);
+        if (WICED_BT_SUCCESS != result)
+        {
+            APP_LOG(APP_LOG_ID_EXT_ADV_FAILED, APP_BT_EXT_ADV_SET_FINDME, result);
+            return result;
+        }
+        app_bt_ext_adv_findme_has_data = WICED_FALSE;
+    }
+
+    result = app_bt_ext_adv_findme_params(properties, interval, peer_addr_type, peer_addr);
+
+    /* Back to undirected PDUs: restore the data */
+    if ((WICED_BT_SUCCESS == result) && !directed && !app_bt_ext_adv_findme_has_data)
+    {
+        app_bt_ext_adv_findme_has_data = WICED_TRUE;
+        result = app_bt_ext_adv_write_findme_data();
+    }
+
+    if (WICED_BT_SUCCESS == result)
+    {
+        result = app_bt_ext_adv_enable(APP_BT_EXT_ADV_SET_FINDME, WICED_TRUE);
+    }
+
+    if (WICED_BT_SUCCESS == result)
+    {
+        app_bt_ext_adv_findme_mode = mode;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_get_findme_mode
+********************************************************************************
+* Summary:
+*   Returns the mode the Find Me set runs in.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bt_ble_advert_mode_t: Mode, BTM_BLE_ADVERT_OFF if the set is stopped
+*
+*******************************************************************************/
+wiced_bt_ble_advert_mode_t app_bt_ext_adv_get_findme_mode(void)
+{
+    return app_bt_ext_adv_findme_mode;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_findme_stopped
+********************************************************************************
+* Summary:
+*   Records that the controller ended the Find Me set because a client
+*   connected to it. The beacon set keeps running.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_ext_adv_findme_stopped(void)
+{
+    app_bt_ext_adv_findme_mode = BTM_BLE_ADVERT_OFF;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_set_findme_data
+********************************************************************************
+* Summary:
+*   Sets the advertising data of the Find Me set from the same elements as
+*   wiced_bt_ble_set_raw_advertisement_data. The set uses legacy PDUs, so the
+*   data is limited to 31 bytes. During directed advertising the data is
+*   kept until the set returns to undirected advertising.
+*
+* Parameters:
+*   uint8_t num_elem                         : Number of elements
+*   const wiced_bt_ble_advert_elem_t *p_elems: AD elements
+*
+* Return:
+*   wiced_result_t: Result of wiced_bt_ble_set_ext_adv_data
+*
+*******************************************************************************/
+wiced_result_t app_bt_ext_adv_set_findme_data(uint8_t num_elem, const wiced_bt_ble_advert_elem_t *p_elems)
+{
+    uint16_t len = 0;
+    uint8_t i;
+
+    for (i = 0; i < num_elem; i++)
+    {
+        if (((uint32_t)len + 2u + p_elems[i].len) > APP_BT_EXT_ADV_FINDME_MAX_LEN)
+        {
+            return WICED_BT_BADARG;
+        }
+
+        app_bt_ext_adv_findme_data[len++] = (uint8_t)(p_elems[i].len + 1);
+        app_bt_ext_adv_findme_data[len++] = p_elems[i].advert_type;
+        memcpy(&app_bt_ext_adv_findme_data[len], p_elems[i].p_data, p_elems[i].len);
+        len += p_elems[i].len;
+    }
+    app_bt_ext_adv_findme_len = len;
+
+    if (!app_bt_ext_adv_findme_has_data)
+    {
+        return WICED_BT_SUCCESS;
+    }
+
+    return app_bt_ext_adv_write_findme_data();
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_set_beacon_data
+********************************************************************************
+* Summary:
+*   Sets the payload of the beacon set. The payload is copied, the controller
+*   reads it again whenever the set is reconfigured.
+*
+* Parameters:
+*   const uint8_t *p_data : AD structures
+*   uint16_t len          : Length of the data, at most APP_BT_EXT_ADV_BEACON_MAX_LEN
+*
+* Return:
+*   wiced_result_t: Result of wiced_bt_ble_set_ext_adv_data
+*
+*******************************************************************************/
+wiced_result_t app_bt_ext_adv_set_beacon_data(const uint8_t *p_data, uint16_t len)
+{
+    wiced_result_t result;
+
+    if (len > APP_BT_EXT_ADV_BEACON_MAX_LEN)
+    {
+        return WICED_BT_BADARG;
+    }
+
+    memcpy(app_bt_ext_adv_beacon_data, p_data, len);
+    result = wiced_bt_ble_set_ext_adv_data(APP_BT_EXT_ADV_SET_BEACON, len, app_bt_ext_adv_beacon_data);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_EXT_ADV_FAILED, APP_BT_EXT_ADV_SET_BEACON, result);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_enable
+********************************************************************************
+* Summary:
+*   Starts or stops one advertising set, without duration or event limits.
+*
+* Parameters:
+*   wiced_bt_ble_ext_adv_handle_t handle : Advertising set
+*   wiced_bool_t enable                  : WICED_TRUE to start the set
+*
+* Return:
+*   wiced_result_t: Result of wiced_bt_ble_start_ext_adv
+*
+*******************************************************************************/
+static wiced_result_t app_bt_ext_adv_enable(wiced_bt_ble_ext_adv_handle_t handle, wiced_bool_t enable)
+{
+    wiced_bt_ble_ext_adv_duration_config_t duration = { handle, 0, 0 };
+    wiced_result_t result;
+
+    result = wiced_bt_ble_start_ext_adv(enable ? 1 : 0, 1, &duration);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_EXT_ADV_FAILED, handle, result);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_findme_params
+********************************************************************************
+* Summary:
+*   Sets the parameters of the Find Me set, which creates the set the first
+*   time.
+*
+* Parameters:
+*   wiced_bt_ble_ext_adv_event_property_t properties : Event properties, legacy PDUs
+*   wiced_bt_ble_ext_adv_interval_t interval         : Primary advertising interval
+*   wiced_bt_ble_address_type_t peer_addr_type       : Address type of the peer of directed modes
+*   wiced_bt_device_address_t peer_addr              : Peer of directed modes
+*
+* Return:
+*   wiced_result_t: Result of wiced_bt_ble_set_ext_adv_parameters
+*
+*******************************************************************************/
+static wiced_result_t app_bt_ext_adv_findme_params(wiced_bt_ble_ext_adv_event_property_t properties,
+                                                   wiced_bt_ble_ext_adv_interval_t interval,
+                                                   wiced_bt_ble_address_type_t peer_addr_type,
+                                                   wiced_bt_device_address_t peer_addr)
+{
+    wiced_result_t result;
+
+    result = wiced_bt_ble_set_ext_adv_parameters(APP_BT_EXT_ADV_SET_FINDME, properties, interval, interval,
+                                                 APP_BT_EXT_ADV_ALL_CHANNELS, BLE_ADDR_PUBLIC,
+                                                 peer_addr_type, peer_addr,
+                                                 BTM_BLE_ADV_POLICY_ACCEPT_CONN_AND_SCAN,
+                                                 APP_BT_EXT_ADV_TX_POWER_ANY,
+                                                 WICED_BT_BLE_EXT_ADV_PHY_1M, 0,
+                                                 WICED_BT_BLE_EXT_ADV_PHY_1M,
+                                                 APP_BT_EXT_ADV_SID_FINDME,
+                                                 WICED_BT_BLE_EXT_ADV_SCAN_REQ_NOTIFY_DISABLE);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_EXT_ADV_FAILED, APP_BT_EXT_ADV_SET_FINDME, result);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: app_bt_ext_adv_write_findme_data
+********************************************************************************
+* Summary:
+*   Writes the last advertising data given to app_bt_ext_adv_set_findme_data
+*   to the Find Me set.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_result_t: Result of wiced_bt_ble_set_ext_adv_data
+*
+*******************************************************************************/
+static wiced_result_t app_bt_ext_adv_write_findme_data(void)
+{
+    wiced_result_t result;
+
+    result = wiced_bt_ble_set_ext_adv_data(APP_BT_EXT_ADV_SET_FINDME, app_bt_ext_adv_findme_len,
+                                           app_bt_ext_adv_findme_data);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_EXT_ADV_FAILED, APP_BT_EXT_ADV_SET_FINDME, result);
+    }
+
+    return result;
+}
+
+#endif      /* APP_BT_EXT_ADV */
+
+/* END OF FILE [] */
@@ -0,0 +1,101 @@
+/******************************************************************************
+* File Name:   app_bt_ext_adv.h
+*
+* Description: This file contains the declarations of the extended advertising sets:
+*              the connectable Find Me set and a non-connectable beacon set.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_EXT_ADV_H__
+#define __APP_BT_EXT_ADV_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_ble.h"
+
+#ifdef APP_BT_EXT_ADV
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Advertising set handles */
+#define APP_BT_EXT_ADV_SET_FINDME           (0u)
+#define APP_BT_EXT_ADV_SET_BEACON           (1u)
+
+/* Primary advertising intervals of the Find Me set in 0.625 ms units, the
+ * same as the high and low duty intervals in design.cybt */
+#ifndef APP_BT_EXT_ADV_FAST_INTERVAL
+#define APP_BT_EXT_ADV_FAST_INTERVAL        (30u)
+#endif
+#ifndef APP_BT_EXT_ADV_SLOW_INTERVAL
+#define APP_BT_EXT_ADV_SLOW_INTERVAL        (1280u)
+#endif
+
+/* Advertising interval of the beacon set in 0.625 ms units (about 1 s). Odd
+ * and prime to the Find Me intervals, so that the events of the two sets
+ * drift past each other instead of colliding on every beacon event */
+#ifndef APP_BT_EXT_ADV_BEACON_INTERVAL
+#define APP_BT_EXT_ADV_BEACON_INTERVAL      (1637u)
+#endif
+
+/* Largest advertising data of the Find Me set, which uses legacy PDUs */
+#define APP_BT_EXT_ADV_FINDME_MAX_LEN       (31u)
+
+/* Largest beacon payload: one extended advertising PDU on the secondary
+ * channel without fragmentation */
+#define APP_BT_EXT_ADV_BEACON_MAX_LEN       (191u)
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t app_bt_ext_adv_init(void);
+
+wiced_result_t app_bt_ext_adv_set_findme(wiced_bt_ble_advert_mode_t mode,
+                                         wiced_bt_ble_address_type_t peer_addr_type,
+                                         wiced_bt_device_address_t peer_addr);
+
+wiced_bt_ble_advert_mode_t app_bt_ext_adv_get_findme_mode(void);
+
+void app_bt_ext_adv_findme_stopped(void);
+
+wiced_result_t app_bt_ext_adv_set_findme_data(uint8_t num_elem, const wiced_bt_ble_advert_elem_t *p_elems);
+
+wiced_result_t app_bt_ext_adv_set_beacon_data(const uint8_t *p_data, uint16_t len);
+
+#endif      /* APP_BT_EXT_ADV */
+
+#endif      /* __APP_BT_EXT_ADV_H__ */
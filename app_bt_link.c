@@ -0,0 +1,169 @@
+/******************************************************************************
+* File Name:   app_bt_link.c
+*
+* Description: This file implements the link layer setup done on every new connection.
+*              The 2M PHY and 251 byte LL payloads let a long read complete in fewer
+*              connection events. A peer that refuses either request stays on the
+*              defaults (1M PHY, 27 byte payloads) and the connection is not affected.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_bt_link.h"
+#include "app_log.h"
+#include <string.h>
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_bt_link_start
+********************************************************************************
+* Summary:
+*   Sets the link layer defaults of a new connection and asks the controller
+*   for the 2M PHY and the longest LL payload. The outcome is reported later
+*   through BTM_BLE_PHY_UPDATE_EVT and BTM_BLE_DATA_LENGTH_UPDATE_EVENT.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Entry of the new connection
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_link_start(app_bt_conn_t *p_conn)
+{
+    wiced_result_t result;
+#if APP_BT_LINK_REQUEST_2M_PHY
+    wiced_bt_ble_phy_preferences_t phy_preferences;
+#endif
+
+    p_conn->tx_phy = APP_BT_LINK_PHY_1M;
+    p_conn->rx_phy = APP_BT_LINK_PHY_1M;
+    p_conn->max_tx_octets = APP_BT_LINK_DEFAULT_OCTETS;
+    p_conn->max_rx_octets = APP_BT_LINK_DEFAULT_OCTETS;
+
+#if APP_BT_LINK_REQUEST_2M_PHY
+    /* Prefer 2M but allow 1M so the peer may keep its current PHY */
+    memset(&phy_preferences, 0, sizeof(phy_preferences));
+    memcpy(phy_preferences.remote_bd_addr, p_conn->bd_addr, sizeof(wiced_bt_device_address_t));
+    phy_preferences.tx_phys = BTM_BLE_PREFER_2M_PHY | BTM_BLE_PREFER_1M_PHY;
+    phy_preferences.rx_phys = BTM_BLE_PREFER_2M_PHY | BTM_BLE_PREFER_1M_PHY;
+    phy_preferences.phy_opts = BTM_BLE_PREFER_NO_LELR;
+
+    result = wiced_bt_ble_set_phy(&phy_preferences);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_LINK_PHY_REQUEST_FAILED, result, p_conn->conn_id);
+    }
+#endif
+
+    result = wiced_bt_ble_set_data_packet_length(p_conn->bd_addr,
+                                                 APP_BT_LINK_TX_OCTETS,
+                                                 APP_BT_LINK_TX_TIME);
+    if (WICED_BT_SUCCESS != result)
+    {
+        APP_LOG(APP_LOG_ID_LINK_DLE_REQUEST_FAILED, result, p_conn->conn_id);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_bt_link_phy_update
+********************************************************************************
+* Summary:
+*   Records the PHYs in use after a PHY update procedure. On failure, for
+*   example when the peer does not support 2M, the link keeps its current PHYs.
+*
+* Parameters:
+*   wiced_bt_ble_phy_update_t *p_phy_update: PHY update event data
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_link_phy_update(wiced_bt_ble_phy_update_t *p_phy_update)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find_by_bda(p_phy_update->bd_address);
+
+    if (NULL == p_conn)
+    {
+        return;
+    }
+
+    if (WICED_BT_SUCCESS == p_phy_update->status)
+    {
+        p_conn->tx_phy = p_phy_update->tx_phy;
+        p_conn->rx_phy = p_phy_update->rx_phy;
+    }
+
+    APP_LOG(APP_LOG_ID_LINK_PHY_UPDATE, p_phy_update->status, p_conn->conn_id,
+            p_conn->tx_phy, p_conn->rx_phy);
+}
+
+/*******************************************************************************
+* Function Name: app_bt_link_data_length_update
+********************************************************************************
+* Summary:
+*   Records the LL payload lengths in use after a data length change. A peer
+*   that refuses the request leaves the link on 27 byte payloads.
+*
+* Parameters:
+*   wiced_bt_ble_phy_data_length_update_t *p_dle_update: Data length event data
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_bt_link_data_length_update(wiced_bt_ble_phy_data_length_update_t *p_dle_update)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find_by_bda(p_dle_update->bd_address);
+
+    if (NULL == p_conn)
+    {
+        return;
+    }
+
+    p_conn->max_tx_octets = p_dle_update->max_tx_octets;
+    p_conn->max_rx_octets = p_dle_update->max_rx_octets;
+
+    APP_LOG(APP_LOG_ID_LINK_DLE_UPDATE, p_conn->conn_id,
+            p_dle_update->max_tx_octets, p_dle_update->max_tx_time,
+            p_dle_update->max_rx_octets, p_dle_update->max_rx_time);
+}
+
+/* END OF FILE [] */
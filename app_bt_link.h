@@ -0,0 +1,85 @@
+/******************************************************************************
+* File Name:   app_bt_link.h
+*
+* Description: This file contains the declarations of the link layer setup that requests
+*              the LE 2M PHY and longer data packets on every new connection.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_BT_LINK_H__
+#define __APP_BT_LINK_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_ble.h"
+#include "app_bt_conn.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Set to 0 to stay on the LE 1M PHY */
+#ifndef APP_BT_LINK_REQUEST_2M_PHY
+#define APP_BT_LINK_REQUEST_2M_PHY      (1u)
+#endif
+
+/* LL payload length and transmit time requested after connection. 251 bytes
+ * is the largest LL payload; 2120 us is its air time on the LE 1M PHY */
+#ifndef APP_BT_LINK_TX_OCTETS
+#define APP_BT_LINK_TX_OCTETS           (251u)
+#endif
+#ifndef APP_BT_LINK_TX_TIME
+#define APP_BT_LINK_TX_TIME             (2120u)
+#endif
+
+/* Link layer defaults that apply until the peer accepts an update */
+#define APP_BT_LINK_DEFAULT_OCTETS      (27u)
+
+/* PHY values reported in BTM_BLE_PHY_UPDATE_EVT */
+#define APP_BT_LINK_PHY_1M              (1u)
+#define APP_BT_LINK_PHY_2M              (2u)
+#define APP_BT_LINK_PHY_CODED           (3u)
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_bt_link_start(app_bt_conn_t *p_conn);
+
+void app_bt_link_phy_update(wiced_bt_ble_phy_update_t *p_phy_update);
+
+void app_bt_link_data_length_update(wiced_bt_ble_phy_data_length_update_t *p_dle_update);
+
+#endif      /* __APP_BT_LINK_H__ */
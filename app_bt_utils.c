@@ -45,6 +45,31 @@
 #include "app_bt_utils.h"
 #include "wiced_bt_dev.h"
 
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Marks a value without a name in a dense name table */
+#define APP_BT_ENUM_NO_NAME             (0xFFFFu)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Name table of one enum type. The names are stored back to back, NUL
+ * separated, and located through 16-bit offsets */
+typedef struct
+{
+    const char     *p_names;        /* NUL separated names */
+    const uint16_t *p_offsets;      /* Offset of each name in p_names */
+    const uint16_t *p_values;       /* Sorted values of a sparse table, NULL for a dense table */
+    uint16_t        first;          /* Value of the first entry of a dense table */
+    uint16_t        count;          /* Number of entries */
+} app_bt_enum_table_t;
+
+#ifndef APP_LOG_TOKENIZED
+/* Generated at build time by scripts/gen_bt_enum_tables.py (see PREBUILD in the Makefile) */
+#include "app_bt_enum_tables.h"
+#endif
+
 /****************************************************************************
  * FUNCTION DEFINITIONS
  ***************************************************************************/
@@ -96,6 +121,71 @@ void print_array(void * to_print, uint16_t len)
 
 }
 
+/* The name tables are only needed to format text logs. With tokenized logging
+ * the names are restored on the host by scripts/app_log_decode.py */
+#ifndef APP_LOG_TOKENIZED
+/*******************************************************************************
+* Function Name: app_bt_enum_name
+********************************************************************************
+* Summary:
+* Looks up the name of an enum value in one of the name tables generated by
+* scripts/gen_bt_enum_tables.py. Dense tables are indexed directly by value;
+* sparse tables are searched with a binary search over their sorted values.
+*
+* Parameters:
+*  const app_bt_enum_table_t *p_table: Name table to search
+*  uint32_t value                    : Enum value
+*  const char *p_unknown             : Returned when the value has no name
+*
+* Return:
+*  const char *: Name of the value
+*
+*******************************************************************************/
+static const char *app_bt_enum_name(const app_bt_enum_table_t *p_table,
+                                    uint32_t value,
+                                    const char *p_unknown)
+{
+    uint32_t index;
+    uint32_t low;
+    uint32_t high;
+    uint16_t offset = APP_BT_ENUM_NO_NAME;
+
+    if (NULL == p_table->p_values)
+    {
+        /* Dense table: bounds check, then index by value */
+        index = value - p_table->first;
+        if ((value >= p_table->first) && (index < p_table->count))
+        {
+            offset = p_table->p_offsets[index];
+        }
+    }
+    else
+    {
+        low = 0;
+        high = p_table->count;
+        while (low < high)
+        {
+            index = (low + high) / 2u;
+            if (p_table->p_values[index] == value)
+            {
+                offset = p_table->p_offsets[index];
+                break;
+            }
+
+            if (p_table->p_values[index] < value)
+            {
+                low = index + 1u;
+            }
+            else
+            {
+                high = index;
+            }
+        }
+    }
+
+    return (APP_BT_ENUM_NO_NAME == offset) ? p_unknown : &p_table->p_names[offset];
+}
+
 /*******************************************************************************
 * Function Name: get_btm_event_name
 ********************************************************************************
@@ -113,47 +203,7 @@ void print_array(void * to_print, uint16_t len)
 *******************************************************************************/
 const char *get_btm_event_name(wiced_bt_management_evt_t event)
 {
-    switch ( (int)event )
-    {
-    CASE_RETURN_STR(BTM_ENABLED_EVT)
-    CASE_RETURN_STR(BTM_DISABLED_EVT)
-    CASE_RETURN_STR(BTM_POWER_MANAGEMENT_STATUS_EVT)
-    CASE_RETURN_STR(BTM_PIN_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_USER_CONFIRMATION_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_PASSKEY_NOTIFICATION_EVT)
-    CASE_RETURN_STR(BTM_PASSKEY_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_KEYPRESS_NOTIFICATION_EVT)
-    CASE_RETURN_STR(BTM_PAIRING_IO_CAPABILITIES_BR_EDR_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_PAIRING_IO_CAPABILITIES_BR_EDR_RESPONSE_EVT)
-    CASE_RETURN_STR(BTM_PAIRING_IO_CAPABILITIES_BLE_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_PAIRING_COMPLETE_EVT)
-    CASE_RETURN_STR(BTM_ENCRYPTION_STATUS_EVT)
-    CASE_RETURN_STR(BTM_SECURITY_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_SECURITY_FAILED_EVT)
-    CASE_RETURN_STR(BTM_SECURITY_ABORTED_EVT)
-    CASE_RETURN_STR(BTM_READ_LOCAL_OOB_DATA_COMPLETE_EVT)
-    CASE_RETURN_STR(BTM_REMOTE_OOB_DATA_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT)
-    CASE_RETURN_STR(BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT)
-    CASE_RETURN_STR(BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_BLE_SCAN_STATE_CHANGED_EVT)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_STATE_CHANGED_EVT)
-    CASE_RETURN_STR(BTM_SMP_REMOTE_OOB_DATA_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_SMP_SC_REMOTE_OOB_DATA_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_SMP_SC_LOCAL_OOB_DATA_NOTIFICATION_EVT)
-    CASE_RETURN_STR(BTM_SCO_CONNECTED_EVT)
-    CASE_RETURN_STR(BTM_SCO_DISCONNECTED_EVT)
-    CASE_RETURN_STR(BTM_SCO_CONNECTION_REQUEST_EVT)
-    CASE_RETURN_STR(BTM_SCO_CONNECTION_CHANGE_EVT)
-    CASE_RETURN_STR(BTM_BLE_CONNECTION_PARAM_UPDATE)
-    CASE_RETURN_STR(BTM_BLE_PHY_UPDATE_EVT)
-    CASE_RETURN_STR(BTM_LPM_STATE_LOW_POWER)
-    CASE_RETURN_STR(BTM_MULTI_ADVERT_RESP_EVENT)
-    CASE_RETURN_STR(BTM_BLE_DATA_LENGTH_UPDATE_EVENT)
-    }
-
-    return "UNKNOWN_EVENT";
+    return app_bt_enum_name(&app_bt_btm_event_table, (uint32_t)event, "UNKNOWN_EVENT");
 }
 
 /*******************************************************************************
@@ -173,20 +223,7 @@ const char *get_btm_event_name(wiced_bt_management_evt_t event)
 *******************************************************************************/
 const char *get_bt_advert_mode_name(wiced_bt_ble_advert_mode_t mode)
 {
-    switch ( (int)mode )
-    {
-    CASE_RETURN_STR(BTM_BLE_ADVERT_OFF)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_DIRECTED_HIGH)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_DIRECTED_LOW)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_UNDIRECTED_HIGH)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_UNDIRECTED_LOW)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_NONCONN_HIGH)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_NONCONN_LOW)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_DISCOVERABLE_HIGH)
-    CASE_RETURN_STR(BTM_BLE_ADVERT_DISCOVERABLE_LOW)
-    }
-
-    return "UNKNOWN_MODE";
+    return app_bt_enum_name(&app_bt_advert_mode_table, (uint32_t)mode, "UNKNOWN_MODE");
 }
 
 /*******************************************************************************
@@ -206,19 +243,7 @@ const char *get_bt_advert_mode_name(wiced_bt_ble_advert_mode_t mode)
 *******************************************************************************/
 const char *get_bt_gatt_disconn_reason_name(wiced_bt_gatt_disconn_reason_t reason)
 {
-    switch ( (int)reason )
-    {
-    CASE_RETURN_STR(GATT_CONN_UNKNOWN)
-    CASE_RETURN_STR(GATT_CONN_L2C_FAILURE)
-    CASE_RETURN_STR(GATT_CONN_TIMEOUT)
-    CASE_RETURN_STR(GATT_CONN_TERMINATE_PEER_USER)
-    CASE_RETURN_STR(GATT_CONN_TERMINATE_LOCAL_HOST)
-    CASE_RETURN_STR(GATT_CONN_FAIL_ESTABLISH)
-    CASE_RETURN_STR(GATT_CONN_LMP_TIMEOUT)
-    CASE_RETURN_STR(GATT_CONN_CANCEL)
-    }
-
-    return "UNKNOWN_REASON";
+    return app_bt_enum_name(&app_bt_disconn_reason_table, (uint32_t)reason, "UNKNOWN_REASON");
 }
 
 /*******************************************************************************
@@ -238,57 +263,7 @@ const char *get_bt_gatt_disconn_reason_name(wiced_bt_gatt_disconn_reason_t reaso
 *******************************************************************************/
 const char *get_bt_gatt_status_name(wiced_bt_gatt_status_t status)
 {
-    switch ( (int)status )
-    {
-    CASE_RETURN_STR(WICED_BT_GATT_SUCCESS)
-    CASE_RETURN_STR(WICED_BT_GATT_INVALID_HANDLE)
-    CASE_RETURN_STR(WICED_BT_GATT_READ_NOT_PERMIT)
-    CASE_RETURN_STR(WICED_BT_GATT_WRITE_NOT_PERMIT)
-    CASE_RETURN_STR(WICED_BT_GATT_INVALID_PDU)
-    CASE_RETURN_STR(WICED_BT_GATT_INSUF_AUTHENTICATION)
-    CASE_RETURN_STR(WICED_BT_GATT_REQ_NOT_SUPPORTED)
-    CASE_RETURN_STR(WICED_BT_GATT_INVALID_OFFSET)
-    CASE_RETURN_STR(WICED_BT_GATT_INSUF_AUTHORIZATION)
-    CASE_RETURN_STR(WICED_BT_GATT_PREPARE_Q_FULL)
-    CASE_RETURN_STR(WICED_BT_GATT_ATTRIBUTE_NOT_FOUND)
-    CASE_RETURN_STR(WICED_BT_GATT_NOT_LONG)
-    CASE_RETURN_STR(WICED_BT_GATT_INSUF_KEY_SIZE)
-    CASE_RETURN_STR(WICED_BT_GATT_INVALID_ATTR_LEN)
-    CASE_RETURN_STR(WICED_BT_GATT_ERR_UNLIKELY)
-    CASE_RETURN_STR(WICED_BT_GATT_INSUF_ENCRYPTION)
-    CASE_RETURN_STR(WICED_BT_GATT_UNSUPPORT_GRP_TYPE)
-    CASE_RETURN_STR(WICED_BT_GATT_INSUF_RESOURCE)
-        CASE_RETURN_STR(WICED_BT_GATT_DATABASE_OUT_OF_SYNC)
-    CASE_RETURN_STR(WICED_BT_GATT_VALUE_NOT_ALLOWED)
-    CASE_RETURN_STR(WICED_BT_GATT_ILLEGAL_PARAMETER)
-    CASE_RETURN_STR(WICED_BT_GATT_NO_RESOURCES)
-    CASE_RETURN_STR(WICED_BT_GATT_INTERNAL_ERROR)
-    CASE_RETURN_STR(WICED_BT_GATT_WRONG_STATE)
-    CASE_RETURN_STR(WICED_BT_GATT_DB_FULL)
-    CASE_RETURN_STR(WICED_BT_GATT_BUSY)
-    CASE_RETURN_STR(WICED_BT_GATT_ERROR)
-    CASE_RETURN_STR(WICED_BT_GATT_CMD_STARTED)
-    CASE_RETURN_STR(WICED_BT_GATT_PENDING)
-    CASE_RETURN_STR(WICED_BT_GATT_AUTH_FAIL)
-    CASE_RETURN_STR(WICED_BT_GATT_MORE)
-    CASE_RETURN_STR(WICED_BT_GATT_INVALID_CFG)
-    CASE_RETURN_STR(WICED_BT_GATT_SERVICE_STARTED)
-    CASE_RETURN_STR(WICED_BT_GATT_ENCRYPTED_NO_MITM)
-    CASE_RETURN_STR(WICED_BT_GATT_NOT_ENCRYPTED)
-    CASE_RETURN_STR(WICED_BT_GATT_CONGESTED)
-    CASE_RETURN_STR(WICED_BT_GATT_NOT_ALLOWED)
-    CASE_RETURN_STR(WICED_BT_GATT_HANDLED)
-    CASE_RETURN_STR(WICED_BT_GATT_NO_PENDING_OPERATION)
-    CASE_RETURN_STR(WICED_BT_GATT_INDICATION_RESPONSE_PENDING)
-    CASE_RETURN_STR(WICED_BT_GATT_WRITE_REQ_REJECTED)
-    CASE_RETURN_STR(WICED_BT_GATT_CCC_CFG_ERR)
-    CASE_RETURN_STR(WICED_BT_GATT_PRC_IN_PROGRESS)
-    CASE_RETURN_STR(WICED_BT_GATT_OUT_OF_RANGE)
-    CASE_RETURN_STR(WICED_BT_GATT_BAD_OPCODE)
-    CASE_RETURN_STR(WICED_BT_GATT_INVALID_CONNECTION_ID)
-    }
-
-    return "UNKNOWN_STATUS";
+    return app_bt_enum_name(&app_bt_gatt_status_table, (uint32_t)status, "UNKNOWN_STATUS");
 }
 
 /*******************************************************************************
@@ -308,38 +283,7 @@ const char *get_bt_gatt_status_name(wiced_bt_gatt_status_t status)
 *******************************************************************************/
 const char *get_bt_smp_status_name(wiced_bt_smp_status_t status)
 {
-
-    switch ((int)status)
-    {
-
-        CASE_RETURN_STR(SMP_SUCCESS)                 /**< Success */
-        CASE_RETURN_STR(SMP_PASSKEY_ENTRY_FAIL)      /**< Passkey entry failed */
-        CASE_RETURN_STR(SMP_OOB_FAIL)                /**< OOB failed */
-        CASE_RETURN_STR(SMP_PAIR_AUTH_FAIL)          /**< Authentication failed */
-        CASE_RETURN_STR(SMP_CONFIRM_VALUE_ERR)       /**< Value confirmation failed */
-        CASE_RETURN_STR(SMP_PAIR_NOT_SUPPORT)        /**< Not supported */
-        CASE_RETURN_STR(SMP_ENC_KEY_SIZE)            /**< Encryption key size failure */
-        CASE_RETURN_STR(SMP_INVALID_CMD)             /**< Invalid command */
-        CASE_RETURN_STR(SMP_PAIR_FAIL_UNKNOWN)       /**< Unknown failure */
-        CASE_RETURN_STR(SMP_REPEATED_ATTEMPTS)       /**< Repeated attempts */
-        CASE_RETURN_STR(SMP_INVALID_PARAMETERS)      /**< Invalid parameters  */
-        CASE_RETURN_STR(SMP_DHKEY_CHK_FAIL)          /**< DH Key check failed */
-        CASE_RETURN_STR(SMP_NUMERIC_COMPAR_FAIL)     /**< Numeric comparison failed */
-        CASE_RETURN_STR(SMP_BR_PAIRING_IN_PROGR)     /**< BR paIring in progress */
-        CASE_RETURN_STR(SMP_XTRANS_DERIVE_NOT_ALLOW) /**< Cross transport key derivation not allowed */
-        /* bte smp status codes */
-        CASE_RETURN_STR(SMP_PAIR_INTERNAL_ERR) /**< Internal error */
-        CASE_RETURN_STR(SMP_UNKNOWN_IO_CAP)    /**< unknown IO capability, unable to decide associatino model */
-        CASE_RETURN_STR(SMP_INIT_FAIL)         /**< Initialization failed */
-        CASE_RETURN_STR(SMP_CONFIRM_FAIL)      /**< Confirmation failed */
-        CASE_RETURN_STR(SMP_BUSY)              /**< Busy */
-        CASE_RETURN_STR(SMP_ENC_FAIL)          /**< Encryption failed */
-        CASE_RETURN_STR(SMP_STARTED)           /**< Started */
-        CASE_RETURN_STR(SMP_RSP_TIMEOUT)       /**< Response timeout */
-        CASE_RETURN_STR(SMP_FAIL)              /**< Generic failure */
-        CASE_RETURN_STR(SMP_CONN_TOUT)         /**< Connection timeout */
-    }
-
-    return "UNKNOWN_STATUS";
+    return app_bt_enum_name(&app_bt_smp_status_table, (uint32_t)status, "UNKNOWN_STATUS");
 }
+#endif /* APP_LOG_TOKENIZED */
 /* [] END OF FILE */
@@ -53,8 +53,6 @@
 /******************************************************************************
  * Constants
  ******************************************************************************/
-#define CASE_RETURN_STR(const)          case const: return #const;
-
 #define FROM_BIT16_TO_8(val)            ((uint8_t)(((val) >> 8 )& 0xff))
 
 /****************************************************************************
@@ -64,6 +62,7 @@ void print_bd_address(wiced_bt_device_address_t bdadr);
 
 void print_array(void * to_print, uint16_t len);
 
+#ifndef APP_LOG_TOKENIZED
 const char *get_btm_event_name(wiced_bt_management_evt_t event);
 
 const char *get_bt_advert_mode_name(wiced_bt_ble_advert_mode_t mode);
@@ -73,5 +72,6 @@ const char *get_bt_gatt_disconn_reason_name(wiced_bt_gatt_disconn_reason_t reaso
 const char *get_bt_gatt_status_name(wiced_bt_gatt_status_t status);
 
 const char *get_bt_smp_status_name(wiced_bt_smp_status_t status);
+#endif /* APP_LOG_TOKENIZED */
 
 #endif      /*__APP_BT_UTILS_H__ */
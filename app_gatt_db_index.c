@@ -0,0 +1,394 @@
+/******************************************************************************
+* File Name:   app_gatt_db_index.c
+*
+* Description: This file builds a handle sorted index over the GATT database lookup
+*              table so that read, write and read-by-type requests resolve a handle with
+*              a binary search instead of a linear scan of app_gatt_db_ext_attr_tbl.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_gatt_db_index.h"
+#include <stdio.h>
+#include <string.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Handles of one attribute type, stored in increasing handle order in
+ * app_gatt_db_type_entries[first] .. [first + count - 1] */
+typedef struct
+{
+    wiced_bt_uuid_t uuid;
+    uint16_t        first;
+    uint16_t        count;
+} app_gatt_db_type_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+/* Positions of app_gatt_db_ext_attr_tbl entries, sorted by attribute handle */
+static uint16_t app_gatt_db_sorted_idx[APP_GATT_DB_INDEX_MAX_ATTRS];
+static uint16_t app_gatt_db_sorted_count = 0;
+
+/* Attribute types indexed by app_gatt_db_index_init */
+static const uint16_t app_gatt_db_type_uuids[] = APP_GATT_DB_TYPE_INDEX_UUIDS;
+
+/* Attribute type index, filled one type at a time */
+static app_gatt_db_type_t       app_gatt_db_types[APP_GATT_DB_TYPE_INDEX_MAX_UUIDS];
+static app_gatt_db_type_entry_t app_gatt_db_type_entries[APP_GATT_DB_TYPE_INDEX_MAX_HANDLES];
+static uint16_t                 app_gatt_db_num_types = 0;
+static uint16_t                 app_gatt_db_num_type_entries = 0;
+
+/* Hash of gatt_database, changes when a firmware update changes the GATT DB */
+static uint16_t                 app_gatt_db_hash = 0;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static app_gatt_db_type_t *app_gatt_db_index_get_type(const wiced_bt_uuid_t *p_uuid);
+static wiced_bool_t app_gatt_db_index_add_type(const wiced_bt_uuid_t *p_uuid);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_gatt_db_index_init
+********************************************************************************
+* Summary:
+*   Builds the handle index over app_gatt_db_ext_attr_tbl, then the attribute
+*   type index for the types in APP_GATT_DB_TYPE_INDEX_UUIDS. The generated
+*   table is normally already in handle order, so the insertion sort below
+*   costs a single pass in the common case. A type that does not fit in the
+*   type index is left out and found by walking the GATT DB. Must be called
+*   once after wiced_bt_gatt_db_init and before any lookup, from le_app_init.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the handle index was built, WICED_FALSE if the
+*                 table does not fit in APP_GATT_DB_INDEX_MAX_ATTRS entries
+*
+*******************************************************************************/
+wiced_bool_t app_gatt_db_index_init(void)
+{
+    wiced_bt_uuid_t uuid = { .len = LEN_UUID_16 };
+    uint16_t i;
+    uint16_t j;
+    uint16_t idx;
+
+    app_gatt_db_sorted_count = 0;
+    app_gatt_db_num_types = 0;
+    app_gatt_db_num_type_entries = 0;
+
+    app_gatt_db_hash = 0;
+    for (i = 0; i < gatt_database_len; i++)
+    {
+        app_gatt_db_hash = (uint16_t)((app_gatt_db_hash * 31u) + gatt_database[i]);
+    }
+
+    if (app_gatt_db_ext_attr_tbl_size > APP_GATT_DB_INDEX_MAX_ATTRS)
+    {
+        printf("GATT DB index too small: %d entries, %d required\n",
+               APP_GATT_DB_INDEX_MAX_ATTRS, app_gatt_db_ext_attr_tbl_size);
+        return WICED_FALSE;
+    }
+
+    for (i = 0; i < app_gatt_db_ext_attr_tbl_size; i++)
+    {
+        /* Shift larger handles up and insert the current entry behind them */
+        for (j = i; j > 0; j--)
+        {
+            idx = app_gatt_db_sorted_idx[j - 1];
+            if (app_gatt_db_ext_attr_tbl[idx].handle <= app_gatt_db_ext_attr_tbl[i].handle)
+            {
+                break;
+            }
+            app_gatt_db_sorted_idx[j] = idx;
+        }
+        app_gatt_db_sorted_idx[j] = i;
+    }
+
+    app_gatt_db_sorted_count = app_gatt_db_ext_attr_tbl_size;
+
+    for (i = 0; i < (sizeof(app_gatt_db_type_uuids) / sizeof(app_gatt_db_type_uuids[0])); i++)
+    {
+        uuid.uu.uuid16 = app_gatt_db_type_uuids[i];
+        if (!app_gatt_db_index_add_type(&uuid))
+        {
+            printf("GATT DB type index too small for UUID 0x%04X\n", uuid.uu.uuid16);
+        }
+    }
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_db_index_get_hash
+********************************************************************************
+* Summary:
+*   Returns a hash of gatt_database. A bonded client that last saw another
+*   hash has a stale attribute cache and is sent Service Changed.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint16_t: Hash of the GATT DB
+*
+*******************************************************************************/
+uint16_t app_gatt_db_index_get_hash(void)
+{
+    return app_gatt_db_hash;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_db_index_find
+********************************************************************************
+* Summary:
+*   Finds the lookup table entry of an attribute handle with a binary search
+*   over the handle index.
+*
+* Parameters:
+*   uint16_t handle: Attribute handle to look up
+*
+* Return:
+*   gatt_db_lookup_table_t*: Matching entry, or NULL if the handle is not in
+*                            the lookup table
+*
+*******************************************************************************/
+gatt_db_lookup_table_t *app_gatt_db_index_find(uint16_t handle)
+{
+    uint16_t low = 0;
+    uint16_t high = app_gatt_db_sorted_count;
+    uint16_t mid;
+    gatt_db_lookup_table_t *p_entry;
+
+    while (low < high)
+    {
+        mid = (uint16_t)((low + high) / 2u);
+        p_entry = &app_gatt_db_ext_attr_tbl[app_gatt_db_sorted_idx[mid]];
+
+        if (p_entry->handle == handle)
+        {
+            return p_entry;
+        }
+
+        if (p_entry->handle < handle)
+        {
+            low = mid + 1u;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_db_index_find_by_type
+********************************************************************************
+* Summary:
+*   Finds the attributes of a given type within a handle range.
+*
+* Parameters:
+*   const wiced_bt_uuid_t *p_uuid              : Attribute type
+*   uint16_t s_handle                          : First handle of the range
+*   uint16_t e_handle                          : Last handle of the range
+*   const app_gatt_db_type_entry_t **pp_first  : Returns the first matching attribute;
+*                                                the others follow in handle order
+*
+* Return:
+*   uint16_t: Number of matching attributes, or APP_GATT_DB_TYPE_NOT_INDEXED if
+*             the type is not in the index
+*
+*******************************************************************************/
+uint16_t app_gatt_db_index_find_by_type(const wiced_bt_uuid_t *p_uuid,
+                                        uint16_t s_handle,
+                                        uint16_t e_handle,
+                                        const app_gatt_db_type_entry_t **pp_first)
+{
+    app_gatt_db_type_t *p_type;
+    const app_gatt_db_type_entry_t *p_entries;
+    uint16_t low = 0;
+    uint16_t high;
+    uint16_t mid;
+    uint16_t first;
+
+    if (p_uuid->len > sizeof(p_uuid->uu))
+    {
+        return APP_GATT_DB_TYPE_NOT_INDEXED;
+    }
+
+    p_type = app_gatt_db_index_get_type(p_uuid);
+    if (NULL == p_type)
+    {
+        return APP_GATT_DB_TYPE_NOT_INDEXED;
+    }
+
+    p_entries = &app_gatt_db_type_entries[p_type->first];
+
+    /* First entry with a handle at or after the start of the range */
+    high = p_type->count;
+    while (low < high)
+    {
+        mid = (uint16_t)((low + high) / 2u);
+        if (p_entries[mid].handle < s_handle)
+        {
+            low = mid + 1u;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    first = low;
+
+    /* First entry after the end of the range */
+    high = p_type->count;
+    while (low < high)
+    {
+        mid = (uint16_t)((low + high) / 2u);
+        if (p_entries[mid].handle <= e_handle)
+        {
+            low = mid + 1u;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    *pp_first = &p_entries[first];
+
+    return (uint16_t)(low - first);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_db_index_get_type
+********************************************************************************
+* Summary:
+*   Finds an attribute type in the type index.
+*
+* Parameters:
+*   const wiced_bt_uuid_t *p_uuid: Attribute type
+*
+* Return:
+*   app_gatt_db_type_t*: Indexed type, or NULL if the type is not indexed
+*
+*******************************************************************************/
+static app_gatt_db_type_t *app_gatt_db_index_get_type(const wiced_bt_uuid_t *p_uuid)
+{
+    uint16_t i;
+
+    for (i = 0; i < app_gatt_db_num_types; i++)
+    {
+        if ((app_gatt_db_types[i].uuid.len == p_uuid->len) &&
+            (0 == memcmp(&app_gatt_db_types[i].uuid.uu, &p_uuid->uu, p_uuid->len)))
+        {
+            return &app_gatt_db_types[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_db_index_add_type
+********************************************************************************
+* Summary:
+*   Adds the handles of one attribute type to the type index. The GATT
+*   database is walked once with wiced_bt_gatt_find_handle_by_type; requests
+*   for the type then only visit its own handles.
+*
+* Parameters:
+*   const wiced_bt_uuid_t *p_uuid: Attribute type
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the type is indexed, WICED_FALSE if it does
+*                 not fit in the index
+*
+*******************************************************************************/
+static wiced_bool_t app_gatt_db_index_add_type(const wiced_bt_uuid_t *p_uuid)
+{
+    app_gatt_db_type_t *p_type;
+    uint16_t handle = 1;
+    uint16_t count = 0;
+
+    if (NULL != app_gatt_db_index_get_type(p_uuid))
+    {
+        return WICED_TRUE;
+    }
+
+    if (app_gatt_db_num_types >= APP_GATT_DB_TYPE_INDEX_MAX_UUIDS)
+    {
+        return WICED_FALSE;
+    }
+
+    while (0 != (handle = wiced_bt_gatt_find_handle_by_type(handle, 0xFFFF, (wiced_bt_uuid_t *)p_uuid)))
+    {
+        if ((app_gatt_db_num_type_entries + count) >= APP_GATT_DB_TYPE_INDEX_MAX_HANDLES)
+        {
+            /* Drop the partial list; requests for this type walk the database */
+            return WICED_FALSE;
+        }
+
+        app_gatt_db_type_entries[app_gatt_db_num_type_entries + count].handle = handle;
+        app_gatt_db_type_entries[app_gatt_db_num_type_entries + count].p_attr = app_gatt_db_index_find(handle);
+        count++;
+
+        if (0xFFFF == handle)
+        {
+            break;
+        }
+        handle++;
+    }
+
+    p_type = &app_gatt_db_types[app_gatt_db_num_types++];
+    p_type->uuid = *p_uuid;
+    p_type->first = app_gatt_db_num_type_entries;
+    p_type->count = count;
+    app_gatt_db_num_type_entries += count;
+
+    return WICED_TRUE;
+}
+
+/* END OF FILE [] */
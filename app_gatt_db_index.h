@@ -0,0 +1,111 @@
+/******************************************************************************
+* File Name:   app_gatt_db_index.h
+*
+* Description: This file contains the declarations of the handle index used to look up
+*              attributes of the application GATT database lookup table.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_GATT_DB_INDEX_H__
+#define __APP_GATT_DB_INDEX_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+#include "GeneratedSource/cycfg_gatt_db.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Maximum number of entries of app_gatt_db_ext_attr_tbl that can be indexed.
+ * Override from the Makefile DEFINES when the GATT database grows beyond it */
+#ifndef APP_GATT_DB_INDEX_MAX_ATTRS
+#define APP_GATT_DB_INDEX_MAX_ATTRS     (64u)
+#endif
+
+/* Capacity of the attribute type index: number of distinct attribute types
+ * (UUIDs) and total number of handles over all those types */
+#ifndef APP_GATT_DB_TYPE_INDEX_MAX_UUIDS
+#define APP_GATT_DB_TYPE_INDEX_MAX_UUIDS    (8u)
+#endif
+#ifndef APP_GATT_DB_TYPE_INDEX_MAX_HANDLES
+#define APP_GATT_DB_TYPE_INDEX_MAX_HANDLES  (64u)
+#endif
+
+/* Attribute types indexed for read-by-type requests: the types of the
+ * characteristic values and descriptors in app_gatt_db_ext_attr_tbl. Other
+ * types, or types that do not fit in the index, are found by walking the
+ * GATT DB */
+#ifndef APP_GATT_DB_TYPE_INDEX_UUIDS
+#define APP_GATT_DB_TYPE_INDEX_UUIDS \
+    { \
+        __UUID_CHARACTERISTIC_DEVICE_NAME, \
+        __UUID_CHARACTERISTIC_APPEARANCE, \
+        __UUID_CHARACTERISTIC_SERVICE_CHANGED, \
+        __UUID_DESCRIPTOR_CLIENT_CHARACTERISTIC_CONFIGURATION, \
+        __UUID_CHARACTERISTIC_ALERT_LEVEL, \
+    }
+#endif
+
+/* Returned by app_gatt_db_index_find_by_type when the type is not in the index */
+#define APP_GATT_DB_TYPE_NOT_INDEXED        (0xFFFFu)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One attribute of a given type */
+typedef struct
+{
+    uint16_t                handle;
+    gatt_db_lookup_table_t *p_attr;     /* Lookup table entry, NULL if the handle has none */
+} app_gatt_db_type_entry_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_bool_t app_gatt_db_index_init(void);
+
+uint16_t app_gatt_db_index_get_hash(void);
+
+gatt_db_lookup_table_t *app_gatt_db_index_find(uint16_t handle);
+
+uint16_t app_gatt_db_index_find_by_type(const wiced_bt_uuid_t *p_uuid,
+                                        uint16_t s_handle,
+                                        uint16_t e_handle,
+                                        const app_gatt_db_type_entry_t **pp_first);
+
+#endif      /* __APP_GATT_DB_INDEX_H__ */
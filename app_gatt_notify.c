@@ -0,0 +1,745 @@
+/******************************************************************************
+* File Name:   app_gatt_notify.c
+*
+* Description: This file implements the notification and indication engine. Updates
+*              are queued per connection and coalesced per characteristic, the latest
+*              value is read when the PDU is built, and each connection sends until the
+*              stack stops accepting PDUs, backing off while the link is congested.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_gatt_notify.h"
+#include "app_bt_conn.h"
+#include "app_bt_buffer_pool.h"
+#include "app_gatt_db_index.h"
+#include "app_gatt_stream.h"
+#include "app_log.h"
+#include "wiced_timer.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <string.h>
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Bytes in front of the value in a notification buffer. They hold the
+ * connection ID so that the buffer can be accounted to its connection when
+ * the stack returns it */
+#define APP_GATT_NOTIFY_BUF_HDR_LEN     (APP_BT_BUFFER_POOL_HEADROOM)
+
+/* ATT header of a Handle Value Notification or Indication */
+#define APP_GATT_NOTIFY_ATT_HDR_LEN     (3u)
+
+/* A full-size notification must come from the large pool, not the heap */
+_Static_assert((APP_GATT_NOTIFY_BUF_HDR_LEN + APP_BT_MAX_MTU - APP_GATT_NOTIFY_ATT_HDR_LEN) <=
+               APP_BT_BUFFER_POOL_LARGE_SIZE, "Large pool blocks cannot hold a full notification");
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Characteristic that can be notified or indicated */
+typedef struct
+{
+    uint16_t value_handle;
+    uint16_t cccd_handle;
+} app_gatt_notify_char_t;
+
+/* Outbound state of one connection */
+typedef struct
+{
+    wiced_bool_t in_use;
+    uint16_t     conn_id;
+    uint32_t     pending;               /* Bit per characteristic with an update to send */
+    uint8_t      next;                  /* Characteristic served first in the next round */
+    uint8_t      in_flight;             /* Notifications not yet returned by the stack */
+    wiced_bool_t congested;             /* Stack refused the last PDU */
+    wiced_bool_t indication_pending;    /* Indication waiting for its confirmation */
+} app_gatt_notify_conn_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static const app_gatt_notify_char_t app_gatt_notify_chars[] = APP_GATT_NOTIFY_CHARS;
+
+#define APP_GATT_NOTIFY_NUM_CHARS \
+    ((uint8_t)(sizeof(app_gatt_notify_chars) / sizeof(app_gatt_notify_chars[0])))
+
+_Static_assert(sizeof(app_gatt_notify_chars) / sizeof(app_gatt_notify_chars[0]) <= 32,
+               "The pending bitmap holds at most 32 characteristics");
+
+static app_gatt_notify_conn_t  app_gatt_notify_conns[APP_BT_MAX_CONNECTIONS];
+static app_gatt_notify_stats_t app_gatt_notify_stats;
+static wiced_timer_t           app_gatt_notify_retry_timer;
+static uint32_t                app_gatt_notify_retry_ms;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static app_gatt_notify_conn_t *app_gatt_notify_find(uint16_t conn_id);
+static uint32_t app_gatt_notify_char_bit(uint16_t handle);
+static void app_gatt_notify_queue(app_gatt_notify_conn_t *p_state, uint32_t bit);
+static void app_gatt_notify_pump(app_gatt_notify_conn_t *p_state);
+static wiced_bt_gatt_status_t app_gatt_notify_send(app_gatt_notify_conn_t *p_state,
+                                                   app_bt_conn_t *p_conn,
+                                                   const app_gatt_notify_char_t *p_char,
+                                                   wiced_bool_t indicate);
+static void app_gatt_notify_free_buffer(uint8_t *p_buf);
+static void app_gatt_notify_back_off(void);
+static void app_gatt_notify_retry_timer_cb(WICED_TIMER_PARAM_TYPE arg);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_gatt_notify_init
+********************************************************************************
+* Summary:
+*   Clears the connection states and the counters and creates the congestion
+*   retry timer. Must be called from the BT stack context after
+*   BTM_ENABLED_EVT.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_init(void)
+{
+    memset(app_gatt_notify_conns, 0, sizeof(app_gatt_notify_conns));
+    memset(&app_gatt_notify_stats, 0, sizeof(app_gatt_notify_stats));
+    app_gatt_notify_retry_ms = APP_GATT_NOTIFY_RETRY_MIN_MS;
+    wiced_init_timer(&app_gatt_notify_retry_timer, app_gatt_notify_retry_timer_cb, 0,
+                     WICED_MILLI_SECONDS_TIMER);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_conn_up
+********************************************************************************
+* Summary:
+*   Starts the outbound queue of a new connection.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID of the new link
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_conn_up(uint16_t conn_id)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if (!app_gatt_notify_conns[i].in_use)
+        {
+            memset(&app_gatt_notify_conns[i], 0, sizeof(app_gatt_notify_conns[i]));
+            app_gatt_notify_conns[i].in_use = WICED_TRUE;
+            app_gatt_notify_conns[i].conn_id = conn_id;
+            return;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_conn_down
+********************************************************************************
+* Summary:
+*   Drops the queue of a connection that is going away. Notifications still
+*   held by the stack are returned through the free callback, which ignores
+*   connections that no longer exist.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID of the disconnected link
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_conn_down(uint16_t conn_id)
+{
+    app_gatt_notify_conn_t *p_state = app_gatt_notify_find(conn_id);
+
+    if (NULL != p_state)
+    {
+        p_state->in_use = WICED_FALSE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_value_changed
+********************************************************************************
+* Summary:
+*   Queues an update of a characteristic to every connection and sends what
+*   the stack accepts right away. An update to a characteristic that is still
+*   queued for a connection is merged with it: the client receives the value
+*   current at the time the PDU is built, once.
+*
+* Parameters:
+*   uint16_t handle: Value handle of the characteristic that changed
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_value_changed(uint16_t handle)
+{
+    uint32_t bit = app_gatt_notify_char_bit(handle);
+    uint8_t i;
+
+    if (0 == bit)
+    {
+        return;
+    }
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if (app_gatt_notify_conns[i].in_use)
+        {
+            app_gatt_notify_queue(&app_gatt_notify_conns[i], bit);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_value_changed_conn
+********************************************************************************
+* Summary:
+*   Queues an update of a characteristic to one connection only, for values
+*   that concern a single client such as Service Changed.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID of the client
+*   uint16_t handle : Value handle of the characteristic that changed
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_value_changed_conn(uint16_t conn_id, uint16_t handle)
+{
+    uint32_t bit = app_gatt_notify_char_bit(handle);
+    app_gatt_notify_conn_t *p_state = app_gatt_notify_find(conn_id);
+
+    if ((0 != bit) && (NULL != p_state))
+    {
+        app_gatt_notify_queue(p_state, bit);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_congestion
+********************************************************************************
+* Summary:
+*   Handles GATT_CONGESTION_EVT. Sending resumes as soon as the stack reports
+*   that the link is no longer congested.
+*
+* Parameters:
+*   uint16_t conn_id      : Connection ID of the link
+*   wiced_bool_t congested: Congestion state reported by the stack
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_congestion(uint16_t conn_id, wiced_bool_t congested)
+{
+    app_gatt_notify_conn_t *p_state = app_gatt_notify_find(conn_id);
+
+    if (NULL == p_state)
+    {
+        return;
+    }
+
+    p_state->congested = congested;
+    if (!congested)
+    {
+        app_gatt_notify_retry_ms = APP_GATT_NOTIFY_RETRY_MIN_MS;
+        app_gatt_notify_pump(p_state);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_confirmed
+********************************************************************************
+* Summary:
+*   Handles the Handle Value Confirmation of an indication. Only one
+*   indication can be outstanding per connection, so the next one is sent now.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID of the link
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_confirmed(uint16_t conn_id)
+{
+    app_gatt_notify_conn_t *p_state = app_gatt_notify_find(conn_id);
+
+    if (NULL == p_state)
+    {
+        return;
+    }
+
+    p_state->indication_pending = WICED_FALSE;
+    app_gatt_notify_stats.confirmation_count++;
+    app_gatt_notify_pump(p_state);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_get_stats
+********************************************************************************
+* Summary:
+*   Returns a copy of the throughput counters.
+*
+* Parameters:
+*   app_gatt_notify_stats_t *p_stats: Destination of the copy
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_get_stats(app_gatt_notify_stats_t *p_stats)
+{
+    *p_stats = app_gatt_notify_stats;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_log_stats
+********************************************************************************
+* Summary:
+*   Prints the throughput counters and the time between the first and the
+*   last PDU sent.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_notify_log_stats(void)
+{
+    app_gatt_notify_stats_t *p_stats = &app_gatt_notify_stats;
+
+    APP_LOG(APP_LOG_ID_NOTIFY_STATS, p_stats->notification_count, p_stats->indication_count,
+            p_stats->confirmation_count, p_stats->byte_count,
+            (p_stats->last_send_time - p_stats->first_send_time) * portTICK_PERIOD_MS);
+    APP_LOG(APP_LOG_ID_NOTIFY_QUEUE_STATS, p_stats->coalesced_count, p_stats->skipped_count,
+            p_stats->congested_count, p_stats->no_buffer_count, p_stats->fail_count);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_find
+********************************************************************************
+* Summary:
+*   Finds the outbound state of a connection.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID to look up
+*
+* Return:
+*   app_gatt_notify_conn_t *: State of the connection, NULL if not found
+*
+*******************************************************************************/
+static app_gatt_notify_conn_t *app_gatt_notify_find(uint16_t conn_id)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if (app_gatt_notify_conns[i].in_use && (app_gatt_notify_conns[i].conn_id == conn_id))
+        {
+            return &app_gatt_notify_conns[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_char_bit
+********************************************************************************
+* Summary:
+*   Returns the pending bit of a characteristic in APP_GATT_NOTIFY_CHARS.
+*
+* Parameters:
+*   uint16_t handle: Value handle of the characteristic
+*
+* Return:
+*   uint32_t: Pending bit, 0 if the characteristic is not listed
+*
+*******************************************************************************/
+static uint32_t app_gatt_notify_char_bit(uint16_t handle)
+{
+    uint8_t idx;
+
+    for (idx = 0; idx < APP_GATT_NOTIFY_NUM_CHARS; idx++)
+    {
+        if (app_gatt_notify_chars[idx].value_handle == handle)
+        {
+            return 1u << idx;
+        }
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_queue
+********************************************************************************
+* Summary:
+*   Marks a characteristic as pending on a connection and sends what the
+*   stack accepts right away.
+*
+* Parameters:
+*   app_gatt_notify_conn_t *p_state: State of the connection
+*   uint32_t bit                   : Pending bit of the characteristic
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_gatt_notify_queue(app_gatt_notify_conn_t *p_state, uint32_t bit)
+{
+    if (0 != (p_state->pending & bit))
+    {
+        app_gatt_notify_stats.coalesced_count++;
+    }
+    p_state->pending |= bit;
+    app_gatt_notify_pump(p_state);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_pump
+********************************************************************************
+* Summary:
+*   Sends the queued updates of a connection, starting after the
+*   characteristic served last so that a busy characteristic cannot starve
+*   the others. Sending stops when the queue is empty, when the stack holds
+*   APP_GATT_NOTIFY_MAX_IN_FLIGHT notifications of the connection, when no
+*   buffer is available or when the stack reports congestion; each of these
+*   conditions calls the pump again when it clears. Updates the client has not
+*   enabled in its Client Characteristic Configuration are dropped.
+*
+* Parameters:
+*   app_gatt_notify_conn_t *p_state: State of the connection
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_gatt_notify_pump(app_gatt_notify_conn_t *p_state)
+{
+    app_bt_conn_t *p_conn = app_bt_conn_find(p_state->conn_id);
+    const app_gatt_notify_char_t *p_char;
+    uint16_t *p_cccd;
+    uint16_t cccd;
+    wiced_bool_t indicate;
+    wiced_bool_t sent;
+    wiced_bt_gatt_status_t status;
+    uint8_t n;
+    uint8_t idx;
+    uint32_t bit;
+
+    if (NULL == p_conn)
+    {
+        return;
+    }
+
+    do
+    {
+        sent = WICED_FALSE;
+        for (n = 0; n < APP_GATT_NOTIFY_NUM_CHARS; n++)
+        {
+            if ((0 == p_state->pending) || p_state->congested ||
+                (p_state->in_flight >= APP_GATT_NOTIFY_MAX_IN_FLIGHT))
+            {
+                return;
+            }
+
+            idx = (uint8_t)((p_state->next + n) % APP_GATT_NOTIFY_NUM_CHARS);
+            bit = 1u << idx;
+            if (0 == (p_state->pending & bit))
+            {
+                continue;
+            }
+
+            p_char = &app_gatt_notify_chars[idx];
+            p_cccd = app_bt_conn_get_cccd(p_conn, p_char->cccd_handle);
+            cccd = (NULL != p_cccd) ? *p_cccd : 0;
+
+            if (0 == (cccd & (APP_GATT_NOTIFY_CCCD_NOTIFICATION | APP_GATT_NOTIFY_CCCD_INDICATION)))
+            {
+                p_state->pending &= ~bit;
+                app_gatt_notify_stats.skipped_count++;
+                continue;
+            }
+
+            /* Notifications need no round trip, prefer them when both are enabled */
+            indicate = (0 == (cccd & APP_GATT_NOTIFY_CCCD_NOTIFICATION));
+            if (indicate && p_state->indication_pending)
+            {
+                continue;
+            }
+
+            status = app_gatt_notify_send(p_state, p_conn, p_char, indicate);
+            if (WICED_BT_GATT_CONGESTED == status)
+            {
+                p_state->congested = WICED_TRUE;
+                app_gatt_notify_stats.congested_count++;
+                app_gatt_notify_back_off();
+                return;
+            }
+            if (WICED_BT_GATT_NO_RESOURCES == status)
+            {
+                app_gatt_notify_stats.no_buffer_count++;
+                return;
+            }
+
+            p_state->pending &= ~bit;
+            p_state->next = (uint8_t)((idx + 1) % APP_GATT_NOTIFY_NUM_CHARS);
+            sent = (WICED_BT_GATT_SUCCESS == status);
+            if (!sent)
+            {
+                app_gatt_notify_stats.fail_count++;
+            }
+        }
+    } while (sent);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_send
+********************************************************************************
+* Summary:
+*   Builds one Handle Value Notification or Indication with the current value
+*   of a characteristic and hands it to the stack. The value is truncated to
+*   the ATT MTU of the link.
+*
+* Parameters:
+*   app_gatt_notify_conn_t *p_state       : State of the connection
+*   app_bt_conn_t *p_conn                 : Entry of the connection
+*   const app_gatt_notify_char_t *p_char  : Characteristic to send
+*   wiced_bool_t indicate                 : WICED_TRUE to send an indication
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_NO_RESOURCES when no buffer is
+*                           available, status of the stack otherwise
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t app_gatt_notify_send(app_gatt_notify_conn_t *p_state,
+                                                   app_bt_conn_t *p_conn,
+                                                   const app_gatt_notify_char_t *p_char,
+                                                   wiced_bool_t indicate)
+{
+    app_gatt_stream_producer_t producer = app_gatt_stream_find(p_char->value_handle);
+    gatt_db_lookup_table_t *p_attr = NULL;
+    uint16_t max_len = p_conn->mtu - APP_GATT_NOTIFY_ATT_HDR_LEN;
+    uint16_t len = 0;
+    uint16_t total_len;
+    uint8_t *p_buf;
+    wiced_bt_gatt_status_t status;
+
+    if (NULL == producer)
+    {
+        p_attr = app_gatt_db_index_find(p_char->value_handle);
+        if (NULL == p_attr)
+        {
+            return WICED_BT_GATT_INVALID_HANDLE;
+        }
+        max_len = (p_attr->cur_len < max_len) ? p_attr->cur_len : max_len;
+    }
+
+    p_buf = app_bt_buffer_pool_alloc(APP_GATT_NOTIFY_BUF_HDR_LEN + max_len);
+    if (NULL == p_buf)
+    {
+        return WICED_BT_GATT_NO_RESOURCES;
+    }
+
+    p_buf[0] = (uint8_t)(p_state->conn_id & 0xff);
+    p_buf[1] = (uint8_t)(p_state->conn_id >> 8);
+
+    if (NULL != producer)
+    {
+        status = producer(p_state->conn_id, p_char->value_handle, 0,
+                          &p_buf[APP_GATT_NOTIFY_BUF_HDR_LEN], max_len, &len, &total_len);
+        if (WICED_BT_GATT_SUCCESS != status)
+        {
+            app_bt_buffer_pool_free(p_buf);
+            return status;
+        }
+    }
+    else
+    {
+        len = max_len;
+        memcpy(&p_buf[APP_GATT_NOTIFY_BUF_HDR_LEN], p_attr->p_data, len);
+    }
+
+    if (indicate)
+    {
+        status = wiced_bt_gatt_server_send_indication(p_state->conn_id, p_char->value_handle, len,
+                                                      &p_buf[APP_GATT_NOTIFY_BUF_HDR_LEN],
+                                                      (void *)app_gatt_notify_free_buffer);
+    }
+    else
+    {
+        status = wiced_bt_gatt_server_send_notification(p_state->conn_id, p_char->value_handle, len,
+                                                        &p_buf[APP_GATT_NOTIFY_BUF_HDR_LEN],
+                                                        (void *)app_gatt_notify_free_buffer);
+    }
+
+    if (WICED_BT_GATT_SUCCESS != status)
+    {
+        app_bt_buffer_pool_free(p_buf);
+        return status;
+    }
+
+    p_state->in_flight++;
+    if (indicate)
+    {
+        p_state->indication_pending = WICED_TRUE;
+        app_gatt_notify_stats.indication_count++;
+    }
+    else
+    {
+        app_gatt_notify_stats.notification_count++;
+    }
+
+    app_gatt_notify_stats.byte_count += len;
+    app_gatt_notify_stats.last_send_time = xTaskGetTickCount();
+    if (1 == (app_gatt_notify_stats.notification_count + app_gatt_notify_stats.indication_count))
+    {
+        app_gatt_notify_stats.first_send_time = app_gatt_notify_stats.last_send_time;
+    }
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_free_buffer
+********************************************************************************
+* Summary:
+*   Called through GATT_APP_BUFFER_TRANSMITTED_EVT when the stack is done with
+*   a notification. Returns the buffer to the pool and lets the connection
+*   send its next queued update.
+*
+* Parameters:
+*   uint8_t *p_buf: Value pointer that was passed to the stack
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_gatt_notify_free_buffer(uint8_t *p_buf)
+{
+    uint8_t *p_hdr = p_buf - APP_GATT_NOTIFY_BUF_HDR_LEN;
+    app_gatt_notify_conn_t *p_state = app_gatt_notify_find((uint16_t)(p_hdr[0] | (p_hdr[1] << 8)));
+
+    app_bt_buffer_pool_free(p_hdr);
+
+    if ((NULL != p_state) && (p_state->in_flight > 0))
+    {
+        p_state->in_flight--;
+        app_gatt_notify_pump(p_state);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_back_off
+********************************************************************************
+* Summary:
+*   Arms the retry timer after the stack refused a PDU for congestion, in case
+*   the stack does not report the end of the congestion. The delay doubles
+*   while the links stay congested.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_gatt_notify_back_off(void)
+{
+    if (wiced_is_timer_in_use(&app_gatt_notify_retry_timer))
+    {
+        return;
+    }
+
+    wiced_start_timer(&app_gatt_notify_retry_timer, app_gatt_notify_retry_ms);
+    if (app_gatt_notify_retry_ms < APP_GATT_NOTIFY_RETRY_MAX_MS)
+    {
+        app_gatt_notify_retry_ms *= 2;
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_notify_retry_timer_cb
+********************************************************************************
+* Summary:
+*   Tries the congested connections again.
+*
+* Parameters:
+*   WICED_TIMER_PARAM_TYPE arg: Unused
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_gatt_notify_retry_timer_cb(WICED_TIMER_PARAM_TYPE arg)
+{
+    uint8_t i;
+
+    (void)arg;
+
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if (app_gatt_notify_conns[i].in_use && app_gatt_notify_conns[i].congested)
+        {
+            app_gatt_notify_conns[i].congested = WICED_FALSE;
+            app_gatt_notify_pump(&app_gatt_notify_conns[i]);
+        }
+    }
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,120 @@
+/******************************************************************************
+* File Name:   app_gatt_notify.h
+*
+* Description: This file contains the declarations of the notification and indication
+*              engine that sends characteristic value updates to the connected clients.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_GATT_NOTIFY_H__
+#define __APP_GATT_NOTIFY_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+#include "GeneratedSource/cycfg_gatt_db.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Characteristics that can be notified or indicated:
+ * { value handle, Client Characteristic Configuration descriptor handle }.
+ * Every descriptor must also be listed in APP_BT_CONN_CCCD_HANDLES */
+#define APP_GATT_NOTIFY_CHARS \
+    { \
+        { HDLC_GATT_SERVICE_CHANGED_VALUE, HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG }, \
+    }
+
+/* Client Characteristic Configuration bits */
+#define APP_GATT_NOTIFY_CCCD_NOTIFICATION   (0x0001u)
+#define APP_GATT_NOTIFY_CCCD_INDICATION     (0x0002u)
+
+/* Notifications of one connection handed to the stack and not yet transmitted */
+#ifndef APP_GATT_NOTIFY_MAX_IN_FLIGHT
+#define APP_GATT_NOTIFY_MAX_IN_FLIGHT       (4u)
+#endif
+
+/* Retry delay after the stack reports congestion, doubled on every retry
+ * that is still congested up to the maximum */
+#ifndef APP_GATT_NOTIFY_RETRY_MIN_MS
+#define APP_GATT_NOTIFY_RETRY_MIN_MS        (20u)
+#endif
+#ifndef APP_GATT_NOTIFY_RETRY_MAX_MS
+#define APP_GATT_NOTIFY_RETRY_MAX_MS        (320u)
+#endif
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Throughput counters of the engine */
+typedef struct
+{
+    uint32_t notification_count;    /* Notifications sent */
+    uint32_t indication_count;      /* Indications sent */
+    uint32_t confirmation_count;    /* Indications confirmed by the client */
+    uint32_t byte_count;            /* Value bytes sent */
+    uint32_t coalesced_count;       /* Updates merged into an update not yet sent */
+    uint32_t skipped_count;         /* Updates dropped because the client disabled them */
+    uint32_t congested_count;       /* Sends refused with WICED_BT_GATT_CONGESTED */
+    uint32_t no_buffer_count;       /* Sends deferred for lack of a buffer */
+    uint32_t fail_count;            /* Sends refused for any other reason */
+    uint32_t first_send_time;       /* RTOS tick count of the first send */
+    uint32_t last_send_time;        /* RTOS tick count of the last send */
+} app_gatt_notify_stats_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_gatt_notify_init(void);
+
+void app_gatt_notify_conn_up(uint16_t conn_id);
+
+void app_gatt_notify_conn_down(uint16_t conn_id);
+
+void app_gatt_notify_value_changed(uint16_t handle);
+
+void app_gatt_notify_value_changed_conn(uint16_t conn_id, uint16_t handle);
+
+void app_gatt_notify_congestion(uint16_t conn_id, wiced_bool_t congested);
+
+void app_gatt_notify_confirmed(uint16_t conn_id);
+
+void app_gatt_notify_get_stats(app_gatt_notify_stats_t *p_stats);
+
+void app_gatt_notify_log_stats(void);
+
+#endif      /* __APP_GATT_NOTIFY_H__ */
@@ -0,0 +1,403 @@
+/******************************************************************************
+* File Name:   app_gatt_prep_write.c
+*
+* Description: This file implements the prepared write queue. Prepared values are
+*              assembled in a small set of static buffers instead of the heap, and the
+*              queue of a connection is validated as a whole before any attribute is
+*              written, so an Execute Write either applies every value or none.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_gatt_prep_write.h"
+#include "app_gatt_db_index.h"
+#include "app_log.h"
+#include <string.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One attribute with pending prepared writes. Entry i owns assembly buffer i */
+typedef struct
+{
+    wiced_bool_t in_use;
+    uint16_t     conn_id;
+    uint16_t     handle;
+    uint16_t     len;           /* End of the highest fragment received */
+    wiced_bt_gatt_status_t error;   /* First offset or length error, reported on execute */
+} app_gatt_prep_write_entry_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static uint32_t app_gatt_prep_write_mem[(APP_GATT_PREP_WRITE_BUF_SIZE / 4u) * APP_GATT_PREP_WRITE_NUM_BUFFERS];
+static app_gatt_prep_write_entry_t app_gatt_prep_write_entries[APP_GATT_PREP_WRITE_NUM_BUFFERS];
+static app_gatt_prep_write_stats_t app_gatt_prep_write_stats;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static uint8_t *app_gatt_prep_write_buf(uint8_t index);
+static void     app_gatt_prep_write_drop(uint16_t conn_id);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_init
+********************************************************************************
+* Summary:
+*   Empties the queues of all connections and clears the counters.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_prep_write_init(void)
+{
+    memset(app_gatt_prep_write_entries, 0, sizeof(app_gatt_prep_write_entries));
+    memset(&app_gatt_prep_write_stats, 0, sizeof(app_gatt_prep_write_stats));
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_prepare
+********************************************************************************
+* Summary:
+*   Queues one Prepare Write fragment. The fragment is copied into the
+*   assembly buffer of its attribute at its offset. Offset and length errors
+*   are remembered and reported on Execute Write, as the ATT protocol requires.
+*
+* Parameters:
+*   uint16_t conn_id                       : Connection ID
+*   wiced_bt_gatt_write_req_t *p_write_req : Handle, offset and value of the fragment
+*   uint8_t **pp_echo                      : Returns the queued copy of the fragment,
+*                                            to be echoed in the Prepare Write response
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_INVALID_HANDLE for an unknown attribute,
+*                           WICED_BT_GATT_PREPARE_Q_FULL when no buffer is available
+*                           or another attribute of the connection is pending
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t app_gatt_prep_write_prepare(uint16_t conn_id,
+                                                   wiced_bt_gatt_write_req_t *p_write_req,
+                                                   uint8_t **pp_echo)
+{
+    uint8_t i;
+    wiced_bool_t conn_busy = WICED_FALSE;
+    uint8_t in_use = 0;
+    app_gatt_prep_write_entry_t *p_entry = NULL;
+    app_gatt_prep_write_entry_t *p_free = NULL;
+    uint32_t end = (uint32_t)p_write_req->offset + p_write_req->val_len;
+    uint8_t *p_buf;
+
+    *pp_echo = p_write_req->p_val;
+
+    if (NULL == app_gatt_db_index_find(p_write_req->handle))
+    {
+        return WICED_BT_GATT_INVALID_HANDLE;
+    }
+
+    for (i = 0; i < APP_GATT_PREP_WRITE_NUM_BUFFERS; i++)
+    {
+        if (!app_gatt_prep_write_entries[i].in_use)
+        {
+            if (NULL == p_free)
+            {
+                p_free = &app_gatt_prep_write_entries[i];
+            }
+            continue;
+        }
+
+        in_use++;
+        if (conn_id == app_gatt_prep_write_entries[i].conn_id)
+        {
+            conn_busy = WICED_TRUE;
+            if (p_write_req->handle == app_gatt_prep_write_entries[i].handle)
+            {
+                p_entry = &app_gatt_prep_write_entries[i];
+            }
+        }
+    }
+
+    if (NULL == p_entry)
+    {
+        if ((NULL == p_free) || (conn_busy))
+        {
+            app_gatt_prep_write_stats.queue_full_count++;
+            return WICED_BT_GATT_PREPARE_Q_FULL;
+        }
+
+        p_entry = p_free;
+        memset(p_entry, 0, sizeof(*p_entry));
+        p_entry->in_use = WICED_TRUE;
+        p_entry->conn_id = conn_id;
+        p_entry->handle = p_write_req->handle;
+        p_entry->error = WICED_BT_GATT_SUCCESS;
+
+        in_use++;
+        if (in_use > app_gatt_prep_write_stats.high_water)
+        {
+            app_gatt_prep_write_stats.high_water = in_use;
+        }
+    }
+
+    app_gatt_prep_write_stats.prepare_count++;
+
+    if (WICED_BT_GATT_SUCCESS != p_entry->error)
+    {
+        return WICED_BT_GATT_SUCCESS;
+    }
+
+    /* Fragments must extend the value without leaving a gap and fit the buffer */
+    if (p_write_req->offset > p_entry->len)
+    {
+        p_entry->error = WICED_BT_GATT_INVALID_OFFSET;
+    }
+    else if (end > APP_GATT_PREP_WRITE_BUF_SIZE)
+    {
+        p_entry->error = WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+    else
+    {
+        p_buf = app_gatt_prep_write_buf((uint8_t)(p_entry - app_gatt_prep_write_entries));
+        memcpy(p_buf + p_write_req->offset, p_write_req->p_val, p_write_req->val_len);
+        if (end > p_entry->len)
+        {
+            p_entry->len = (uint16_t)end;
+        }
+        *pp_echo = p_buf + p_write_req->offset;
+    }
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_execute
+********************************************************************************
+* Summary:
+*   Applies the queue of a connection. The assembled value is checked against
+*   its attribute and written only if it is valid. The queue is empty
+*   afterwards.
+*
+* Parameters:
+*   uint16_t conn_id                  : Connection ID
+*   app_gatt_prep_write_apply_t apply : Writes the assembled value to the GATT DB
+*   uint16_t *p_error_handle          : Returns the handle that caused an error
+*
+* Return:
+*   wiced_bt_gatt_status_t: Status of the invalid value, or of the failed write
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t app_gatt_prep_write_execute(uint16_t conn_id,
+                                                   app_gatt_prep_write_apply_t apply,
+                                                   uint16_t *p_error_handle)
+{
+    uint8_t i;
+    wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_SUCCESS;
+    app_gatt_prep_write_entry_t *p_entry = NULL;
+    gatt_db_lookup_table_t *puAttribute;
+
+    for (i = 0; i < APP_GATT_PREP_WRITE_NUM_BUFFERS; i++)
+    {
+        if ((app_gatt_prep_write_entries[i].in_use) &&
+            (conn_id == app_gatt_prep_write_entries[i].conn_id))
+        {
+            p_entry = &app_gatt_prep_write_entries[i];
+            break;
+        }
+    }
+
+    if (NULL == p_entry)
+    {
+        app_gatt_prep_write_stats.execute_count++;
+        return WICED_BT_GATT_SUCCESS;
+    }
+
+    p_entry->in_use = WICED_FALSE;
+
+    puAttribute = app_gatt_db_index_find(p_entry->handle);
+    gatt_status = p_entry->error;
+    if ((WICED_BT_GATT_SUCCESS == gatt_status) &&
+        ((NULL == puAttribute) || (p_entry->len > puAttribute->max_len)))
+    {
+        gatt_status = WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+
+    if (WICED_BT_GATT_SUCCESS != gatt_status)
+    {
+        *p_error_handle = p_entry->handle;
+        app_gatt_prep_write_stats.error_count++;
+        return gatt_status;
+    }
+
+    gatt_status = apply(conn_id, p_entry->handle, app_gatt_prep_write_buf(i), p_entry->len);
+    if (WICED_BT_GATT_SUCCESS == gatt_status)
+    {
+        app_gatt_prep_write_stats.bytes_applied += p_entry->len;
+    }
+    else
+    {
+        *p_error_handle = p_entry->handle;
+    }
+
+    app_gatt_prep_write_stats.execute_count++;
+
+    return gatt_status;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_cancel
+********************************************************************************
+* Summary:
+*   Drops the queue of a connection, on an Execute Write with the cancel flag
+*   or when the client disconnects.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_prep_write_cancel(uint16_t conn_id)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_GATT_PREP_WRITE_NUM_BUFFERS; i++)
+    {
+        if ((app_gatt_prep_write_entries[i].in_use) &&
+            (conn_id == app_gatt_prep_write_entries[i].conn_id))
+        {
+            app_gatt_prep_write_stats.cancel_count++;
+            app_gatt_prep_write_drop(conn_id);
+            break;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_get_stats
+********************************************************************************
+* Summary:
+*   Returns a copy of the queue counters.
+*
+* Parameters:
+*   app_gatt_prep_write_stats_t *p_stats: Destination of the copy
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_prep_write_get_stats(app_gatt_prep_write_stats_t *p_stats)
+{
+    *p_stats = app_gatt_prep_write_stats;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_log_stats
+********************************************************************************
+* Summary:
+*   Prints the queue counters.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_prep_write_log_stats(void)
+{
+    APP_LOG(APP_LOG_ID_PREP_WRITE_STATS,
+            app_gatt_prep_write_stats.prepare_count,
+            app_gatt_prep_write_stats.queue_full_count,
+            app_gatt_prep_write_stats.execute_count,
+            app_gatt_prep_write_stats.cancel_count,
+            app_gatt_prep_write_stats.error_count,
+            app_gatt_prep_write_stats.bytes_applied);
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_buf
+********************************************************************************
+* Summary:
+*   Returns the assembly buffer of a queue entry.
+*
+* Parameters:
+*   uint8_t index: Index of the entry
+*
+* Return:
+*   uint8_t*: First byte of the buffer
+*
+*******************************************************************************/
+static uint8_t *app_gatt_prep_write_buf(uint8_t index)
+{
+    return (uint8_t *)&app_gatt_prep_write_mem[(APP_GATT_PREP_WRITE_BUF_SIZE / 4u) * index];
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_prep_write_drop
+********************************************************************************
+* Summary:
+*   Releases all the queue entries of a connection.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_gatt_prep_write_drop(uint16_t conn_id)
+{
+    uint8_t i;
+
+    for (i = 0; i < APP_GATT_PREP_WRITE_NUM_BUFFERS; i++)
+    {
+        if (conn_id == app_gatt_prep_write_entries[i].conn_id)
+        {
+            app_gatt_prep_write_entries[i].in_use = WICED_FALSE;
+        }
+    }
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,106 @@
+/******************************************************************************
+* File Name:   app_gatt_prep_write.h
+*
+* Description: This file contains the declarations of the prepared write queue that
+*              assembles long writes (Prepare Write / Execute Write) of each connection.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_GATT_PREP_WRITE_H__
+#define __APP_GATT_PREP_WRITE_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Largest value that can be assembled from prepared writes. Follows
+ * MaxAttrLength in design.cybt; must be a multiple of 4 bytes */
+#ifndef APP_GATT_PREP_WRITE_BUF_SIZE
+#define APP_GATT_PREP_WRITE_BUF_SIZE        (512u)
+#endif
+
+/* Number of assembly buffers shared by all connections. A connection holds
+ * one buffer from its first Prepare Write until Execute Write. Only one
+ * attribute can be pending per connection, so that Execute Write is atomic */
+#ifndef APP_GATT_PREP_WRITE_NUM_BUFFERS
+#define APP_GATT_PREP_WRITE_NUM_BUFFERS     (2u)
+#endif
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Applies an assembled value. le_app_set_value in main.c */
+typedef wiced_bt_gatt_status_t (*app_gatt_prep_write_apply_t)(uint16_t conn_id,
+                                                              uint16_t handle,
+                                                              uint8_t *p_val,
+                                                              uint16_t len);
+
+/* Usage counters of the prepared write queue */
+typedef struct
+{
+    uint32_t prepare_count;     /* Prepare Write requests queued */
+    uint32_t queue_full_count;  /* Prepare Write requests refused with Prepare Queue Full */
+    uint32_t execute_count;     /* Execute Write requests that applied the queue */
+    uint32_t cancel_count;      /* Queues dropped by a cancel or a disconnection */
+    uint32_t error_count;       /* Execute Write requests rejected for an invalid offset or length */
+    uint32_t bytes_applied;     /* Bytes written to the GATT DB by Execute Write */
+    uint16_t high_water;        /* Largest number of buffers ever in use at once */
+} app_gatt_prep_write_stats_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_gatt_prep_write_init(void);
+
+wiced_bt_gatt_status_t app_gatt_prep_write_prepare(uint16_t conn_id,
+                                                   wiced_bt_gatt_write_req_t *p_write_req,
+                                                   uint8_t **pp_echo);
+
+wiced_bt_gatt_status_t app_gatt_prep_write_execute(uint16_t conn_id,
+                                                   app_gatt_prep_write_apply_t apply,
+                                                   uint16_t *p_error_handle);
+
+void app_gatt_prep_write_cancel(uint16_t conn_id);
+
+void app_gatt_prep_write_get_stats(app_gatt_prep_write_stats_t *p_stats);
+
+void app_gatt_prep_write_log_stats(void);
+
+#endif      /* __APP_GATT_PREP_WRITE_H__ */
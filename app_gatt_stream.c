@@ -0,0 +1,145 @@
+/******************************************************************************
+* File Name:   app_gatt_stream.c
+*
+* Description: This file implements the table of streamed attributes. A read of a
+*              streamed attribute is served by its producer, which writes the value
+*              straight into the response buffer handed to the BT stack.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_gatt_stream.h"
+#include <string.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef struct
+{
+    uint16_t                   handle;
+    app_gatt_stream_producer_t producer;
+} app_gatt_stream_attr_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static app_gatt_stream_attr_t app_gatt_stream_attrs[APP_GATT_STREAM_MAX_ATTRS];
+static uint8_t                app_gatt_stream_num_attrs = 0;
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_gatt_stream_init
+********************************************************************************
+* Summary:
+*   Removes all streamed attributes.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_gatt_stream_init(void)
+{
+    memset(app_gatt_stream_attrs, 0, sizeof(app_gatt_stream_attrs));
+    app_gatt_stream_num_attrs = 0;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_stream_register
+********************************************************************************
+* Summary:
+*   Backs an attribute of the GATT database with a producer callback. Reads of
+*   the attribute are then served by the producer rather than from the GATT DB
+*   lookup table.
+*
+* Parameters:
+*   uint16_t handle                     : Attribute handle
+*   app_gatt_stream_producer_t producer : Producer of the attribute value
+*
+* Return:
+*   wiced_bool_t: WICED_FALSE if the handle is already streamed or the table is full
+*
+*******************************************************************************/
+wiced_bool_t app_gatt_stream_register(uint16_t handle, app_gatt_stream_producer_t producer)
+{
+    if ((NULL == producer) || (NULL != app_gatt_stream_find(handle)) ||
+        (app_gatt_stream_num_attrs >= APP_GATT_STREAM_MAX_ATTRS))
+    {
+        return WICED_FALSE;
+    }
+
+    app_gatt_stream_attrs[app_gatt_stream_num_attrs].handle = handle;
+    app_gatt_stream_attrs[app_gatt_stream_num_attrs].producer = producer;
+    app_gatt_stream_num_attrs++;
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_gatt_stream_find
+********************************************************************************
+* Summary:
+*   Returns the producer of a streamed attribute.
+*
+* Parameters:
+*   uint16_t handle: Attribute handle
+*
+* Return:
+*   app_gatt_stream_producer_t: Producer, or NULL if the attribute is not streamed
+*
+*******************************************************************************/
+app_gatt_stream_producer_t app_gatt_stream_find(uint16_t handle)
+{
+    uint8_t i;
+
+    for (i = 0; i < app_gatt_stream_num_attrs; i++)
+    {
+        if (handle == app_gatt_stream_attrs[i].handle)
+        {
+            return app_gatt_stream_attrs[i].producer;
+        }
+    }
+
+    return NULL;
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,89 @@
+/******************************************************************************
+* File Name:   app_gatt_stream.h
+*
+* Description: This file contains the declarations of streamed attributes: attributes
+*              whose value is produced on demand by a callback instead of being held in
+*              the GATT DB lookup table.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_GATT_STREAM_H__
+#define __APP_GATT_STREAM_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_gatt.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Maximum number of streamed attributes */
+#ifndef APP_GATT_STREAM_MAX_ATTRS
+#define APP_GATT_STREAM_MAX_ATTRS       (4u)
+#endif
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Producer of a streamed attribute value.
+ * Writes the part of the value that starts at 'offset' directly into the
+ * response buffer 'p_buf', at most 'buf_len' bytes, and returns the number of
+ * bytes written in 'p_len' and the length of the whole value in
+ * 'p_total_len'. A client reads a long value with one Read request
+ * followed by Read Blob requests at increasing offsets; the producer is called
+ * once per request and should keep the value stable until the client has
+ * read to the end.
+ * Returns WICED_BT_GATT_INVALID_OFFSET when 'offset' is beyond the end of the
+ * value, WICED_BT_GATT_SUCCESS otherwise */
+typedef wiced_bt_gatt_status_t (*app_gatt_stream_producer_t)(uint16_t conn_id,
+                                                             uint16_t handle,
+                                                             uint16_t offset,
+                                                             uint8_t *p_buf,
+                                                             uint16_t buf_len,
+                                                             uint16_t *p_len,
+                                                             uint16_t *p_total_len);
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_gatt_stream_init(void);
+
+wiced_bool_t app_gatt_stream_register(uint16_t handle, app_gatt_stream_producer_t producer);
+
+app_gatt_stream_producer_t app_gatt_stream_find(uint16_t handle);
+
+#endif      /* __APP_GATT_STREAM_H__ */
@@ -0,0 +1,368 @@
+/******************************************************************************
+* File Name:   app_log.c
+*
+* Description: This file implements the deferred logger. The Bluetooth stack callbacks
+*              store compact binary records in a single-producer, single-consumer ring
+*              buffer without blocking; a low priority task formats and prints them.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_log.h"
+#include "app_bt_utils.h"
+#include "cyhal.h"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <stdio.h>
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* One entry of the ring buffer */
+typedef struct
+{
+    uint32_t timestamp;                 /* RTOS tick count when the record was written */
+    uint16_t id;                        /* app_log_id_t */
+    uint16_t reserved;
+    uint32_t arg[APP_LOG_MAX_ARGS];
+} app_log_record_t;
+
+#ifndef APP_LOG_TOKENIZED
+/* Static description of a log record */
+typedef struct
+{
+    app_log_arg_kind_t kind;
+    const char        *p_fmt;
+} app_log_format_t;
+#endif
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+#ifndef APP_LOG_TOKENIZED
+#define APP_LOG_RECORD_FORMAT(id, kind, fmt)    { kind, fmt },
+
+static const app_log_format_t app_log_formats[APP_LOG_ID_COUNT] =
+{
+    APP_LOG_RECORDS(APP_LOG_RECORD_FORMAT)
+};
+#endif
+
+static app_log_record_t app_log_ring[APP_LOG_RING_SIZE];
+
+/* Free running indices: head is only written by the producer (the Bluetooth
+ * stack task), tail is only written by the logger task */
+static volatile uint32_t app_log_head = 0;
+static volatile uint32_t app_log_tail = 0;
+static volatile uint32_t app_log_dropped = 0;
+
+static TaskHandle_t app_log_task_handle = NULL;
+static StaticTask_t app_log_task_tcb;
+static StackType_t  app_log_task_stack[APP_LOG_TASK_STACK_SIZE];
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static void app_log_task(void *arg);
+#ifndef APP_LOG_TOKENIZED
+static const char *app_log_decode_arg(app_log_arg_kind_t kind, uint32_t value);
+#endif
+static void app_log_print(const app_log_record_t *p_record);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_log_init
+********************************************************************************
+* Summary:
+*   Creates the task that drains the log ring buffer. Must be called before
+*   the FreeRTOS scheduler is started.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_log_init(void)
+{
+    app_log_task_handle = xTaskCreateStatic(app_log_task, "Log Task",
+                                            APP_LOG_TASK_STACK_SIZE, NULL,
+                                            APP_LOG_TASK_PRIORITY,
+                                            app_log_task_stack, &app_log_task_tcb);
+}
+
+/*******************************************************************************
+* Function Name: app_log_write
+********************************************************************************
+* Summary:
+*   Stores a log record in the ring buffer. Never blocks: when the ring buffer
+*   is full the record is discarded and the drop counter incremented. The
+*   ring buffer has a single producer, so this function must only be called
+*   from the Bluetooth stack task (stack and wiced timer callbacks).
+*
+* Parameters:
+*   app_log_id_t id       : Log record identifier
+*   uint32_t a0 .. a5     : Record arguments
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_log_write(app_log_id_t id, uint32_t a0, uint32_t a1, uint32_t a2,
+                   uint32_t a3, uint32_t a4, uint32_t a5)
+{
+    uint32_t head = app_log_head;
+    app_log_record_t *p_record;
+
+    if ((head - app_log_tail) >= APP_LOG_RING_SIZE)
+    {
+        app_log_dropped++;
+        return;
+    }
+
+    p_record = &app_log_ring[head & (APP_LOG_RING_SIZE - 1u)];
+    p_record->timestamp = xTaskGetTickCount();
+    p_record->id = (uint16_t)id;
+    p_record->arg[0] = a0;
+    p_record->arg[1] = a1;
+    p_record->arg[2] = a2;
+    p_record->arg[3] = a3;
+    p_record->arg[4] = a4;
+    p_record->arg[5] = a5;
+
+    /* Publish the record before the index, then check whether the logger
+     * task had already caught up with it and may be waiting */
+    __DMB();
+    app_log_head = head + 1u;
+    __DMB();
+
+    if ((app_log_tail == head) && (NULL != app_log_task_handle))
+    {
+        xTaskNotifyGive(app_log_task_handle);
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_get_dropped_count
+********************************************************************************
+* Summary:
+*   Returns the number of records discarded because the ring buffer was full.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint32_t: Number of dropped records
+*
+*******************************************************************************/
+uint32_t app_log_get_dropped_count(void)
+{
+    return app_log_dropped;
+}
+
+#ifndef APP_LOG_TOKENIZED
+/*******************************************************************************
+* Function Name: app_log_decode_arg
+********************************************************************************
+* Summary:
+*   Converts an enumerated record argument to its name.
+*
+* Parameters:
+*   app_log_arg_kind_t kind: Type of the argument
+*   uint32_t value         : Argument value
+*
+* Return:
+*   const char*: Name of the value
+*
+*******************************************************************************/
+static const char *app_log_decode_arg(app_log_arg_kind_t kind, uint32_t value)
+{
+    switch (kind)
+    {
+        case APP_LOG_ARG_BTM_EVENT:
+            return get_btm_event_name((wiced_bt_management_evt_t)value);
+
+        case APP_LOG_ARG_ADV_MODE:
+            return get_bt_advert_mode_name((wiced_bt_ble_advert_mode_t)value);
+
+        case APP_LOG_ARG_GATT_STATUS:
+            return get_bt_gatt_status_name((wiced_bt_gatt_status_t)value);
+
+        case APP_LOG_ARG_DISCONN_REASON:
+            return get_bt_gatt_disconn_reason_name((wiced_bt_gatt_disconn_reason_t)value);
+
+        case APP_LOG_ARG_SMP_STATUS:
+            return get_bt_smp_status_name((wiced_bt_smp_status_t)value);
+
+        default:
+            return "";
+    }
+}
+
+/*******************************************************************************
+* Function Name: app_log_print
+********************************************************************************
+* Summary:
+*   Formats one log record on the debug UART, prefixed with its timestamp.
+*
+* Parameters:
+*   const app_log_record_t *p_record: Record to print
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_log_print(const app_log_record_t *p_record)
+{
+    const app_log_format_t *p_format;
+
+    if (p_record->id >= APP_LOG_ID_COUNT)
+    {
+        return;
+    }
+
+    p_format = &app_log_formats[p_record->id];
+
+    printf("[%8lu] ", (unsigned long)p_record->timestamp);
+
+    /* Arguments not consumed by the format string are ignored by printf */
+    if (APP_LOG_ARG_NONE == p_format->kind)
+    {
+        printf(p_format->p_fmt,
+               (unsigned int)p_record->arg[0], (unsigned int)p_record->arg[1],
+               (unsigned int)p_record->arg[2], (unsigned int)p_record->arg[3],
+               (unsigned int)p_record->arg[4], (unsigned int)p_record->arg[5]);
+    }
+    else
+    {
+        printf(p_format->p_fmt,
+               app_log_decode_arg(p_format->kind, p_record->arg[0]),
+               (unsigned int)p_record->arg[1], (unsigned int)p_record->arg[2],
+               (unsigned int)p_record->arg[3], (unsigned int)p_record->arg[4],
+               (unsigned int)p_record->arg[5]);
+    }
+}
+
+#else /* APP_LOG_TOKENIZED */
+/*******************************************************************************
+* Function Name: app_log_print
+********************************************************************************
+* Summary:
+*   Emits one log record as a tokenized line: the token marker followed by the
+*   timestamp, the record id and the arguments in hex. Trailing zero arguments
+*   are omitted. scripts/app_log_decode.py expands the line on the host.
+*
+* Parameters:
+*   const app_log_record_t *p_record: Record to print
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_log_print(const app_log_record_t *p_record)
+{
+    uint32_t i;
+    uint32_t num_args = APP_LOG_MAX_ARGS;
+
+    while ((num_args > 0u) && (0u == p_record->arg[num_args - 1u]))
+    {
+        num_args--;
+    }
+
+    printf("%c%lx %x", APP_LOG_TOKEN_MARKER, (unsigned long)p_record->timestamp,
+           (unsigned int)p_record->id);
+    for (i = 0; i < num_args; i++)
+    {
+        printf(" %lx", (unsigned long)p_record->arg[i]);
+    }
+    printf("\n");
+}
+#endif /* APP_LOG_TOKENIZED */
+
+/*******************************************************************************
+* Function Name: app_log_task
+********************************************************************************
+* Summary:
+*   Waits for records to be written, then prints every pending record and
+*   reports records dropped since the last report.
+*
+* Parameters:
+*   void *arg: Not used
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void app_log_task(void *arg)
+{
+    uint32_t tail = app_log_tail;
+    uint32_t dropped;
+    uint32_t dropped_reported = 0;
+    app_log_record_t record;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (tail != app_log_head)
+        {
+            /* Copy the record out so the slot can be reused while printing */
+            __DMB();
+            record = app_log_ring[tail & (APP_LOG_RING_SIZE - 1u)];
+            tail++;
+            app_log_tail = tail;
+            __DMB();
+
+            app_log_print(&record);
+        }
+
+        dropped = app_log_dropped;
+        if (dropped != dropped_reported)
+        {
+            printf("[LOG] %lu records dropped\n", (unsigned long)(dropped - dropped_reported));
+            dropped_reported = dropped;
+        }
+    }
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,179 @@
+/******************************************************************************
+* File Name:   app_log.h
+*
+* Description: This file contains the declarations of the deferred logger. Log records
+*              are written into a ring buffer from the Bluetooth stack callbacks and
+*              formatted on the debug UART by a low priority task.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_LOG_H__
+#define __APP_LOG_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Number of records in the ring buffer, must be a power of two */
+#ifndef APP_LOG_RING_SIZE
+#define APP_LOG_RING_SIZE               (32u)
+#endif
+
+/* Maximum number of arguments carried by one log record */
+#define APP_LOG_MAX_ARGS                (6u)
+
+/* Priority and stack size (in words) of the task that drains the ring buffer */
+#define APP_LOG_TASK_PRIORITY           (tskIDLE_PRIORITY + 1u)
+#define APP_LOG_TASK_STACK_SIZE         (configMINIMAL_STACK_SIZE * 4u)
+
+/* Marker that starts a tokenized log line. A tokenized line carries the
+ * timestamp, the record id and the non-zero leading arguments in hex */
+#define APP_LOG_TOKEN_MARKER            '~'
+
+/* How an argument of a log record is decoded before it is printed. Only the
+ * first argument is decoded; its format conversion must then be %s */
+typedef enum
+{
+    APP_LOG_ARG_NONE,               /* Arguments are printed as they are */
+    APP_LOG_ARG_BTM_EVENT,          /* wiced_bt_management_evt_t */
+    APP_LOG_ARG_ADV_MODE,           /* wiced_bt_ble_advert_mode_t */
+    APP_LOG_ARG_GATT_STATUS,        /* wiced_bt_gatt_status_t */
+    APP_LOG_ARG_DISCONN_REASON,     /* wiced_bt_gatt_disconn_reason_t */
+    APP_LOG_ARG_SMP_STATUS          /* wiced_bt_smp_status_t */
+} app_log_arg_kind_t;
+
+/* List of log records: X(id, decoding of the first argument, format string).
+ * scripts/app_log_decode.py parses this list, so keep one record per line */
+#define APP_LOG_RECORDS(X) \
+    X(APP_LOG_ID_LOCAL_BDA,             APP_LOG_ARG_NONE,           "Local Bluetooth Address: %02X:%02X:%02X:%02X:%02X:%02X \n") \
+    X(APP_LOG_ID_BT_DISABLED,           APP_LOG_ARG_NONE,           "Bluetooth Disabled \n") \
+    X(APP_LOG_ID_ADV_STATE_CHANGE,      APP_LOG_ARG_ADV_MODE,       "Advertisement State Change: %s\n") \
+    X(APP_LOG_ID_ADV_STOPPED,           APP_LOG_ARG_NONE,           "Advertisement stopped\n") \
+    X(APP_LOG_ID_ADV_STARTED,           APP_LOG_ARG_NONE,           "Advertisement started\n") \
+    X(APP_LOG_ID_CONN_PARAM_UPDATE,     APP_LOG_ARG_NONE,           "Connection parameter update status:%d, Connection Interval: %d, Connection Latency: %d, Connection Timeout: %d\n") \
+    X(APP_LOG_ID_CONN_PARAM_REQUEST,    APP_LOG_ARG_NONE,           "Connection ID '%d' requesting regime %d parameters, Interval: %d-%d, Latency: %d, Timeout: %d\n") \
+    X(APP_LOG_ID_CONN_PARAM_REQUEST_FAILED, APP_LOG_ARG_NONE,       "Connection parameter update request failed, Connection ID '%d'\n") \
+    X(APP_LOG_ID_CONN_PARAM_STATS,      APP_LOG_ARG_NONE,           "Connection parameter regime %d: requests %d, not sent %d, accepted %d, rejected %d, time %d ms\n") \
+    X(APP_LOG_ID_UNHANDLED_BTM_EVT,     APP_LOG_ARG_BTM_EVENT,      "Unhandled Bluetooth Management Event: %s (0x%x)\n") \
+    X(APP_LOG_ID_CONNECTED,             APP_LOG_ARG_NONE,           "Connected : BDA %02X:%02X:%02X:%02X:%02X:%02X \n") \
+    X(APP_LOG_ID_CONNECTION_ID,         APP_LOG_ARG_NONE,           "Connection ID '%d' \n") \
+    X(APP_LOG_ID_DISCONNECTED,          APP_LOG_ARG_NONE,           "Disconnected : BDA %02X:%02X:%02X:%02X:%02X:%02X \n") \
+    X(APP_LOG_ID_DISCONNECT_REASON,     APP_LOG_ARG_DISCONN_REASON, "Reason '%s', Connection ID '%d'\n") \
+    X(APP_LOG_ID_CONN_COUNT,            APP_LOG_ARG_NONE,           "Active connections: %d/%d\n") \
+    X(APP_LOG_ID_CONN_TABLE_FULL,       APP_LOG_ARG_NONE,           "Connection table full, disconnecting Connection ID '%d'\n") \
+    X(APP_LOG_ID_CONN_MTU,              APP_LOG_ARG_NONE,           "Connection ID '%d' MTU: %d\n") \
+    X(APP_LOG_ID_LINK_PHY_REQUEST_FAILED, APP_LOG_ARG_NONE,         "PHY update request failed: 0x%x, Connection ID '%d'\n") \
+    X(APP_LOG_ID_LINK_DLE_REQUEST_FAILED, APP_LOG_ARG_NONE,         "Data length request failed: 0x%x, Connection ID '%d'\n") \
+    X(APP_LOG_ID_LINK_PHY_UPDATE,       APP_LOG_ARG_NONE,           "PHY update status:%d, Connection ID '%d', TX PHY: %d, RX PHY: %d\n") \
+    X(APP_LOG_ID_LINK_DLE_UPDATE,       APP_LOG_ARG_NONE,           "Data length update Connection ID '%d', TX: %d bytes %d us, RX: %d bytes %d us\n") \
+    X(APP_LOG_ID_ALERT_LEVEL,           APP_LOG_ARG_NONE,           "Alert Level = %d, Connection ID '%d'\n") \
+    X(APP_LOG_ID_ALERT_LEVEL_LED,       APP_LOG_ARG_NONE,           "IAS LED Alert Level = %d (highest of %d connections)\n") \
+    X(APP_LOG_ID_WRITE_INVALID_HANDLE,  APP_LOG_ARG_NONE,           "Write Request to Invalid Handle: 0x%x\n") \
+    X(APP_LOG_ID_SET_ATTR_FAILED,       APP_LOG_ARG_GATT_STATUS,    "WARNING: GATT set attr status %s (0x%x)\n") \
+    X(APP_LOG_ID_NOTIFICATION_SENT,     APP_LOG_ARG_NONE,           "Notfication send complete\n") \
+    X(APP_LOG_ID_UNHANDLED_GATT_REQ,    APP_LOG_ARG_NONE,           "ERROR: Unhandled GATT Connection Request case: %d\n") \
+    X(APP_LOG_ID_PREP_WRITE_STATS,      APP_LOG_ARG_NONE,           "Prepared writes: queued %d, queue full %d, executed %d, cancelled %d, rejected %d, bytes %d\n") \
+    X(APP_LOG_ID_EXEC_WRITE_FAILED,     APP_LOG_ARG_GATT_STATUS,    "Execute write failed: %s, handle 0x%x\n") \
+    X(APP_LOG_ID_NOTIFY_STATS,          APP_LOG_ARG_NONE,           "Notifications %d, indications %d, confirmed %d, bytes %d in %d ms\n") \
+    X(APP_LOG_ID_NOTIFY_QUEUE_STATS,    APP_LOG_ARG_NONE,           "Notification queue: coalesced %d, disabled %d, congested %d, no buffer %d, failed %d\n") \
+    X(APP_LOG_ID_ADV_RESTART,           APP_LOG_ARG_NONE,           "Advertising restarted fast on event %d, was in stage %d\n") \
+    X(APP_LOG_ID_ADV_TIME_TO_CONNECT,   APP_LOG_ARG_NONE,           "Connected in advertising stage %d, %d ms after the restart\n") \
+    X(APP_LOG_ID_ADV_STAGE_STATS,       APP_LOG_ARG_NONE,           "Advertising stage %d: entered %d, connections %d, average time to connect %d ms, max %d ms\n") \
+    X(APP_LOG_ID_ADV_DIRECTED,          APP_LOG_ARG_NONE,           "Directed advertising to %02X:%02X:%02X:%02X:%02X:%02X \n") \
+    X(APP_LOG_ID_ADV_RECONNECTED,       APP_LOG_ARG_NONE,           "Client reconnected (directed %d) %d ms after the disconnection\n") \
+    X(APP_LOG_ID_ADV_RECONNECT_STATS,   APP_LOG_ARG_NONE,           "Reconnections: directed %d (average %d ms), undirected %d (average %d ms), directed window expired %d\n") \
+    X(APP_LOG_ID_EXT_ADV_FAILED,        APP_LOG_ARG_NONE,           "Extended advertising set %d: command failed with result 0x%x\n") \
+    X(APP_LOG_ID_ADV_STATUS,            APP_LOG_ARG_NONE,           "Advertised alert level %d, status counter %d\n") \
+    X(APP_LOG_ID_ADV_BUILDER_STATS,     APP_LOG_ARG_NONE,           "Advertising data: %d updates sent, %d refused, %d of %d bytes in use\n") \
+    X(APP_LOG_ID_ADV_STATUS_NO_ROOM,    APP_LOG_ARG_NONE,           "Advertising data needs %d of %d bytes, alert level not advertised\n") \
+    X(APP_LOG_ID_PAIRING_COMPLETE,      APP_LOG_ARG_NONE,           "Pairing complete: status %d, reason %d\n") \
+    X(APP_LOG_ID_BOND_LOADED,           APP_LOG_ARG_NONE,           "Bonds loaded: %d of %d\n") \
+    X(APP_LOG_ID_BOND_REPLACED,         APP_LOG_ARG_NONE,           "Bond store full, removed bond %02X:%02X:%02X:%02X:%02X:%02X \n") \
+    X(APP_LOG_ID_BOND_SAVE_FAILED,      APP_LOG_ARG_NONE,           "Bond of %02X:%02X:%02X:%02X:%02X:%02X not stored in flash\n") \
+    X(APP_LOG_ID_ENCRYPTION_STATUS,     APP_LOG_ARG_NONE,           "Encryption status: %d\n") \
+    X(APP_LOG_ID_SERVICE_CHANGED,       APP_LOG_ARG_NONE,           "GATT DB changed since the last connection, Service Changed queued for Connection ID '%d'\n") \
+    X(APP_LOG_ID_CCCD_RESTORED,         APP_LOG_ARG_NONE,           "Restored the CCCDs of bonded client, Connection ID '%d'\n") \
+    X(APP_LOG_ID_NV_INIT_FAILED,        APP_LOG_ARG_NONE,           "Flash record store at 0x%x not available (sector size %d, page size %d), settings are not kept\n") \
+    X(APP_LOG_ID_NV_NO_FLASH,           APP_LOG_ARG_NONE,           "No flash driver on this target, settings are not kept\n") \
+    X(APP_LOG_ID_NV_STATS,              APP_LOG_ARG_NONE,           "Flash record store: sector %d, used %d of %d bytes, writes %d, unchanged %d, sector changes %d\n") \
+    X(APP_LOG_ID_NV_COMPACT,            APP_LOG_ARG_NONE,           "Flash record store moved to sector %d, %d bytes in use\n") \
+    X(APP_LOG_ID_NV_FULL,               APP_LOG_ARG_NONE,           "Flash record store full, record type %d of %d bytes not stored\n") \
+    X(APP_LOG_ID_RBT_NO_MEMORY,         APP_LOG_ARG_NONE,           "No memory, len_requested: %d!!\n") \
+    X(APP_LOG_ID_RBT_NO_ATTRIBUTE,      APP_LOG_ARG_NONE,           "found type but no attribute for %d \n") \
+    X(APP_LOG_ID_READ_MULTI_NO_ATTRIBUTE, APP_LOG_ARG_NONE,         "Read multiple of unknown handle 0x%x\n") \
+    X(APP_LOG_ID_RBT_NOT_FOUND,         APP_LOG_ARG_NONE,           "attr not found  start_handle: 0x%04x  end_handle: 0x%04x  Type: 0x%04x\n") \
+    X(APP_LOG_ID_PWM_DUTY_CYCLE_FAILED, APP_LOG_ARG_NONE,           "Failed to set duty cycle parameters!!\n") \
+    X(APP_LOG_ID_PWM_START_FAILED,      APP_LOG_ARG_NONE,           "Failed to start PWM !!\n") \
+    X(APP_LOG_ID_BUF_POOL_STATS,        APP_LOG_ARG_NONE,           "Buffer pool %d: size %d, in use %d/%d, high water %d, exhausted %d\n") \
+    X(APP_LOG_ID_BUF_POOL_HEAP_STATS,   APP_LOG_ARG_NONE,           "Buffer pool heap fallback: allocs %d, failures %d\n") \
+    X(APP_LOG_ID_GATT_REGISTER_STATUS,  APP_LOG_ARG_GATT_STATUS,    "GATT event Handler registration status: %s \n") \
+    X(APP_LOG_ID_GATT_DB_INIT_STATUS,   APP_LOG_ARG_GATT_STATUS,    "GATT database initialization status: %s \n")
+
+#define APP_LOG_RECORD_ID(id, kind, fmt)    id,
+
+/* Log record identifiers */
+typedef enum
+{
+    APP_LOG_RECORDS(APP_LOG_RECORD_ID)
+    APP_LOG_ID_COUNT
+} app_log_id_t;
+
+/* Records a log entry with up to APP_LOG_MAX_ARGS integer arguments.
+ * Missing arguments are recorded as zero */
+#define APP_LOG(...)    APP_LOG_ARGS(__VA_ARGS__, 0, 0, 0, 0, 0, 0, 0)
+#define APP_LOG_ARGS(id, a0, a1, a2, a3, a4, a5, ...) \
+    app_log_write((id), (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), \
+                  (uint32_t)(a3), (uint32_t)(a4), (uint32_t)(a5))
+
+/* Records a log entry whose arguments are the six bytes of a Bluetooth device address */
+#define APP_LOG_BDA(id, bda) \
+    app_log_write((id), (bda)[0], (bda)[1], (bda)[2], (bda)[3], (bda)[4], (bda)[5])
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void app_log_init(void);
+
+void app_log_write(app_log_id_t id, uint32_t a0, uint32_t a1, uint32_t a2,
+                   uint32_t a3, uint32_t a4, uint32_t a5);
+
+uint32_t app_log_get_dropped_count(void);
+
+#endif      /* __APP_LOG_H__ */
@@ -0,0 +1,811 @@
+/******************************************************************************
+* File Name:   app_nv.c
+*
+* Description: This file implements the non-volatile record store. Records are keyed
+*              by type and peer address and appended to a log in a flash sector, so an
+*              update programs only a few bytes and a sector is erased only when the
+*              live records are moved to the next sector of the store.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "app_nv.h"
+#include "app_log.h"
+#include "cyhal.h"
+#include <string.h>
+
+/* The store is kept in internal flash through the HAL flash driver. Targets
+ * without it, such as CYW20829 which runs from external QSPI flash, keep no
+ * settings across resets */
+#if defined(CYHAL_DRIVER_AVAILABLE_FLASH) && (CYHAL_DRIVER_AVAILABLE_FLASH)
+#define APP_NV_FLASH_AVAILABLE          (1)
+#else
+#define APP_NV_FLASH_AVAILABLE          (0)
+#endif
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Sector header: magic number and sequence number of the sector. The sector
+ * with the valid header and the highest sequence number is the active one */
+#define APP_NV_SECTOR_MAGIC             (0x564E5041u)   /* "APNV" */
+#define APP_NV_SECTOR_HDR_LEN           (8u)
+
+/* Record layout: type, payload length, check byte, peer address, payload.
+ * A record with a zero payload length deletes the older records of its key */
+#define APP_NV_REC_TYPE                 (0u)
+#define APP_NV_REC_LEN                  (1u)
+#define APP_NV_REC_CHECK                (2u)
+#define APP_NV_REC_BDA                  (3u)
+#define APP_NV_REC_DATA                 (APP_NV_REC_BDA + BD_ADDR_LEN)
+
+/* Records are padded to the flash word size */
+#define APP_NV_REC_ALIGN                (4u)
+#define APP_NV_REC_SIZE(len)            (((APP_NV_REC_DATA + (len)) + APP_NV_REC_ALIGN - 1) & \
+                                         ~(APP_NV_REC_ALIGN - 1))
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static wiced_bool_t   app_nv_ready;
+static uint32_t       app_nv_base;              /* Address of the first sector */
+static uint32_t       app_nv_sector_size;       /* Erase sector size of the flash block */
+static uint8_t        app_nv_num_sectors;       /* Sectors in APP_NV_SIZE bytes */
+static uint32_t       app_nv_page_size;
+static uint8_t        app_nv_erase_value;
+static uint8_t        app_nv_active;            /* Index of the sector records are appended to */
+static uint32_t       app_nv_seq;               /* Sequence number of the active sector */
+static uint32_t       app_nv_tail;              /* Offset of the first free byte in the active sector */
+static app_nv_stats_t app_nv_stats;
+
+/* Page image for read-modify-program, the record last read and the record
+ * being written, which must survive the reads of a sector change */
+static uint32_t       app_nv_page[APP_NV_MAX_PAGE_SIZE / sizeof(uint32_t)];
+static uint8_t        app_nv_record[APP_NV_REC_SIZE(APP_NV_MAX_DATA_LEN)];
+static uint8_t        app_nv_new_record[APP_NV_REC_SIZE(APP_NV_MAX_DATA_LEN)];
+
+#if (APP_NV_FLASH_AVAILABLE)
+static cyhal_flash_t  app_nv_flash;
+
+#if (0 == APP_NV_START_ADDRESS)
+/* Flash reserved for the store, only accessed through cyhal_flash. Aligned
+ * to its size, so it starts on a sector of any smaller erase size */
+CY_SECTION(APP_NV_SECTION) CY_ALIGN(APP_NV_SIZE)
+static const uint8_t  app_nv_storage[APP_NV_SIZE] = { 0u };
+#define APP_NV_BASE_ADDRESS             ((uint32_t)(uintptr_t)app_nv_storage)
+#else
+#define APP_NV_BASE_ADDRESS             ((uint32_t)APP_NV_START_ADDRESS)
+#endif
+#endif
+
+_Static_assert((APP_NV_SIZE / 2u) >= (APP_NV_SECTOR_HDR_LEN + sizeof(app_nv_record)),
+               "APP_NV_SIZE cannot hold two sectors of the largest record");
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static wiced_bool_t app_nv_flash_open(void);
+static wiced_bool_t app_nv_flash_read(uint32_t addr, void *p_data, uint32_t len);
+static wiced_bool_t app_nv_flash_erase(uint32_t addr);
+static wiced_bool_t app_nv_flash_program_page(uint32_t addr, const uint32_t *p_page);
+static uint32_t app_nv_sector_addr(uint8_t sector);
+static uint8_t app_nv_check(const uint8_t *p_rec);
+static wiced_bool_t app_nv_program(uint32_t addr, const uint8_t *p_data, uint32_t len);
+static uint32_t app_nv_scan(uint8_t type, const wiced_bt_device_address_t bd_addr, uint32_t *p_tail);
+static wiced_bool_t app_nv_append(const uint8_t *p_rec, uint32_t size);
+static wiced_bool_t app_nv_compact(void);
+
+/****************************************************************************
+ * FUNCTION DEFINITIONS
+ ***************************************************************************/
+/*******************************************************************************
+* Function Name: app_nv_init
+********************************************************************************
+* Summary:
+*   Opens the flash, finds the active sector and the end of its record log.
+*   An empty store is formatted. Without a usable flash the store stays
+*   closed: reads return nothing and writes fail, the rest of the
+*   application keeps working without persistence.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the store is usable
+*
+*******************************************************************************/
+wiced_bool_t app_nv_init(void)
+{
+    uint32_t hdr[APP_NV_SECTOR_HDR_LEN / sizeof(uint32_t)];
+    wiced_bool_t found = WICED_FALSE;
+    uint8_t i;
+
+    memset(&app_nv_stats, 0, sizeof(app_nv_stats));
+    app_nv_ready = WICED_FALSE;
+
+    if (!app_nv_flash_open())
+    {
+        return WICED_FALSE;
+    }
+
+    for (i = 0; i < app_nv_num_sectors; i++)
+    {
+        if (app_nv_flash_read(app_nv_sector_addr(i), hdr, sizeof(hdr)) &&
+            (APP_NV_SECTOR_MAGIC == hdr[0]) &&
+            (!found || ((int32_t)(hdr[1] - app_nv_seq) > 0)))
+        {
+            found = WICED_TRUE;
+            app_nv_active = i;
+            app_nv_seq = hdr[1];
+        }
+    }
+
+    app_nv_ready = WICED_TRUE;
+    if (found)
+    {
+        (void)app_nv_scan(0, NULL, &app_nv_tail);
+    }
+    else
+    {
+        /* Format: move an empty log to the first sector */
+        app_nv_active = app_nv_num_sectors - 1;
+        app_nv_seq = 0;
+        app_nv_tail = APP_NV_SECTOR_HDR_LEN;
+        app_nv_ready = app_nv_compact();
+    }
+
+    app_nv_log_stats();
+    return app_nv_ready;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_write
+********************************************************************************
+* Summary:
+*   Stores the data of a key. Nothing is programmed when the stored data is
+*   the same, so callers can save on every change without wearing the flash.
+*
+* Parameters:
+*   app_nv_type_t type                      : Kind of data
+*   const wiced_bt_device_address_t bd_addr : Peer the data belongs to
+*   const uint8_t *p_data                   : Data to store
+*   uint8_t len                             : Length of the data, 1 to APP_NV_MAX_DATA_LEN
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the data is stored
+*
+*******************************************************************************/
+wiced_bool_t app_nv_write(app_nv_type_t type, const wiced_bt_device_address_t bd_addr,
+                          const uint8_t *p_data, uint8_t len)
+{
+    uint32_t size = APP_NV_REC_SIZE(len);
+
+    if (!app_nv_ready || (0 == len) || (len > APP_NV_MAX_DATA_LEN))
+    {
+        return WICED_FALSE;
+    }
+
+    if ((0 != app_nv_scan(type, bd_addr, NULL)) &&
+        (len == app_nv_record[APP_NV_REC_LEN]) &&
+        (0 == memcmp(&app_nv_record[APP_NV_REC_DATA], p_data, len)))
+    {
+        app_nv_stats.unchanged_count++;
+        return WICED_TRUE;
+    }
+
+    memset(app_nv_new_record, app_nv_erase_value, size);
+    app_nv_new_record[APP_NV_REC_TYPE] = (uint8_t)type;
+    app_nv_new_record[APP_NV_REC_LEN] = len;
+    memcpy(&app_nv_new_record[APP_NV_REC_BDA], bd_addr, BD_ADDR_LEN);
+    memcpy(&app_nv_new_record[APP_NV_REC_DATA], p_data, len);
+    app_nv_new_record[APP_NV_REC_CHECK] = app_nv_check(app_nv_new_record);
+
+    return app_nv_append(app_nv_new_record, size);
+}
+
+/*******************************************************************************
+* Function Name: app_nv_read
+********************************************************************************
+* Summary:
+*   Reads the data of a key.
+*
+* Parameters:
+*   app_nv_type_t type                      : Kind of data
+*   const wiced_bt_device_address_t bd_addr : Peer the data belongs to
+*   uint8_t *p_data                         : Destination of the data
+*   uint8_t max_len                         : Size of the destination
+*
+* Return:
+*   uint8_t: Number of bytes copied, 0 if the key is not stored
+*
+*******************************************************************************/
+uint8_t app_nv_read(app_nv_type_t type, const wiced_bt_device_address_t bd_addr,
+                    uint8_t *p_data, uint8_t max_len)
+{
+    uint8_t len;
+
+    if (!app_nv_ready || (0 == app_nv_scan(type, bd_addr, NULL)))
+    {
+        return 0;
+    }
+
+    len = app_nv_record[APP_NV_REC_LEN];
+    len = (len < max_len) ? len : max_len;
+    memcpy(p_data, &app_nv_record[APP_NV_REC_DATA], len);
+
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_delete
+********************************************************************************
+* Summary:
+*   Deletes the data of a key.
+*
+* Parameters:
+*   app_nv_type_t type                      : Kind of data
+*   const wiced_bt_device_address_t bd_addr : Peer the data belongs to
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the key is no longer stored
+*
+*******************************************************************************/
+wiced_bool_t app_nv_delete(app_nv_type_t type, const wiced_bt_device_address_t bd_addr)
+{
+    if (!app_nv_ready)
+    {
+        return WICED_FALSE;
+    }
+
+    if (0 == app_nv_scan(type, bd_addr, NULL))
+    {
+        return WICED_TRUE;
+    }
+
+    memset(app_nv_new_record, app_nv_erase_value, APP_NV_REC_SIZE(0));
+    app_nv_new_record[APP_NV_REC_TYPE] = (uint8_t)type;
+    app_nv_new_record[APP_NV_REC_LEN] = 0;
+    memcpy(&app_nv_new_record[APP_NV_REC_BDA], bd_addr, BD_ADDR_LEN);
+    app_nv_new_record[APP_NV_REC_CHECK] = app_nv_check(app_nv_new_record);
+
+    return app_nv_append(app_nv_new_record, APP_NV_REC_SIZE(0));
+}
+
+/*******************************************************************************
+* Function Name: app_nv_get_stats
+********************************************************************************
+* Summary:
+*   Returns a copy of the usage counters.
+*
+* Parameters:
+*   app_nv_stats_t *p_stats: Destination of the copy
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_nv_get_stats(app_nv_stats_t *p_stats)
+{
+    app_nv_stats.used_bytes = app_nv_tail;
+    app_nv_stats.sector_size = app_nv_sector_size;
+    *p_stats = app_nv_stats;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_log_stats
+********************************************************************************
+* Summary:
+*   Prints the usage counters.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void app_nv_log_stats(void)
+{
+    APP_LOG(APP_LOG_ID_NV_STATS, app_nv_active, app_nv_tail, app_nv_sector_size,
+            app_nv_stats.write_count, app_nv_stats.unchanged_count, app_nv_stats.compact_count);
+}
+
+#if (APP_NV_FLASH_AVAILABLE)
+/*******************************************************************************
+* Function Name: app_nv_flash_open
+********************************************************************************
+* Summary:
+*   Opens the HAL flash driver and takes the sector and page sizes of the
+*   flash block that holds the store. The store must lie within that block
+*   and start on one of its sectors; otherwise an erase would wipe code or
+*   data around it.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the flash holds the store
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_open(void)
+{
+    cyhal_flash_info_t info;
+    const cyhal_flash_block_info_t *p_block = NULL;
+    uint32_t num_sectors = 0;
+    uint8_t i;
+
+    app_nv_base = APP_NV_BASE_ADDRESS;
+    if (CY_RSLT_SUCCESS != cyhal_flash_init(&app_nv_flash))
+    {
+        APP_LOG(APP_LOG_ID_NV_INIT_FAILED, app_nv_base, 0, 0);
+        return WICED_FALSE;
+    }
+
+    cyhal_flash_get_info(&app_nv_flash, &info);
+    for (i = 0; i < info.block_count; i++)
+    {
+        if ((app_nv_base >= info.blocks[i].start_address) &&
+            ((app_nv_base - info.blocks[i].start_address) < info.blocks[i].size))
+        {
+            p_block = &info.blocks[i];
+        }
+    }
+
+    if ((NULL != p_block) && (0u != p_block->sector_size))
+    {
+        num_sectors = APP_NV_SIZE / p_block->sector_size;
+    }
+
+    if ((num_sectors < 2u) || (num_sectors > UINT8_MAX) ||
+        (0u != (APP_NV_SIZE % p_block->sector_size)) ||
+        (p_block->sector_size < (APP_NV_SECTOR_HDR_LEN + sizeof(app_nv_record))) ||
+        (0u != ((app_nv_base - p_block->start_address) % p_block->sector_size)) ||
+        (((app_nv_base - p_block->start_address) + APP_NV_SIZE) > p_block->size) ||
+        (p_block->page_size > APP_NV_MAX_PAGE_SIZE))
+    {
+        APP_LOG(APP_LOG_ID_NV_INIT_FAILED, app_nv_base,
+                (NULL != p_block) ? p_block->sector_size : 0,
+                (NULL != p_block) ? p_block->page_size : 0);
+        cyhal_flash_free(&app_nv_flash);
+        return WICED_FALSE;
+    }
+
+    app_nv_sector_size = p_block->sector_size;
+    app_nv_num_sectors = (uint8_t)num_sectors;
+    app_nv_page_size = p_block->page_size;
+    app_nv_erase_value = p_block->erase_value;
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_flash_read
+********************************************************************************
+* Summary:
+*   Reads bytes from the flash.
+*
+* Parameters:
+*   uint32_t addr : Flash address
+*   void *p_data  : Receives the bytes
+*   uint32_t len  : Number of bytes
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE on success
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_read(uint32_t addr, void *p_data, uint32_t len)
+{
+    return (CY_RSLT_SUCCESS == cyhal_flash_read(&app_nv_flash, addr, (uint8_t *)p_data, len));
+}
+
+/*******************************************************************************
+* Function Name: app_nv_flash_erase
+********************************************************************************
+* Summary:
+*   Erases the flash sector that starts at an address.
+*
+* Parameters:
+*   uint32_t addr: Address of the sector
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE on success
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_erase(uint32_t addr)
+{
+    return (CY_RSLT_SUCCESS == cyhal_flash_erase(&app_nv_flash, addr));
+}
+
+/*******************************************************************************
+* Function Name: app_nv_flash_program_page
+********************************************************************************
+* Summary:
+*   Programs a flash page.
+*
+* Parameters:
+*   uint32_t addr          : Address of the page
+*   const uint32_t *p_page : Page image
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE on success
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_program_page(uint32_t addr, const uint32_t *p_page)
+{
+    return (CY_RSLT_SUCCESS == cyhal_flash_program(&app_nv_flash, addr, p_page));
+}
+#else
+/*******************************************************************************
+* Function Name: app_nv_flash_open
+********************************************************************************
+* Summary:
+*   Reports that the target has no HAL flash driver, so the store stays
+*   closed.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_FALSE
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_open(void)
+{
+    APP_LOG(APP_LOG_ID_NV_NO_FLASH);
+    return WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_flash_read
+********************************************************************************
+* Summary:
+*   Fails, the target has no HAL flash driver.
+*
+* Return:
+*   wiced_bool_t: WICED_FALSE
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_read(uint32_t addr, void *p_data, uint32_t len)
+{
+    return WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_flash_erase
+********************************************************************************
+* Summary:
+*   Fails, the target has no HAL flash driver.
+*
+* Return:
+*   wiced_bool_t: WICED_FALSE
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_erase(uint32_t addr)
+{
+    return WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_flash_program_page
+********************************************************************************
+* Summary:
+*   Fails, the target has no HAL flash driver.
+*
+* Return:
+*   wiced_bool_t: WICED_FALSE
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_flash_program_page(uint32_t addr, const uint32_t *p_page)
+{
+    return WICED_FALSE;
+}
+#endif
+
+/*******************************************************************************
+* Function Name: app_nv_sector_addr
+********************************************************************************
+* Summary:
+*   Returns the flash address of a sector of the store.
+*
+* Parameters:
+*   uint8_t sector: Index of the sector
+*
+* Return:
+*   uint32_t: Flash address
+*
+*******************************************************************************/
+static uint32_t app_nv_sector_addr(uint8_t sector)
+{
+    return app_nv_base + (sector * app_nv_sector_size);
+}
+
+/*******************************************************************************
+* Function Name: app_nv_check
+********************************************************************************
+* Summary:
+*   Computes the check byte of a record, used to skip records whose
+*   programming was interrupted.
+*
+* Parameters:
+*   const uint8_t *p_rec: Record
+*
+* Return:
+*   uint8_t: Check byte
+*
+*******************************************************************************/
+static uint8_t app_nv_check(const uint8_t *p_rec)
+{
+    uint8_t check = 0x5A;
+    uint32_t i;
+
+    for (i = 0; i < (uint32_t)(APP_NV_REC_DATA + p_rec[APP_NV_REC_LEN]); i++)
+    {
+        if (APP_NV_REC_CHECK != i)
+        {
+            check = (uint8_t)((check << 1) | (check >> 7)) ^ p_rec[i];
+        }
+    }
+
+    return check;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_program
+********************************************************************************
+* Summary:
+*   Programs bytes into erased flash. Flash is programmed a page at a time, so
+*   each page touched is read, the new bytes are merged in and the page is
+*   programmed again; the bytes already programmed keep their value, which
+*   NOR flash allows.
+*
+* Parameters:
+*   uint32_t addr         : Flash address
+*   const uint8_t *p_data : Bytes to program
+*   uint32_t len          : Number of bytes
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE on success
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_program(uint32_t addr, const uint8_t *p_data, uint32_t len)
+{
+    uint32_t page_addr;
+    uint32_t offset;
+    uint32_t n;
+
+    while (len > 0)
+    {
+        page_addr = addr - (addr % app_nv_page_size);
+        offset = addr - page_addr;
+        n = ((app_nv_page_size - offset) < len) ? (app_nv_page_size - offset) : len;
+
+        if (!app_nv_flash_read(page_addr, app_nv_page, app_nv_page_size))
+        {
+            app_nv_stats.fail_count++;
+            return WICED_FALSE;
+        }
+
+        memcpy((uint8_t *)app_nv_page + offset, p_data, n);
+        if (!app_nv_flash_program_page(page_addr, app_nv_page))
+        {
+            app_nv_stats.fail_count++;
+            return WICED_FALSE;
+        }
+
+        addr += n;
+        p_data += n;
+        len -= n;
+    }
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_scan
+********************************************************************************
+* Summary:
+*   Walks the record log of the active sector. Finds the newest valid record
+*   of a key and leaves it in app_nv_record, and optionally returns the end of
+*   the log.
+*
+* Parameters:
+*   uint8_t type                            : Kind of data, 0 to match no key
+*   const wiced_bt_device_address_t bd_addr : Peer of the key
+*   uint32_t *p_tail                        : Receives the end of the log, may be NULL
+*
+* Return:
+*   uint32_t: Offset of the newest record of the key in the sector, 0 if the
+*             key is not stored or was deleted
+*
+*******************************************************************************/
+static uint32_t app_nv_scan(uint8_t type, const wiced_bt_device_address_t bd_addr, uint32_t *p_tail)
+{
+    uint32_t base = app_nv_sector_addr(app_nv_active);
+    uint32_t offset = APP_NV_SECTOR_HDR_LEN;
+    uint32_t found = 0;
+    uint32_t found_size = 0;
+    uint32_t size;
+    uint8_t hdr[APP_NV_REC_DATA];
+
+    while ((offset + sizeof(hdr)) <= app_nv_sector_size)
+    {
+        if (!app_nv_flash_read(base + offset, hdr, sizeof(hdr)) ||
+            (app_nv_erase_value == hdr[APP_NV_REC_TYPE]))
+        {
+            break;
+        }
+
+        size = APP_NV_REC_SIZE(hdr[APP_NV_REC_LEN]);
+        if ((offset + size) > app_nv_sector_size)
+        {
+            break;
+        }
+
+        if ((0 != type) && (type == hdr[APP_NV_REC_TYPE]) &&
+            (0 == memcmp(&hdr[APP_NV_REC_BDA], bd_addr, BD_ADDR_LEN)) &&
+            app_nv_flash_read(base + offset, app_nv_record, size) &&
+            (app_nv_check(app_nv_record) == app_nv_record[APP_NV_REC_CHECK]))
+        {
+            found = (0 != hdr[APP_NV_REC_LEN]) ? offset : 0;
+            found_size = size;
+        }
+
+        offset += size;
+    }
+
+    if (NULL != p_tail)
+    {
+        *p_tail = offset;
+    }
+
+    /* A later record of the key that failed its check overwrote the
+     * newest valid one, read it again */
+    if ((0 != found) &&
+        !app_nv_flash_read(base + found, app_nv_record, found_size))
+    {
+        found = 0;
+    }
+
+    return found;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_append
+********************************************************************************
+* Summary:
+*   Appends a record to the log, moving the live records to the next sector
+*   first when the active sector is full.
+*
+* Parameters:
+*   const uint8_t *p_rec: Record
+*   uint32_t size       : Padded size of the record
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE on success
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_append(const uint8_t *p_rec, uint32_t size)
+{
+    if (((app_nv_tail + size) > app_nv_sector_size) &&
+        (!app_nv_compact() || ((app_nv_tail + size) > app_nv_sector_size)))
+    {
+        APP_LOG(APP_LOG_ID_NV_FULL, p_rec[APP_NV_REC_TYPE], size);
+        return WICED_FALSE;
+    }
+
+    if (!app_nv_program(app_nv_sector_addr(app_nv_active) + app_nv_tail, p_rec, size))
+    {
+        return WICED_FALSE;
+    }
+
+    app_nv_tail += size;
+    app_nv_stats.write_count++;
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: app_nv_compact
+********************************************************************************
+* Summary:
+*   Copies the newest record of every stored key to the next sector and makes
+*   it the active sector. The sector header is programmed last, so an
+*   interrupted copy leaves the previous sector active.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE on success
+*
+*******************************************************************************/
+static wiced_bool_t app_nv_compact(void)
+{
+    uint8_t next = (uint8_t)((app_nv_active + 1) % app_nv_num_sectors);
+    uint32_t src = app_nv_sector_addr(app_nv_active);
+    uint32_t dst = APP_NV_SECTOR_HDR_LEN;
+    uint32_t offset = APP_NV_SECTOR_HDR_LEN;
+    uint32_t hdr[APP_NV_SECTOR_HDR_LEN / sizeof(uint32_t)];
+    uint8_t rec_hdr[APP_NV_REC_DATA];
+    uint32_t size;
+
+    if (!app_nv_flash_erase(app_nv_sector_addr(next)))
+    {
+        app_nv_stats.fail_count++;
+        return WICED_FALSE;
+    }
+
+    while ((offset + sizeof(rec_hdr)) <= app_nv_tail)
+    {
+        if (!app_nv_flash_read(src + offset, rec_hdr, sizeof(rec_hdr)))
+        {
+            app_nv_stats.fail_count++;
+            return WICED_FALSE;
+        }
+
+        /* Copy the record only if it is the newest valid one of its key */
+        size = APP_NV_REC_SIZE(rec_hdr[APP_NV_REC_LEN]);
+        if (app_nv_scan(rec_hdr[APP_NV_REC_TYPE], &rec_hdr[APP_NV_REC_BDA], NULL) == offset)
+        {
+            if (!app_nv_program(app_nv_sector_addr(next) + dst, app_nv_record, size))
+            {
+                return WICED_FALSE;
+            }
+            dst += size;
+        }
+
+        offset += size;
+    }
+
+    hdr[0] = APP_NV_SECTOR_MAGIC;
+    hdr[1] = app_nv_seq + 1;
+    if (!app_nv_program(app_nv_sector_addr(next), (const uint8_t *)hdr, sizeof(hdr)))
+    {
+        return WICED_FALSE;
+    }
+
+    app_nv_active = next;
+    app_nv_seq++;
+    app_nv_tail = dst;
+    app_nv_stats.compact_count++;
+    APP_LOG(APP_LOG_ID_NV_COMPACT, next, dst);
+
+    return WICED_TRUE;
+}
+
+/* END OF FILE [] */
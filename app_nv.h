@@ -0,0 +1,134 @@
+/******************************************************************************
+* File Name:   app_nv.h
+*
+* Description: This file contains the declarations of the non-volatile record store
+*              that keeps per-peer data in a reserved flash region.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __APP_NV_H__
+#define __APP_NV_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_dev.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Bytes of flash used by the store. The area is split into sectors of the
+ * erase size of the flash block that holds it, read from the HAL at init.
+ * Records are appended to one sector; when it is full the live records are
+ * copied to the next one. The sectors are used in turn, so the store needs
+ * room for at least two and each is erased once every sector count changes.
+ * It must be a power of two so the reserved area is aligned to any smaller
+ * sector size */
+#ifndef APP_NV_SIZE
+#define APP_NV_SIZE                     (4096u)
+#endif
+
+/* Start address of the store. By default the store is an array reserved in
+ * the APP_NV_SECTION linker section, so the linker keeps code and data out
+ * of it. Set an address instead to use an area that the linker script
+ * leaves free */
+#ifndef APP_NV_START_ADDRESS
+#define APP_NV_START_ADDRESS            (0u)
+#endif
+
+/* Linker section of the reserved store: the emulated EEPROM area of the
+ * ModusToolbox linker scripts */
+#ifndef APP_NV_SECTION
+#define APP_NV_SECTION                  ".cy_em_eeprom"
+#endif
+
+/* Largest flash page size supported by the page buffer */
+#ifndef APP_NV_MAX_PAGE_SIZE
+#define APP_NV_MAX_PAGE_SIZE            (512u)
+#endif
+
+/* Largest payload of a record */
+#define APP_NV_MAX_DATA_LEN             (254u)
+
+#if ((APP_NV_SIZE & (APP_NV_SIZE - 1u)) != 0u)
+#error "APP_NV_SIZE must be a power of two"
+#endif
+
+/******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Kind of data held by a record. The values are stored in flash: add new
+ * types at the end and never reuse a value */
+typedef enum
+{
+    APP_NV_TYPE_CCCD = 1,               /* Client Characteristic Configuration values of a bonded peer */
+    APP_NV_TYPE_LINK_KEYS = 2,          /* Link keys of a bonded peer */
+    APP_NV_TYPE_LOCAL_KEYS = 3,         /* Local identity keys */
+    APP_NV_TYPE_BOND_LIST = 4,          /* Addresses of the bonded peers */
+} app_nv_type_t;
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Usage counters of the store */
+typedef struct
+{
+    uint32_t write_count;               /* Records appended */
+    uint32_t unchanged_count;           /* Writes skipped because the stored value was the same */
+    uint32_t compact_count;             /* Sector changes */
+    uint32_t fail_count;                /* Flash operations that failed */
+    uint32_t used_bytes;                /* Bytes used in the active sector */
+    uint32_t sector_size;               /* Bytes in a sector */
+} app_nv_stats_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_bool_t app_nv_init(void);
+
+wiced_bool_t app_nv_write(app_nv_type_t type, const wiced_bt_device_address_t bd_addr,
+                          const uint8_t *p_data, uint8_t len);
+
+uint8_t app_nv_read(app_nv_type_t type, const wiced_bt_device_address_t bd_addr,
+                    uint8_t *p_data, uint8_t max_len);
+
+wiced_bool_t app_nv_delete(app_nv_type_t type, const wiced_bt_device_address_t bd_addr);
+
+void app_nv_get_stats(app_nv_stats_t *p_stats);
+
+void app_nv_log_stats(void);
+
+#endif      /* __APP_NV_H__ */
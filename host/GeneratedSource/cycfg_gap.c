@@ -0,0 +1,70 @@
+/******************************************************************************
+* File Name:   cycfg_gap.c
+*
+* Description: Host copy of the GAP configuration generated from design.cybt by the
+*              Bluetooth Configurator.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cycfg_gap.h"
+
+/* Device address */
+wiced_bt_device_address_t cy_bt_device_address = {0x43, 0x01, 0x2C, 0x00, 0x1F, 0xAC};
+
+uint8_t cy_bt_adv_packet_elem_0[1] = { 0x06 };
+uint8_t cy_bt_adv_packet_elem_1[14] = { 0x46, 0x69, 0x6E, 0x64, 0x20, 0x4D, 0x65, 0x20, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74 };
+uint8_t cy_bt_adv_packet_elem_2[2] = { 0x02, 0x18 };
+wiced_bt_ble_advert_elem_t cy_bt_adv_packet_data[] =
+{
+    /* Flags */
+    {
+        .advert_type = BTM_BLE_ADVERT_TYPE_FLAG,
+        .len = 1,
+        .p_data = (uint8_t*)cy_bt_adv_packet_elem_0,
+    },
+    /* Complete local name */
+    {
+        .advert_type = BTM_BLE_ADVERT_TYPE_NAME_COMPLETE,
+        .len = 14,
+        .p_data = (uint8_t*)cy_bt_adv_packet_elem_1,
+    },
+    /* Complete list of 16-bit UUIDs available */
+    {
+        .advert_type = BTM_BLE_ADVERT_TYPE_16SRV_COMPLETE,
+        .len = 2,
+        .p_data = (uint8_t*)cy_bt_adv_packet_elem_2,
+    },
+};
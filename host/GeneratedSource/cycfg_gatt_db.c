@@ -0,0 +1,110 @@
+/******************************************************************************
+* File Name:   cycfg_gatt_db.c
+*
+* Description: Host copy of the GATT DB generated from design.cybt by the Bluetooth
+*              Configurator.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#include "cycfg_gatt_db.h"
+
+/*************************************************************************************
+* GATT server definitions
+*************************************************************************************/
+/* Attributes of the GATT DB, the host copy keeps them in a macro so that the
+ * length of the DB is known while the array has spare room */
+#define CY_BT_GATT_DB_ATTRIBUTES \
+    /* Primary Service: Generic Access */                                                         \
+    PRIMARY_SERVICE_UUID16 (HDLS_GAP, __UUID_SERVICE_GENERIC_ACCESS),                             \
+        /* Characteristic: Device Name */                                                         \
+        CHARACTERISTIC_UUID16 (HDLC_GAP_DEVICE_NAME, HDLC_GAP_DEVICE_NAME_VALUE,                  \
+            __UUID_CHARACTERISTIC_DEVICE_NAME, GATTDB_CHAR_PROP_READ, GATTDB_PERM_READABLE),      \
+        /* Characteristic: Appearance */                                                          \
+        CHARACTERISTIC_UUID16 (HDLC_GAP_APPEARANCE, HDLC_GAP_APPEARANCE_VALUE,                    \
+            __UUID_CHARACTERISTIC_APPEARANCE, GATTDB_CHAR_PROP_READ, GATTDB_PERM_READABLE),       \
+                                                                                                  \
+    /* Primary Service: Generic Attribute */                                                      \
+    PRIMARY_SERVICE_UUID16 (HDLS_GATT, __UUID_SERVICE_GENERIC_ATTRIBUTE),                         \
+        /* Characteristic: Service Changed */                                                     \
+        CHARACTERISTIC_UUID16 (HDLC_GATT_SERVICE_CHANGED, HDLC_GATT_SERVICE_CHANGED_VALUE,        \
+            __UUID_CHARACTERISTIC_SERVICE_CHANGED, GATTDB_CHAR_PROP_INDICATE, GATTDB_PERM_NONE),  \
+            /* Descriptor: Client Characteristic Configuration */                                 \
+            CHAR_DESCRIPTOR_UUID16_WRITABLE (HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG,        \
+                __UUID_DESCRIPTOR_CLIENT_CHARACTERISTIC_CONFIGURATION,                            \
+                GATTDB_PERM_READABLE | GATTDB_PERM_WRITE_REQ),                                    \
+                                                                                                  \
+    /* Primary Service: Immediate Alert */                                                        \
+    PRIMARY_SERVICE_UUID16 (HDLS_IAS, __UUID_SERVICE_IMMEDIATE_ALERT),                            \
+        /* Characteristic: Alert Level */                                                         \
+        CHARACTERISTIC_UUID16_WRITABLE (HDLC_IAS_ALERT_LEVEL, HDLC_IAS_ALERT_LEVEL_VALUE,         \
+            __UUID_CHARACTERISTIC_ALERT_LEVEL, GATTDB_CHAR_PROP_WRITE_NO_RESPONSE,                \
+            GATTDB_PERM_WRITE_CMD),
+
+uint8_t gatt_database[CY_BT_GATT_DB_CAPACITY] =
+{
+    CY_BT_GATT_DB_ATTRIBUTES
+};
+
+/* Length of the GATT DB */
+uint16_t gatt_database_len = sizeof((const uint8_t[]){ CY_BT_GATT_DB_ATTRIBUTES });
+
+/*************************************************************************************
+ * GATT Initial Value Arrays
+ ************************************************************************************/
+uint8_t app_gap_device_name[]                           = {'F', 'i', 'n', 'd', ' ', 'M', 'e', ' ', 'T', 'a',
+                                                           'r', 'g', 'e', 't', '\0', };
+uint8_t app_gap_appearance[]                            = {0x00, 0x00, };
+uint8_t app_gatt_service_changed[]                      = {0x00, 0x00, 0x00, 0x00, };
+uint8_t app_gatt_service_changed_client_char_config[]   = {0x00, 0x00, };
+uint8_t app_ias_alert_level[]                           = {0x00, };
+
+/*************************************************************************************
+ * GATT Lookup Table
+ ************************************************************************************/
+/* GATT attribute lookup table                                */
+/* (attributes externally referenced by GATT server database) */
+gatt_db_lookup_table_t app_gatt_db_ext_attr_tbl[CY_BT_GATT_DB_EXT_ATTR_CAPACITY] =
+{
+    /* { attribute handle,                          maxlen, curlen, attribute data } */
+    {HDLC_GAP_DEVICE_NAME_VALUE,                    14,     14,     app_gap_device_name},
+    {HDLC_GAP_APPEARANCE_VALUE,                     2,      2,      app_gap_appearance},
+    {HDLC_GATT_SERVICE_CHANGED_VALUE,               4,      4,      app_gatt_service_changed},
+    {HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG,  2,      2,      app_gatt_service_changed_client_char_config},
+    {HDLC_IAS_ALERT_LEVEL_VALUE,                    1,      1,      app_ias_alert_level},
+};
+
+/* Number of Lookup Table entries */
+uint16_t app_gatt_db_ext_attr_tbl_size = 5;
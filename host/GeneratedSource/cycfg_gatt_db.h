@@ -0,0 +1,118 @@
+/******************************************************************************
+* File Name:   cycfg_gatt_db.h
+*
+* Description: Host copy of the GATT DB definitions generated from design.cybt by the
+*              Bluetooth Configurator. The DB arrays have spare room so that host
+*              benchmarks can grow the database, see host_bench.c.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __CYCFG_GATT_DB_H__
+#define __CYCFG_GATT_DB_H__
+
+#include "wiced_bt_gatt.h"
+#include "wiced_bt_uuid.h"
+
+/* Service Generic Access */
+#define __UUID_SERVICE_GENERIC_ACCESS                             0x1800
+/* Characteristic Device Name */
+#define __UUID_CHARACTERISTIC_DEVICE_NAME                         0x2A00
+/* Characteristic Appearance */
+#define __UUID_CHARACTERISTIC_APPEARANCE                          0x2A01
+/* Service Generic Attribute */
+#define __UUID_SERVICE_GENERIC_ATTRIBUTE                          0x1801
+/* Characteristic Service Changed */
+#define __UUID_CHARACTERISTIC_SERVICE_CHANGED                     0x2A05
+/* Descriptor Client Characteristic Configuration */
+#define __UUID_DESCRIPTOR_CLIENT_CHARACTERISTIC_CONFIGURATION     0x2902
+/* Service Immediate Alert */
+#define __UUID_SERVICE_IMMEDIATE_ALERT                            0x1802
+/* Characteristic Alert Level */
+#define __UUID_CHARACTERISTIC_ALERT_LEVEL                         0x2A06
+
+/* Service Generic Access */
+#define HDLS_GAP                                                  0x0001
+/* Characteristic Device Name */
+#define HDLC_GAP_DEVICE_NAME                                      0x0002
+#define HDLC_GAP_DEVICE_NAME_VALUE                                0x0003
+/* Characteristic Appearance */
+#define HDLC_GAP_APPEARANCE                                       0x0004
+#define HDLC_GAP_APPEARANCE_VALUE                                 0x0005
+
+/* Service Generic Attribute */
+#define HDLS_GATT                                                 0x0006
+/* Characteristic Service Changed */
+#define HDLC_GATT_SERVICE_CHANGED                                 0x0007
+#define HDLC_GATT_SERVICE_CHANGED_VALUE                           0x0008
+/* Descriptor Client Characteristic Configuration */
+#define HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG              0x0009
+
+/* Service Immediate Alert */
+#define HDLS_IAS                                                  0x000A
+/* Characteristic Alert Level */
+#define HDLC_IAS_ALERT_LEVEL                                      0x000B
+#define HDLC_IAS_ALERT_LEVEL_VALUE                                0x000C
+
+/* Spare room of the host copy, in bytes of gatt_database and in entries of
+ * app_gatt_db_ext_attr_tbl */
+#ifndef CY_BT_GATT_DB_CAPACITY
+#define CY_BT_GATT_DB_CAPACITY                                    (16384u)
+#endif
+#ifndef CY_BT_GATT_DB_EXT_ATTR_CAPACITY
+#define CY_BT_GATT_DB_EXT_ATTR_CAPACITY                           (1024u)
+#endif
+
+/* External Lookup Table Entry */
+typedef struct
+{
+    uint16_t handle;
+    uint16_t max_len;
+    uint16_t cur_len;
+    uint8_t  *p_data;
+} gatt_db_lookup_table_t;
+
+/* External definitions */
+extern uint8_t  gatt_database[CY_BT_GATT_DB_CAPACITY];
+extern uint16_t gatt_database_len;
+extern gatt_db_lookup_table_t app_gatt_db_ext_attr_tbl[CY_BT_GATT_DB_EXT_ATTR_CAPACITY];
+extern uint16_t app_gatt_db_ext_attr_tbl_size;
+extern uint8_t app_gap_device_name[];
+extern uint8_t app_gap_appearance[];
+extern uint8_t app_gatt_service_changed[];
+extern uint8_t app_gatt_service_changed_client_char_config[];
+extern uint8_t app_ias_alert_level[];
+
+#endif      /* __CYCFG_GATT_DB_H__ */
@@ -0,0 +1,937 @@
+/******************************************************************************
+* File Name:   host_bench.c
+*
+* Description: Benchmarks of the host build. Each benchmark drives the application
+*              through the simulated stack and prints its cost per operation.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "wiced_bt_gatt.h"
+#include "cycfg_gatt_db.h"
+#include "app_gatt_db_index.h"
+#include "app_bt_conn.h"
+#include "app_bt_adv.h"
+#include "app_bt_adv_builder.h"
+#include "cy_utils.h"
+#include "host_sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_BENCH_DISPATCH_EVENTS      (1000000u)
+#define HOST_BENCH_LOOKUPS              (1000000u)
+#define HOST_BENCH_RECONNECTIONS        (100000u)
+#define HOST_BENCH_DISCOVERIES          (1000u)
+#define HOST_BENCH_ADV_REBUILDS         (1000000u)
+
+/* Type of the characteristic values added by the discovery benchmark:
+ * Battery Level, which is not in APP_GATT_DB_TYPE_INDEX_UUIDS */
+#define HOST_BENCH_UNINDEXED_UUID       (0x2A19u)
+
+/* Attributes added for each characteristic: declaration, value and CCCD */
+#define HOST_BENCH_ATTRS_PER_CHAR       (3u)
+#define HOST_BENCH_MAX_CHARS            (200u)
+
+/* Handles looked up by the lookup benchmark, cycled through */
+#define HOST_BENCH_LOOKUP_HANDLES       (4096u)
+
+/* Client of the benchmarks */
+#define HOST_BENCH_CONN_ID              (0x8001u)
+#define HOST_BENCH_MTU                  (247u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+typedef struct
+{
+    const char  *p_name;
+    int        (*p_run)(int argc, char **argv);
+    const char  *p_help;
+} host_bench_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int host_bench_dispatch(int argc, char **argv);
+static int host_bench_lookup(int argc, char **argv);
+static int host_bench_connections(int argc, char **argv);
+static uint32_t host_bench_check_links(uint8_t num_links);
+static int host_bench_discovery(int argc, char **argv);
+static uint16_t host_bench_add_chars(uint16_t num_chars);
+static uint32_t host_bench_discover(uint16_t uuid, uint8_t pair_len, uint32_t *p_requests);
+static int host_bench_adv_builder(int argc, char **argv);
+static void host_bench_adv_build(app_bt_adv_builder_t *p_builder, uint32_t counter);
+static gatt_db_lookup_table_t *host_bench_linear_find(uint16_t handle);
+static uint32_t host_bench_random(void);
+static uint64_t host_bench_now_ns(void);
+static uint32_t host_bench_arg(int argc, char **argv, int index, uint32_t def);
+static wiced_bool_t host_bench_connect(uint16_t conn_id, uint16_t mtu);
+static int host_bench_result(uint32_t errors);
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static uint32_t host_bench_seed = 1u;
+
+static const host_bench_t host_bench_table[] =
+{
+    { "dispatch", host_bench_dispatch, "[events]  GATT requests through le_app_gatt_event_callback" },
+    { "lookup",   host_bench_lookup,   "[lookups] attribute lookup by handle versus table size, index and linear scan" },
+    { "connections", host_bench_connections, "[cycles] APP_BT_MAX_CONNECTIONS concurrent links, then reconnections" },
+    { "discovery", host_bench_discovery, "[runs]    read-by-type discovery of 10 to 500 attribute databases" },
+    { "adv_builder", host_bench_adv_builder, "[rebuilds] advertising data rebuilds, builder and hand-assembled" },
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: host_bench_run
+********************************************************************************
+* Summary:
+*   Driver of the benchmarks: runs the benchmark named by the first argument,
+*   or lists the benchmarks for "list".
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Name of the benchmark and its arguments
+*
+* Return:
+*   int: 0 if the benchmark ran without error
+*
+*******************************************************************************/
+int host_bench_run(int argc, char **argv)
+{
+    uint8_t i;
+
+    if (0 == strcmp(argv[0], "list"))
+    {
+        host_bench_list();
+        return 0;
+    }
+
+    for (i = 0; i < (sizeof(host_bench_table) / sizeof(host_bench_table[0])); i++)
+    {
+        if (0 == strcmp(argv[0], host_bench_table[i].p_name))
+        {
+            return host_bench_table[i].p_run(argc, argv);
+        }
+    }
+
+    printf("Unknown benchmark %s\n", argv[0]);
+    host_bench_list();
+
+    return 2;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_list
+********************************************************************************
+* Summary:
+*   Prints the benchmarks and their arguments.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_bench_list(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < (sizeof(host_bench_table) / sizeof(host_bench_table[0])); i++)
+    {
+        printf("  %-16s %s\n", host_bench_table[i].p_name, host_bench_table[i].p_help);
+    }
+}
+
+/*******************************************************************************
+* Function Name: host_bench_dispatch
+********************************************************************************
+* Summary:
+*   Times the GATT dispatch path: a client alternates Write Commands to the
+*   IAS Alert Level, which update the alert LED, and Read Requests of the
+*   device name, which allocate and free a response buffer.
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Number of events
+*
+* Return:
+*   int: 0 if the application answered every request correctly
+*
+*******************************************************************************/
+static int host_bench_dispatch(int argc, char **argv)
+{
+    uint32_t events = host_bench_arg(argc, argv, 1, HOST_BENCH_DISPATCH_EVENTS);
+    wiced_bt_gatt_request_data_t write;
+    wiced_bt_gatt_request_data_t read;
+    uint8_t alert_level = 0;
+    uint32_t errors = 0;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t i;
+
+    if (!host_bench_connect(HOST_BENCH_CONN_ID, HOST_BENCH_MTU))
+    {
+        return host_bench_result(1);
+    }
+
+    memset(&write, 0, sizeof(write));
+    write.write_req.handle = HDLC_IAS_ALERT_LEVEL_VALUE;
+    write.write_req.val_len = sizeof(alert_level);
+    write.write_req.p_val = &alert_level;
+
+    memset(&read, 0, sizeof(read));
+    read.read_req.handle = HDLC_GAP_DEVICE_NAME_VALUE;
+
+    start = host_bench_now_ns();
+    for (i = 0; i < events; i += 2u)
+    {
+        alert_level = (uint8_t)((i / 2u) % 3u);
+        errors += (WICED_BT_GATT_SUCCESS != host_bt_stack_request(HOST_BENCH_CONN_ID, GATT_CMD_WRITE, &write));
+        errors += (WICED_BT_GATT_SUCCESS != host_bt_stack_request(HOST_BENCH_CONN_ID, GATT_REQ_READ, &read));
+    }
+    elapsed = host_bench_now_ns() - start;
+
+    if (GATT_RSP_READ != host_bt_stack_get_last_pdu()->opcode)
+    {
+        errors++;
+    }
+
+    printf("dispatch: %lu events in %.3f ms, %.1f ns/event, %.2f M events/s\n",
+           (unsigned long)i, (double)elapsed / 1e6, (double)elapsed / i, (i * 1e3) / (double)elapsed);
+
+    return host_bench_result(errors);
+}
+
+/*******************************************************************************
+* Function Name: host_bench_lookup
+********************************************************************************
+* Summary:
+*   Times the attribute lookup by handle of the read, write and read-by-type
+*   paths for lookup tables of 8 to APP_GATT_DB_INDEX_MAX_ATTRS entries: the
+*   handle index of app_gatt_db_index_find() against the linear scan it
+*   replaced. The tables are filled with attributes of every other handle,
+*   in reverse order, and looked up at random handles that exist.
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Number of lookups per table size
+*
+* Return:
+*   int: 0 if both lookups found every attribute
+*
+*******************************************************************************/
+static int host_bench_lookup(int argc, char **argv)
+{
+    static gatt_db_lookup_table_t saved_tbl[CY_BT_GATT_DB_EXT_ATTR_CAPACITY];
+    static uint16_t handles[HOST_BENCH_LOOKUP_HANDLES];
+    uint32_t lookups = host_bench_arg(argc, argv, 1, HOST_BENCH_LOOKUPS);
+    uint16_t saved_size = app_gatt_db_ext_attr_tbl_size;
+    gatt_db_lookup_table_t *volatile p_found;
+    uint32_t errors = 0;
+    uint64_t start;
+    uint64_t index_ns;
+    uint64_t linear_ns;
+    uint32_t size;
+    uint32_t i;
+
+    memcpy(saved_tbl, app_gatt_db_ext_attr_tbl, sizeof(saved_tbl));
+
+    printf("lookup: %lu lookups per size\n", (unsigned long)lookups);
+    printf("%8s %14s %14s\n", "entries", "index ns", "linear ns");
+
+    for (size = 8u; size <= MIN(APP_GATT_DB_INDEX_MAX_ATTRS, CY_BT_GATT_DB_EXT_ATTR_CAPACITY); size *= 2u)
+    {
+        for (i = 0; i < size; i++)
+        {
+            app_gatt_db_ext_attr_tbl[i] = saved_tbl[0];
+            app_gatt_db_ext_attr_tbl[i].handle = (uint16_t)(2u * (size - i));
+        }
+        app_gatt_db_ext_attr_tbl_size = (uint16_t)size;
+        if (!app_gatt_db_index_init())
+        {
+            errors++;
+            break;
+        }
+
+        for (i = 0; i < HOST_BENCH_LOOKUP_HANDLES; i++)
+        {
+            handles[i] = (uint16_t)(2u * (1u + (host_bench_random() % size)));
+        }
+
+        start = host_bench_now_ns();
+        for (i = 0; i < lookups; i++)
+        {
+            p_found = app_gatt_db_index_find(handles[i % HOST_BENCH_LOOKUP_HANDLES]);
+            errors += (NULL == p_found);
+        }
+        index_ns = host_bench_now_ns() - start;
+
+        start = host_bench_now_ns();
+        for (i = 0; i < lookups; i++)
+        {
+            p_found = host_bench_linear_find(handles[i % HOST_BENCH_LOOKUP_HANDLES]);
+            errors += (NULL == p_found);
+        }
+        linear_ns = host_bench_now_ns() - start;
+
+        printf("%8lu %14.1f %14.1f\n", (unsigned long)size, (double)index_ns / lookups,
+               (double)linear_ns / lookups);
+    }
+
+    memcpy(app_gatt_db_ext_attr_tbl, saved_tbl, sizeof(saved_tbl));
+    app_gatt_db_ext_attr_tbl_size = saved_size;
+    (void)app_gatt_db_index_init();
+
+    return host_bench_result(errors);
+}
+
+/*******************************************************************************
+* Function Name: host_bench_connections
+********************************************************************************
+* Summary:
+*   Drives APP_BT_MAX_CONNECTIONS concurrent links through
+*   le_app_connect_handler and checks the connection table: advertising
+*   continues while slots remain and a client beyond them is refused, each
+*   link keeps its own MTU and alert level, and a slot freed by a
+*   disconnection is first offered to the client that left, then to any
+*   client once the directed window ends. Then times the disconnection and
+*   directed reconnection of one client with the other links up.
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Number of reconnections
+*
+* Return:
+*   int: 0 if the connection table behaved as described
+*
+*******************************************************************************/
+static int host_bench_connections(int argc, char **argv)
+{
+    uint32_t cycles = host_bench_arg(argc, argv, 1, HOST_BENCH_RECONNECTIONS);
+    wiced_bt_device_address_t bd_addr = { 0x00, 0xA0, 0x50, 0x00, 0x00, 0x00 };
+    wiced_bt_gatt_request_data_t req;
+    uint16_t extra_conn_id = HOST_BENCH_CONN_ID + APP_BT_MAX_CONNECTIONS;
+    uint8_t alert_level;
+    uint32_t errors = 0;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t i;
+
+    if (APP_BT_MAX_CONNECTIONS >= HOST_BT_STACK_MAX_LINKS)
+    {
+        printf("The simulated stack has %u links, %u needed\n", HOST_BT_STACK_MAX_LINKS,
+               APP_BT_MAX_CONNECTIONS + 1u);
+        return host_bench_result(1);
+    }
+
+    /* Fill the table, each client with its own MTU and alert level */
+    for (i = 0; i < APP_BT_MAX_CONNECTIONS; i++)
+    {
+        if (!host_bench_connect((uint16_t)(HOST_BENCH_CONN_ID + i), (uint16_t)(GATT_DEF_BLE_MTU_SIZE + i)))
+        {
+            errors++;
+            continue;
+        }
+
+        alert_level = (uint8_t)(i % 3u);
+        memset(&req, 0, sizeof(req));
+        req.write_req.handle = HDLC_IAS_ALERT_LEVEL_VALUE;
+        req.write_req.val_len = sizeof(alert_level);
+        req.write_req.p_val = &alert_level;
+        (void)host_bt_stack_request((uint16_t)(HOST_BENCH_CONN_ID + i), GATT_CMD_WRITE, &req);
+    }
+    errors += host_bench_check_links(APP_BT_MAX_CONNECTIONS);
+
+    /* The table is full: advertising stopped and the next client is refused */
+    bd_addr[4] = (uint8_t)(extra_conn_id >> 8);
+    bd_addr[5] = (uint8_t)extra_conn_id;
+    if (host_bt_stack_connect(extra_conn_id, bd_addr, BLE_ADDR_PUBLIC))
+    {
+        printf("Client beyond the %u slots connected\n", APP_BT_MAX_CONNECTIONS);
+        errors++;
+    }
+
+    /* The slot of the first client is kept for it during the directed
+     * window, then offered to anyone */
+    (void)host_bt_stack_disconnect(HOST_BENCH_CONN_ID, GATT_CONN_TIMEOUT);
+    if (host_bt_stack_connect(extra_conn_id, bd_addr, BLE_ADDR_PUBLIC))
+    {
+        printf("Another client took the slot during the directed window\n");
+        errors++;
+        (void)host_bt_stack_disconnect(extra_conn_id, GATT_CONN_TERMINATE_PEER_USER);
+    }
+    host_bt_stack_advance(APP_BT_ADV_DIRECTED_WINDOW_MS);
+    if (!host_bt_stack_connect(extra_conn_id, bd_addr, BLE_ADDR_PUBLIC))
+    {
+        printf("No client could take the free slot after the directed window\n");
+        errors++;
+    }
+    if (APP_BT_MAX_CONNECTIONS != app_bt_conn_count())
+    {
+        errors++;
+    }
+
+    /* Reconnections of the last client with the other links up */
+    bd_addr[4] = (uint8_t)(extra_conn_id >> 8);
+    bd_addr[5] = (uint8_t)extra_conn_id;
+    start = host_bench_now_ns();
+    for (i = 0; i < cycles; i++)
+    {
+        errors += !host_bt_stack_disconnect(extra_conn_id, GATT_CONN_TIMEOUT);
+        errors += !host_bt_stack_connect(extra_conn_id, bd_addr, BLE_ADDR_PUBLIC);
+    }
+    elapsed = host_bench_now_ns() - start;
+
+    if (APP_BT_MAX_CONNECTIONS != app_bt_conn_count())
+    {
+        errors++;
+    }
+
+    printf("connections: %u links, %lu reconnections in %.3f ms, %.1f ns/reconnection\n",
+           APP_BT_MAX_CONNECTIONS, (unsigned long)cycles, (double)elapsed / 1e6,
+           (0u != cycles) ? ((double)elapsed / cycles) : 0.0);
+
+    /* Everyone leaves */
+    for (i = 1; i <= APP_BT_MAX_CONNECTIONS; i++)
+    {
+        errors += !host_bt_stack_disconnect((uint16_t)(HOST_BENCH_CONN_ID + i), GATT_CONN_TERMINATE_PEER_USER);
+    }
+    if ((0u != app_bt_conn_count()) || (0u != app_bt_conn_get_max_alert_level()))
+    {
+        errors++;
+    }
+
+    return host_bench_result(errors);
+}
+
+/*******************************************************************************
+* Function Name: host_bench_check_links
+********************************************************************************
+* Summary:
+*   Checks the connection table against the links the connections benchmark
+*   opened: link i has the MTU GATT_DEF_BLE_MTU_SIZE + i and the alert level
+*   i % 3.
+*
+* Parameters:
+*   uint8_t num_links: Number of links opened
+*
+* Return:
+*   uint32_t: Number of differences
+*
+*******************************************************************************/
+static uint32_t host_bench_check_links(uint8_t num_links)
+{
+    app_bt_conn_t *p_conn;
+    uint8_t max_alert_level = 0;
+    uint32_t errors = 0;
+    uint8_t i;
+
+    for (i = 0; i < num_links; i++)
+    {
+        p_conn = app_bt_conn_find((uint16_t)(HOST_BENCH_CONN_ID + i));
+        if ((NULL == p_conn) || (p_conn->mtu != (GATT_DEF_BLE_MTU_SIZE + i)) || (p_conn->alert_level != (i % 3u)))
+        {
+            printf("Link %u not in the connection table as opened\n", i);
+            errors++;
+        }
+        max_alert_level = MAX(max_alert_level, (uint8_t)(i % 3u));
+    }
+
+    if ((num_links != app_bt_conn_count()) || (max_alert_level != app_bt_conn_get_max_alert_level()))
+    {
+        printf("%u links in the connection table, %u expected\n", app_bt_conn_count(), num_links);
+        errors++;
+    }
+
+    return errors;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_discovery
+********************************************************************************
+* Summary:
+*   Times the discovery of all attributes of a type with Read By Type
+*   requests, as a client discovers the CCCDs or reads a characteristic by
+*   UUID, for GATT databases of about 10 to 500 attributes. The database is
+*   grown with characteristics of a type missing from the type index, each
+*   with a CCCD, an indexed type. Discovering the CCCDs walks the type index;
+*   discovering the values walks the GATT DB as every type did before the
+*   index, and is the baseline.
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Number of discoveries per database size and type
+*
+* Return:
+*   int: 0 if every discovery found every attribute of its type
+*
+*******************************************************************************/
+static int host_bench_discovery(int argc, char **argv)
+{
+    static const uint16_t sizes[] = { 10u, 50u, 100u, 250u, 500u };
+    uint32_t runs = host_bench_arg(argc, argv, 1, HOST_BENCH_DISCOVERIES);
+    uint16_t saved_db_len = gatt_database_len;
+    uint16_t saved_tbl_size = app_gatt_db_ext_attr_tbl_size;
+    uint16_t base_attrs = app_gatt_db_ext_attr_tbl[saved_tbl_size - 1u].handle;
+    uint16_t num_chars;
+    uint32_t indexed_requests = 0;
+    uint32_t walked_requests = 0;
+    uint32_t errors = 0;
+    uint64_t start;
+    uint64_t indexed_ns;
+    uint64_t walked_ns;
+    uint32_t i;
+    uint8_t s;
+
+    if (!host_bench_connect(HOST_BENCH_CONN_ID, GATT_DEF_BLE_MTU_SIZE))
+    {
+        return host_bench_result(1);
+    }
+
+    printf("discovery: %lu runs per size, ATT_MTU %u\n", (unsigned long)runs, GATT_DEF_BLE_MTU_SIZE);
+    printf("%6s %8s %12s %10s %12s %10s\n", "attrs", "chars", "indexed us", "requests", "walked us", "requests");
+
+    for (s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        num_chars = (sizes[s] > base_attrs) ?
+                    (uint16_t)((sizes[s] - base_attrs + HOST_BENCH_ATTRS_PER_CHAR - 1u) / HOST_BENCH_ATTRS_PER_CHAR) : 0u;
+        gatt_database_len = saved_db_len;
+        app_gatt_db_ext_attr_tbl_size = saved_tbl_size;
+        if (num_chars != host_bench_add_chars(num_chars))
+        {
+            errors++;
+            break;
+        }
+
+        start = host_bench_now_ns();
+        for (i = 0; i < runs; i++)
+        {
+            errors += (num_chars + 1u) != host_bench_discover(GATT_UUID_CHAR_CLIENT_CONFIG, 4u, &indexed_requests);
+        }
+        indexed_ns = host_bench_now_ns() - start;
+
+        start = host_bench_now_ns();
+        for (i = 0; i < runs; i++)
+        {
+            errors += num_chars != host_bench_discover(HOST_BENCH_UNINDEXED_UUID, 3u, &walked_requests);
+        }
+        walked_ns = host_bench_now_ns() - start;
+
+        printf("%6u %8u %12.2f %10lu %12.2f %10lu\n", base_attrs + (HOST_BENCH_ATTRS_PER_CHAR * num_chars),
+               num_chars, (double)indexed_ns / runs / 1e3, (unsigned long)(indexed_requests / runs),
+               (double)walked_ns / runs / 1e3, (unsigned long)(walked_requests / runs));
+        indexed_requests = 0;
+        walked_requests = 0;
+    }
+
+    gatt_database_len = saved_db_len;
+    app_gatt_db_ext_attr_tbl_size = saved_tbl_size;
+    (void)wiced_bt_gatt_db_init(gatt_database, gatt_database_len, NULL);
+    (void)app_gatt_db_index_init();
+
+    return host_bench_result(errors);
+}
+
+/*******************************************************************************
+* Function Name: host_bench_add_chars
+********************************************************************************
+* Summary:
+*   Appends characteristics of type HOST_BENCH_UNINDEXED_UUID, each with a
+*   CCCD, to the GATT DB and the lookup table, then initializes the GATT DB
+*   and the index again.
+*
+* Parameters:
+*   uint16_t num_chars: Number of characteristics
+*
+* Return:
+*   uint16_t: Number of characteristics added, less if the GATT DB, the
+*             lookup table or the index is full
+*
+*******************************************************************************/
+static uint16_t host_bench_add_chars(uint16_t num_chars)
+{
+    static uint8_t values[HOST_BENCH_MAX_CHARS];
+    static uint8_t cccds[HOST_BENCH_MAX_CHARS][2];
+    uint16_t handle = app_gatt_db_ext_attr_tbl[app_gatt_db_ext_attr_tbl_size - 1u].handle + 1u;
+    uint16_t i;
+
+    for (i = 0; i < MIN(num_chars, HOST_BENCH_MAX_CHARS); i++, handle += HOST_BENCH_ATTRS_PER_CHAR)
+    {
+        const uint8_t attrs[] =
+        {
+            CHARACTERISTIC_UUID16(handle, handle + 1u, HOST_BENCH_UNINDEXED_UUID,
+                                  GATTDB_CHAR_PROP_READ | GATTDB_CHAR_PROP_NOTIFY, GATTDB_PERM_READABLE),
+            CHAR_DESCRIPTOR_UUID16_WRITABLE(handle + 2u, GATT_UUID_CHAR_CLIENT_CONFIG,
+                                            GATTDB_PERM_READABLE | GATTDB_PERM_WRITE_REQ),
+        };
+
+        if (((gatt_database_len + sizeof(attrs)) > CY_BT_GATT_DB_CAPACITY) ||
+            ((app_gatt_db_ext_attr_tbl_size + 2u) > CY_BT_GATT_DB_EXT_ATTR_CAPACITY))
+        {
+            break;
+        }
+
+        memcpy(&gatt_database[gatt_database_len], attrs, sizeof(attrs));
+        gatt_database_len += sizeof(attrs);
+
+        values[i] = (uint8_t)i;
+        app_gatt_db_ext_attr_tbl[app_gatt_db_ext_attr_tbl_size++] =
+            (gatt_db_lookup_table_t){ handle + 1u, sizeof(values[i]), sizeof(values[i]), &values[i] };
+        app_gatt_db_ext_attr_tbl[app_gatt_db_ext_attr_tbl_size++] =
+            (gatt_db_lookup_table_t){ handle + 2u, sizeof(cccds[i]), sizeof(cccds[i]), cccds[i] };
+    }
+
+    (void)wiced_bt_gatt_db_init(gatt_database, gatt_database_len, NULL);
+    if (!app_gatt_db_index_init())
+    {
+        return 0;
+    }
+
+    return i;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_discover
+********************************************************************************
+* Summary:
+*   Discovers all attributes of a type: Read By Type requests over the whole
+*   handle range, each starting after the last handle found, until the
+*   server answers Attribute Not Found.
+*
+* Parameters:
+*   uint16_t uuid       : Attribute type
+*   uint8_t pair_len    : Length of the handle-value pairs of the type
+*   uint32_t *p_requests: Incremented for each request
+*
+* Return:
+*   uint32_t: Number of attributes found
+*
+*******************************************************************************/
+static uint32_t host_bench_discover(uint16_t uuid, uint8_t pair_len, uint32_t *p_requests)
+{
+    const host_bt_stack_pdu_t *p_pdu = host_bt_stack_get_last_pdu();
+    wiced_bt_gatt_request_data_t req;
+    uint32_t found = 0;
+
+    memset(&req, 0, sizeof(req));
+    req.read_by_type.s_handle = 1u;
+    req.read_by_type.e_handle = 0xFFFFu;
+    req.read_by_type.uuid.len = LEN_UUID_16;
+    req.read_by_type.uuid.uu.uuid16 = uuid;
+
+    for (;;)
+    {
+        (*p_requests)++;
+        (void)host_bt_stack_request(HOST_BENCH_CONN_ID, GATT_REQ_READ_BY_TYPE, &req);
+        if ((GATT_RSP_READ_BY_TYPE != p_pdu->opcode) || (0u != (p_pdu->len % pair_len)))
+        {
+            break;
+        }
+
+        found += p_pdu->len / pair_len;
+        req.read_by_type.s_handle = (uint16_t)(p_pdu->data[p_pdu->len - pair_len] |
+                                               (p_pdu->data[p_pdu->len - pair_len + 1u] << 8)) + 1u;
+    }
+
+    return found;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_adv_builder
+********************************************************************************
+* Summary:
+*   Times the rebuild of the Find Me advertising data with a changing
+*   manufacturer field: built with the advertising data builder alone, built
+*   and committed to the stack, and, as the baseline, hand-assembled AD
+*   structures patched in place and handed to the stack as the generated
+*   cy_bt_adv_packet_data is.
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Number of rebuilds
+*
+* Return:
+*   int: 0 if every rebuild fitted and was accepted
+*
+*******************************************************************************/
+static int host_bench_adv_builder(int argc, char **argv)
+{
+    static app_bt_adv_builder_t builder;
+    static uint8_t flags = BTM_BLE_GENERAL_DISCOVERABLE_FLAG | BTM_BLE_BREDR_NOT_SUPPORTED;
+    static uint8_t name[] = "Find Me Target";
+    static uint8_t uuids[] = { 0x02, 0x18 };
+    static uint8_t manufacturer[6];
+    static wiced_bt_ble_advert_elem_t elems[] =
+    {
+        { .advert_type = BTM_BLE_ADVERT_TYPE_FLAG, .len = sizeof(flags), .p_data = &flags },
+        { .advert_type = BTM_BLE_ADVERT_TYPE_NAME_COMPLETE, .len = sizeof(name) - 1u, .p_data = name },
+        { .advert_type = BTM_BLE_ADVERT_TYPE_16SRV_COMPLETE, .len = sizeof(uuids), .p_data = uuids },
+        { .advert_type = BTM_BLE_ADVERT_TYPE_MANUFACTURER, .len = sizeof(manufacturer), .p_data = manufacturer },
+    };
+    uint32_t rebuilds = host_bench_arg(argc, argv, 1, HOST_BENCH_ADV_REBUILDS);
+    uint32_t errors = 0;
+    uint64_t start;
+    uint64_t build_ns;
+    uint64_t commit_ns;
+    uint64_t manual_ns;
+    uint32_t i;
+
+    app_bt_adv_builder_init(&builder);
+
+    start = host_bench_now_ns();
+    for (i = 0; i < rebuilds; i++)
+    {
+        host_bench_adv_build(&builder, i);
+    }
+    build_ns = host_bench_now_ns() - start;
+    errors += builder.overflow;
+
+    start = host_bench_now_ns();
+    for (i = 0; i < rebuilds; i++)
+    {
+        host_bench_adv_build(&builder, i);
+        errors += (WICED_BT_SUCCESS != app_bt_adv_builder_commit(&builder));
+    }
+    commit_ns = host_bench_now_ns() - start;
+
+    start = host_bench_now_ns();
+    for (i = 0; i < rebuilds; i++)
+    {
+        manufacturer[0] = 0x31;
+        manufacturer[1] = 0x01;
+        memcpy(&manufacturer[2], &i, sizeof(i));
+        errors += (WICED_BT_SUCCESS !=
+                   wiced_bt_ble_set_raw_advertisement_data(sizeof(elems) / sizeof(elems[0]), elems));
+    }
+    manual_ns = host_bench_now_ns() - start;
+
+    printf("adv_builder: %lu rebuilds of %u bytes, build %.1f ns, build and commit %.1f ns, "
+           "hand-assembled %.1f ns\n", (unsigned long)rebuilds, app_bt_adv_builder_get_len(&builder),
+           (double)build_ns / rebuilds, (double)commit_ns / rebuilds, (double)manual_ns / rebuilds);
+
+    return host_bench_result(errors);
+}
+
+/*******************************************************************************
+* Function Name: host_bench_adv_build
+********************************************************************************
+* Summary:
+*   Builds the advertising data of the adv_builder benchmark.
+*
+* Parameters:
+*   app_bt_adv_builder_t *p_builder: Builder
+*   uint32_t counter               : Manufacturer data
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_bench_adv_build(app_bt_adv_builder_t *p_builder, uint32_t counter)
+{
+    static const uint16_t uuid = 0x1802u;
+
+    app_bt_adv_builder_begin(p_builder);
+    (void)app_bt_adv_builder_add_flags(p_builder, BTM_BLE_GENERAL_DISCOVERABLE_FLAG | BTM_BLE_BREDR_NOT_SUPPORTED);
+    (void)app_bt_adv_builder_add_name(p_builder, "Find Me Target");
+    (void)app_bt_adv_builder_add_uuid16(p_builder, &uuid, 1u);
+    (void)app_bt_adv_builder_add_manufacturer(p_builder, 0x0131u, (const uint8_t *)&counter, sizeof(counter));
+}
+
+/*******************************************************************************
+* Function Name: host_bench_linear_find
+********************************************************************************
+* Summary:
+*   Baseline of the lookup benchmark: the linear scan of
+*   app_gatt_db_ext_attr_tbl that le_app_find_by_handle() used before the
+*   handle index.
+*
+* Parameters:
+*   uint16_t handle: Attribute handle
+*
+* Return:
+*   gatt_db_lookup_table_t*: Lookup table entry, NULL if there is none
+*
+*******************************************************************************/
+static gatt_db_lookup_table_t *host_bench_linear_find(uint16_t handle)
+{
+    uint16_t i;
+
+    for (i = 0; i < app_gatt_db_ext_attr_tbl_size; i++)
+    {
+        if (handle == app_gatt_db_ext_attr_tbl[i].handle)
+        {
+            return &app_gatt_db_ext_attr_tbl[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_now_ns
+********************************************************************************
+* Summary:
+*   Reads the monotonic clock of the host.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint64_t: Time in nanoseconds
+*
+*******************************************************************************/
+static uint64_t host_bench_now_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_random
+********************************************************************************
+* Summary:
+*   Returns a pseudo-random number, the same sequence on every run.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint32_t: Pseudo-random number
+*
+*******************************************************************************/
+static uint32_t host_bench_random(void)
+{
+    host_bench_seed ^= host_bench_seed << 13;
+    host_bench_seed ^= host_bench_seed >> 17;
+    host_bench_seed ^= host_bench_seed << 5;
+
+    return host_bench_seed;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_arg
+********************************************************************************
+* Summary:
+*   Returns a numeric argument of a benchmark.
+*
+* Parameters:
+*   int argc     : Number of arguments
+*   char **argv  : Arguments
+*   int index    : Index of the argument
+*   uint32_t def : Value if the argument is not given
+*
+* Return:
+*   uint32_t: Value of the argument
+*
+*******************************************************************************/
+static uint32_t host_bench_arg(int argc, char **argv, int index, uint32_t def)
+{
+    return (index < argc) ? (uint32_t)strtoul(argv[index], NULL, 0) : def;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_connect
+********************************************************************************
+* Summary:
+*   Connects a client and exchanges the MTU.
+*
+* Parameters:
+*   uint16_t conn_id: Connection ID of the client, also used for its address
+*   uint16_t mtu    : MTU of the client
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the client connected
+*
+*******************************************************************************/
+static wiced_bool_t host_bench_connect(uint16_t conn_id, uint16_t mtu)
+{
+    wiced_bt_device_address_t bd_addr = { 0x00, 0xA0, 0x50, 0x00, (uint8_t)(conn_id >> 8), (uint8_t)conn_id };
+    wiced_bt_gatt_request_data_t req;
+
+    if (!host_bt_stack_connect(conn_id, bd_addr, BLE_ADDR_PUBLIC))
+    {
+        printf("Client 0x%04x could not connect\n", conn_id);
+        return WICED_FALSE;
+    }
+
+    memset(&req, 0, sizeof(req));
+    req.remote_mtu = mtu;
+    (void)host_bt_stack_request(conn_id, GATT_REQ_MTU, &req);
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_bench_result
+********************************************************************************
+* Summary:
+*   Reports the errors of a benchmark.
+*
+* Parameters:
+*   uint32_t errors: Errors seen by the benchmark
+*
+* Return:
+*   int: Exit status, 0 if neither the benchmark nor the simulated stack saw
+*        an error
+*
+*******************************************************************************/
+static int host_bench_result(uint32_t errors)
+{
+    errors += host_bt_stack_get_error_count();
+    if (0u != errors)
+    {
+        printf("%lu errors\n", (unsigned long)errors);
+    }
+
+    return (0u == errors) ? 0 : 1;
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,2255 @@
+/******************************************************************************
+* File Name:   host_bt_stack.c
+*
+* Description: Simulated AIROC(TM) BTSTACK of the host build. It delivers the management
+*              and GATT events a client and the controller would cause, in the order and
+*              on the thread the stack delivers them, answers the calls of the application
+*              and checks and prints the PDUs the GATT server sends. Events the stack
+*              reports asynchronously are queued and delivered by host_bt_stack_pump(),
+*              after the callback that caused them returns.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "wiced_bt_stack.h"
+#include "wiced_bt_ble.h"
+#include "wiced_bt_gatt.h"
+#include "wiced_bt_l2c.h"
+#include "wiced_timer.h"
+#include "cy_utils.h"
+#include "host_sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_BT_STACK_EVT_QUEUE_SIZE    (64u)
+#define HOST_BT_STACK_MAX_ADV_LEN       (31u)
+#define HOST_BT_STACK_MAX_EXT_ADV_SETS  (4u)
+#define HOST_BT_STACK_MAX_DUMP_LEN      (32u)
+
+/* Largest link layer payload and time the simulated controller accepts */
+#define HOST_BT_STACK_MAX_RX_OCTETS     (251u)
+#define HOST_BT_STACK_MAX_RX_TIME       (2120u)
+
+/*******************************************************************************
+* Enumerations
+*******************************************************************************/
+typedef enum
+{
+    HOST_BT_STACK_EVT_MGMT,
+    HOST_BT_STACK_EVT_GATT,
+    HOST_BT_STACK_EVT_SERIALIZED,
+} host_bt_stack_evt_kind_t;
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Queued event. Events whose data points to a peer address point to bd_addr */
+typedef struct
+{
+    host_bt_stack_evt_kind_t    kind;
+    uint8_t                     event;
+    wiced_bt_device_address_t   bd_addr;
+    union
+    {
+        wiced_bt_management_evt_data_t  mgmt;
+        wiced_bt_gatt_event_data_t      gatt;
+        struct
+        {
+            wiced_bt_serialized_app_func_t  fn;
+            void                           *p_data;
+        } serialized;
+    } data;
+} host_bt_stack_evt_t;
+
+typedef struct
+{
+    wiced_bool_t                connected;
+    uint16_t                    conn_id;
+    wiced_bt_device_address_t   bd_addr;
+    wiced_bt_ble_address_type_t addr_type;
+    uint16_t                    mtu;
+    wiced_bool_t                rsp_pending;        /* A request waits for its response */
+    wiced_bool_t                ind_pending;        /* An indication waits for its confirmation */
+    wiced_bool_t                congested;
+} host_bt_stack_link_t;
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+static wiced_bt_management_cback_t     *host_bt_stack_mgmt_cback;
+static wiced_bt_gatt_cback_t           *host_bt_stack_gatt_cback;
+static const uint8_t                   *host_bt_stack_db;
+static uint32_t                         host_bt_stack_db_len;
+
+static wiced_bt_device_address_t        host_bt_stack_local_bda;
+static wiced_bt_ble_advert_mode_t       host_bt_stack_adv_mode = BTM_BLE_ADVERT_OFF;
+static wiced_bt_device_address_t        host_bt_stack_adv_peer;
+static wiced_bt_ble_ext_adv_event_property_t host_bt_stack_ext_adv_props[HOST_BT_STACK_MAX_EXT_ADV_SETS];
+static uint8_t                          host_bt_stack_ext_adv_enabled;  /* One bit per set */
+
+static host_bt_stack_evt_t              host_bt_stack_evt_queue[HOST_BT_STACK_EVT_QUEUE_SIZE];
+static uint32_t                         host_bt_stack_evt_head;
+static uint32_t                         host_bt_stack_evt_tail;
+
+static wiced_timer_t                   *host_bt_stack_timers;
+static host_bt_stack_link_t             host_bt_stack_links[HOST_BT_STACK_MAX_LINKS];
+static host_bt_stack_pdu_t              host_bt_stack_last_pdu;
+static uint32_t                         host_bt_stack_pdu_count;
+static uint32_t                         host_bt_stack_error_count;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void host_bt_stack_print(const char *p_fmt, ...) __attribute__((format(printf, 1, 2)));
+static void host_bt_stack_error(const char *p_fmt, ...) __attribute__((format(printf, 1, 2)));
+static host_bt_stack_link_t *host_bt_stack_find_link(uint16_t conn_id);
+static host_bt_stack_link_t *host_bt_stack_find_link_by_bda(const wiced_bt_device_address_t bd_addr);
+static host_bt_stack_evt_t *host_bt_stack_queue(host_bt_stack_evt_kind_t kind, uint8_t event);
+static void host_bt_stack_deliver(host_bt_stack_evt_t *p_evt);
+static wiced_result_t host_bt_stack_deliver_mgmt(uint8_t event, wiced_bt_management_evt_data_t *p_data);
+static wiced_bt_gatt_status_t host_bt_stack_send(uint16_t conn_id, uint8_t opcode, uint16_t handle,
+                                                 const uint8_t *p_hdr, uint16_t hdr_len,
+                                                 const uint8_t *p_data, uint16_t len,
+                                                 uint8_t *p_app_data, void *p_app_ctxt);
+static void host_bt_stack_unlink_timer(wiced_timer_t *p_timer);
+static const char *host_bt_stack_opcode_name(uint8_t opcode);
+
+/*******************************************************************************
+* Function Definitions: stack
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: wiced_bt_stack_init
+********************************************************************************
+* Summary:
+*   Registers the management callback. The stack is enabled, and
+*   BTM_ENABLED_EVT delivered, once the scheduler starts.
+*
+* Parameters:
+*   wiced_bt_management_cback_t *p_bt_management_cback: Management callback
+*   const wiced_bt_cfg_settings_t *p_bt_cfg_settings  : Stack settings
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_stack_init(wiced_bt_management_cback_t *p_bt_management_cback,
+                                   const wiced_bt_cfg_settings_t *p_bt_cfg_settings)
+{
+    CY_UNUSED_PARAMETER(p_bt_cfg_settings);
+
+    host_bt_stack_mgmt_cback = p_bt_management_cback;
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_app_serialize_function
+********************************************************************************
+* Summary:
+*   Runs a function of the application on the stack thread, once the
+*   current event has been handled.
+*
+* Parameters:
+*   wiced_bt_serialized_app_func_t fn: Function to run
+*   void *data                       : Argument of the function
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE
+*
+*******************************************************************************/
+wiced_bool_t wiced_bt_app_serialize_function(wiced_bt_serialized_app_func_t fn, void *data)
+{
+    host_bt_stack_evt_t *p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_SERIALIZED, 0);
+
+    p_evt->data.serialized.fn = fn;
+    p_evt->data.serialized.p_data = data;
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Definitions: device management
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: wiced_bt_set_local_bdaddr
+********************************************************************************
+* Summary:
+*   Sets the address of the device.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr        : Address
+*   wiced_bt_ble_address_type_t addr_type    : Not used
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_set_local_bdaddr(wiced_bt_device_address_t bd_addr,
+                                         wiced_bt_ble_address_type_t addr_type)
+{
+    CY_UNUSED_PARAMETER(addr_type);
+
+    memcpy(host_bt_stack_local_bda, bd_addr, BD_ADDR_LEN);
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_dev_read_local_addr
+********************************************************************************
+* Summary:
+*   Returns the address of the device.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr: Set to the address
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void wiced_bt_dev_read_local_addr(wiced_bt_device_address_t bd_addr)
+{
+    memcpy(bd_addr, host_bt_stack_local_bda, BD_ADDR_LEN);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_set_pairable_mode
+********************************************************************************
+* Summary:
+*   Accepts or rejects pairing. Pairing is always started by the driver.
+*
+* Parameters:
+*   uint8_t allow_pairing       : Not used
+*   uint8_t connect_only_paired : Not used
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void wiced_bt_set_pairable_mode(uint8_t allow_pairing, uint8_t connect_only_paired)
+{
+    CY_UNUSED_PARAMETER(allow_pairing);
+    CY_UNUSED_PARAMETER(connect_only_paired);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_security_grant
+********************************************************************************
+* Summary:
+*   Answers a security request, nothing to do on the host.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr: Peer
+*   uint8_t res                      : Answer
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void wiced_bt_ble_security_grant(wiced_bt_device_address_t bd_addr, uint8_t res)
+{
+    CY_UNUSED_PARAMETER(bd_addr);
+    CY_UNUSED_PARAMETER(res);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_dev_add_device_to_address_resolution_db
+********************************************************************************
+* Summary:
+*   Adds a bonded peer to the resolving list, nothing to resolve on the host.
+*
+* Parameters:
+*   wiced_bt_device_link_keys_t *p_link_keys: Keys of the peer
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_dev_add_device_to_address_resolution_db(wiced_bt_device_link_keys_t *p_link_keys)
+{
+    CY_UNUSED_PARAMETER(p_link_keys);
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_dev_remove_device_from_address_resolution_db
+********************************************************************************
+* Summary:
+*   Removes a peer from the resolving list, nothing to resolve on the host.
+*
+* Parameters:
+*   wiced_bt_device_link_keys_t *p_link_keys: Keys of the peer
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_dev_remove_device_from_address_resolution_db(wiced_bt_device_link_keys_t *p_link_keys)
+{
+    CY_UNUSED_PARAMETER(p_link_keys);
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Definitions: advertising and link layer
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: wiced_bt_ble_set_raw_advertisement_data
+********************************************************************************
+* Summary:
+*   Sets the legacy advertising data and prints it.
+*
+* Parameters:
+*   uint8_t num_elem                  : Number of AD structures
+*   wiced_bt_ble_advert_elem_t *p_data: AD structures
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_ILLEGAL_VALUE if the data does
+*                   not fit in a legacy advertising PDU
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_set_raw_advertisement_data(uint8_t num_elem,
+                                                       wiced_bt_ble_advert_elem_t *p_data)
+{
+    uint8_t adv[HOST_BT_STACK_MAX_ADV_LEN];
+    uint16_t len = 0;
+    uint8_t i;
+    uint16_t j;
+
+    for (i = 0; i < num_elem; i++)
+    {
+        if ((len + 2u + p_data[i].len) > sizeof(adv))
+        {
+            host_bt_stack_error("advertising data longer than %u bytes\n", (unsigned)sizeof(adv));
+            return WICED_BT_ILLEGAL_VALUE;
+        }
+        adv[len++] = (uint8_t)(p_data[i].len + 1u);
+        adv[len++] = p_data[i].advert_type;
+        memcpy(&adv[len], p_data[i].p_data, p_data[i].len);
+        len += p_data[i].len;
+    }
+
+    if (!host_sim_quiet)
+    {
+        printf("~ ADV_DATA");
+        for (j = 0; j < len; j++)
+        {
+            printf(" %02x", adv[j]);
+        }
+        printf("\n");
+    }
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_start_advertisements
+********************************************************************************
+* Summary:
+*   Changes the legacy advertising mode. BTM_BLE_ADVERT_STATE_CHANGED_EVT
+*   follows when the mode changes.
+*
+* Parameters:
+*   wiced_bt_ble_advert_mode_t advert_mode           : New mode
+*   wiced_bt_ble_address_type_t directed_advertisement_bdaddr_type: Not used
+*   wiced_bt_device_address_t directed_advertisement_bdaddr_ptr   : Peer of
+*                                                      the directed modes
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_start_advertisements(wiced_bt_ble_advert_mode_t advert_mode,
+                                             wiced_bt_ble_address_type_t directed_advertisement_bdaddr_type,
+                                             wiced_bt_device_address_t directed_advertisement_bdaddr_ptr)
+{
+    host_bt_stack_evt_t *p_evt;
+
+    CY_UNUSED_PARAMETER(directed_advertisement_bdaddr_type);
+
+    if ((BTM_BLE_ADVERT_DIRECTED_HIGH == advert_mode) || (BTM_BLE_ADVERT_DIRECTED_LOW == advert_mode))
+    {
+        if (NULL == directed_advertisement_bdaddr_ptr)
+        {
+            return WICED_BT_BADARG;
+        }
+        memcpy(host_bt_stack_adv_peer, directed_advertisement_bdaddr_ptr, BD_ADDR_LEN);
+    }
+
+    if (advert_mode == host_bt_stack_adv_mode)
+    {
+        return WICED_BT_SUCCESS;
+    }
+
+    host_bt_stack_adv_mode = advert_mode;
+    host_bt_stack_print("~ ADV_MODE %u\n", advert_mode);
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_BLE_ADVERT_STATE_CHANGED_EVT);
+    p_evt->data.mgmt.ble_advert_state_changed = advert_mode;
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_get_current_advert_mode
+********************************************************************************
+* Summary:
+*   Returns the legacy advertising mode.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bt_ble_advert_mode_t: Current mode
+*
+*******************************************************************************/
+wiced_bt_ble_advert_mode_t wiced_bt_ble_get_current_advert_mode(void)
+{
+    return host_bt_stack_adv_mode;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_set_ext_adv_parameters
+********************************************************************************
+* Summary:
+*   Sets the parameters of an extended advertising set. Only the event
+*   properties are kept, to stop connectable sets on a connection.
+*
+* Parameters:
+*   See the BTSTACK documentation.
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_ILLEGAL_VALUE for an unknown set
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_set_ext_adv_parameters(wiced_bt_ble_ext_adv_handle_t adv_handle,
+                                                   wiced_bt_ble_ext_adv_event_property_t event_properties,
+                                                   wiced_bt_ble_ext_adv_interval_t primary_adv_int_min,
+                                                   wiced_bt_ble_ext_adv_interval_t primary_adv_int_max,
+                                                   wiced_bt_ble_advert_chnl_map_t primary_adv_channel_map,
+                                                   wiced_bt_ble_address_type_t own_addr_type,
+                                                   wiced_bt_ble_address_type_t peer_addr_type,
+                                                   wiced_bt_device_address_t peer_addr,
+                                                   wiced_bt_ble_advert_filter_policy_t adv_filter_policy,
+                                                   int8_t adv_tx_power,
+                                                   wiced_bt_ble_ext_adv_phy_t primary_adv_phy,
+                                                   uint8_t secondary_adv_max_skip,
+                                                   wiced_bt_ble_ext_adv_phy_t secondary_adv_phy,
+                                                   wiced_bt_ble_ext_adv_sid_t adv_sid,
+                                                   wiced_bt_ble_ext_adv_scan_req_notification_setting_t scan_request_not)
+{
+    CY_UNUSED_PARAMETER(primary_adv_int_min);
+    CY_UNUSED_PARAMETER(primary_adv_channel_map);
+    CY_UNUSED_PARAMETER(own_addr_type);
+    CY_UNUSED_PARAMETER(peer_addr_type);
+    CY_UNUSED_PARAMETER(adv_filter_policy);
+    CY_UNUSED_PARAMETER(adv_tx_power);
+    CY_UNUSED_PARAMETER(primary_adv_phy);
+    CY_UNUSED_PARAMETER(secondary_adv_max_skip);
+    CY_UNUSED_PARAMETER(secondary_adv_phy);
+    CY_UNUSED_PARAMETER(adv_sid);
+    CY_UNUSED_PARAMETER(scan_request_not);
+
+    if (adv_handle >= HOST_BT_STACK_MAX_EXT_ADV_SETS)
+    {
+        return WICED_BT_ILLEGAL_VALUE;
+    }
+
+    host_bt_stack_ext_adv_props[adv_handle] = event_properties;
+    host_bt_stack_print("~ EXT_ADV_PARAMS set %u properties 0x%04x interval %lu\n", adv_handle,
+                        event_properties, (unsigned long)primary_adv_int_max);
+    if (0u != (event_properties & WICED_BT_BLE_EXT_ADV_EVENT_DIRECTED_ADV))
+    {
+        memcpy(host_bt_stack_adv_peer, peer_addr, BD_ADDR_LEN);
+    }
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_set_ext_adv_data
+********************************************************************************
+* Summary:
+*   Sets the data of an extended advertising set and prints it.
+*
+* Parameters:
+*   wiced_bt_ble_ext_adv_handle_t adv_handle: Set
+*   uint16_t data_len                       : Length of the data
+*   uint8_t *p_data                         : Data
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_ILLEGAL_VALUE for an unknown set
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_set_ext_adv_data(wiced_bt_ble_ext_adv_handle_t adv_handle,
+                                             uint16_t data_len, uint8_t *p_data)
+{
+    uint16_t i;
+
+    if (adv_handle >= HOST_BT_STACK_MAX_EXT_ADV_SETS)
+    {
+        return WICED_BT_ILLEGAL_VALUE;
+    }
+
+    if (!host_sim_quiet)
+    {
+        printf("~ EXT_ADV_DATA set %u", adv_handle);
+        for (i = 0; i < data_len; i++)
+        {
+            printf(" %02x", p_data[i]);
+        }
+        printf("\n");
+    }
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_start_ext_adv
+********************************************************************************
+* Summary:
+*   Starts or stops extended advertising sets.
+*
+* Parameters:
+*   uint8_t enable                                  : 1 to start, 0 to stop
+*   uint8_t num_sets                                : Number of sets
+*   wiced_bt_ble_ext_adv_duration_config_t *p_set_duration_param: Sets
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_ILLEGAL_VALUE for an unknown set
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_start_ext_adv(uint8_t enable, uint8_t num_sets,
+                                          wiced_bt_ble_ext_adv_duration_config_t *p_set_duration_param)
+{
+    uint8_t i;
+    uint8_t handle;
+
+    for (i = 0; i < num_sets; i++)
+    {
+        handle = p_set_duration_param[i].adv_handle;
+        if (handle >= HOST_BT_STACK_MAX_EXT_ADV_SETS)
+        {
+            return WICED_BT_ILLEGAL_VALUE;
+        }
+
+        if (enable)
+        {
+            host_bt_stack_ext_adv_enabled |= (uint8_t)(1u << handle);
+        }
+        else
+        {
+            host_bt_stack_ext_adv_enabled &= (uint8_t)~(1u << handle);
+        }
+        host_bt_stack_print("~ EXT_ADV set %u %s\n", handle, enable ? "on" : "off");
+    }
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_set_phy
+********************************************************************************
+* Summary:
+*   Requests a PHY. The controller switches to the fastest PHY both
+*   directions prefer and reports BTM_BLE_PHY_UPDATE_EVT.
+*
+* Parameters:
+*   wiced_bt_ble_phy_preferences_t *p_phy_preferences: Peer and preferred PHYs
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_UNKNOWN_ADDR without a link to
+*                   the peer
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_set_phy(wiced_bt_ble_phy_preferences_t *p_phy_preferences)
+{
+    host_bt_stack_evt_t *p_evt;
+
+    if (NULL == host_bt_stack_find_link_by_bda(p_phy_preferences->remote_bd_addr))
+    {
+        return WICED_BT_ILLEGAL_VALUE;
+    }
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_BLE_PHY_UPDATE_EVT);
+    p_evt->data.mgmt.ble_phy_update_event.status = WICED_BT_SUCCESS;
+    memcpy(p_evt->data.mgmt.ble_phy_update_event.bd_address, p_phy_preferences->remote_bd_addr, BD_ADDR_LEN);
+    p_evt->data.mgmt.ble_phy_update_event.tx_phy =
+        (0u != (p_phy_preferences->tx_phys & BTM_BLE_PREFER_2M_PHY)) ? 2u : 1u;
+    p_evt->data.mgmt.ble_phy_update_event.rx_phy =
+        (0u != (p_phy_preferences->rx_phys & BTM_BLE_PREFER_2M_PHY)) ? 2u : 1u;
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_ble_set_data_packet_length
+********************************************************************************
+* Summary:
+*   Requests a link layer payload length. The controller accepts it and
+*   reports BTM_BLE_DATA_LENGTH_UPDATE_EVENT.
+*
+* Parameters:
+*   wiced_bt_device_address_t bd_addr: Peer
+*   uint16_t tx_pdu_length           : Payload length
+*   uint16_t tx_time                 : Payload time
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_ILLEGAL_VALUE without a link to
+*                   the peer
+*
+*******************************************************************************/
+wiced_result_t wiced_bt_ble_set_data_packet_length(wiced_bt_device_address_t bd_addr,
+                                                   uint16_t tx_pdu_length, uint16_t tx_time)
+{
+    host_bt_stack_evt_t *p_evt;
+
+    if (NULL == host_bt_stack_find_link_by_bda(bd_addr))
+    {
+        return WICED_BT_ILLEGAL_VALUE;
+    }
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_BLE_DATA_LENGTH_UPDATE_EVENT);
+    memcpy(p_evt->data.mgmt.ble_data_length_update_event.bd_address, bd_addr, BD_ADDR_LEN);
+    p_evt->data.mgmt.ble_data_length_update_event.max_tx_octets = MIN(tx_pdu_length, HOST_BT_STACK_MAX_RX_OCTETS);
+    p_evt->data.mgmt.ble_data_length_update_event.max_tx_time = MIN(tx_time, HOST_BT_STACK_MAX_RX_TIME);
+    p_evt->data.mgmt.ble_data_length_update_event.max_rx_octets = HOST_BT_STACK_MAX_RX_OCTETS;
+    p_evt->data.mgmt.ble_data_length_update_event.max_rx_time = HOST_BT_STACK_MAX_RX_TIME;
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_l2cap_update_ble_conn_params
+********************************************************************************
+* Summary:
+*   Requests connection parameters. The central accepts the largest interval
+*   of the range and BTM_BLE_CONNECTION_PARAM_UPDATE follows.
+*
+* Parameters:
+*   wiced_bt_device_address_t rem_bdRa: Peer
+*   uint16_t min_int, max_int         : Interval range, 1.25 ms units
+*   uint16_t latency                  : Peripheral latency
+*   uint16_t timeout                  : Supervision timeout, 10 ms units
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the request was sent
+*
+*******************************************************************************/
+wiced_bool_t wiced_bt_l2cap_update_ble_conn_params(wiced_bt_device_address_t rem_bdRa, uint16_t min_int,
+                                                   uint16_t max_int, uint16_t latency, uint16_t timeout)
+{
+    host_bt_stack_evt_t *p_evt;
+
+    CY_UNUSED_PARAMETER(min_int);
+
+    if (NULL == host_bt_stack_find_link_by_bda(rem_bdRa))
+    {
+        return WICED_FALSE;
+    }
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_BLE_CONNECTION_PARAM_UPDATE);
+    p_evt->data.mgmt.ble_connection_param_update.status = WICED_BT_SUCCESS;
+    memcpy(p_evt->data.mgmt.ble_connection_param_update.bd_addr, rem_bdRa, BD_ADDR_LEN);
+    p_evt->data.mgmt.ble_connection_param_update.conn_interval = max_int;
+    p_evt->data.mgmt.ble_connection_param_update.conn_latency = latency;
+    p_evt->data.mgmt.ble_connection_param_update.supervision_timeout = timeout;
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Definitions: timers
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: wiced_init_timer
+********************************************************************************
+* Summary:
+*   Initializes a timer, stopped.
+*
+* Parameters:
+*   wiced_timer_t *p_timer              : Timer
+*   wiced_timer_callback_t TimerCb      : Called on the stack thread on expiry
+*   WICED_TIMER_PARAM_TYPE cBackparam   : Argument of the callback
+*   wiced_timer_type_t type             : Units and periodicity
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_init_timer(wiced_timer_t *p_timer, wiced_timer_callback_t TimerCb,
+                                WICED_TIMER_PARAM_TYPE cBackparam, wiced_timer_type_t type)
+{
+    host_bt_stack_unlink_timer(p_timer);
+
+    p_timer->cback = TimerCb;
+    p_timer->cb_params = cBackparam;
+    p_timer->type = type;
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_start_timer
+********************************************************************************
+* Summary:
+*   Starts or restarts a timer.
+*
+* Parameters:
+*   wiced_timer_t *p_timer: Timer
+*   uint32_t timeout      : Timeout in the units of the timer
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS, WICED_BT_BADARG for a zero period
+*
+*******************************************************************************/
+wiced_result_t wiced_start_timer(wiced_timer_t *p_timer, uint32_t timeout)
+{
+    host_bt_stack_unlink_timer(p_timer);
+
+    p_timer->period_ms = timeout;
+    if ((WICED_SECONDS_TIMER == p_timer->type) || (WICED_SECONDS_PERIODIC_TIMER == p_timer->type))
+    {
+        p_timer->period_ms *= 1000u;
+    }
+    if ((0u == p_timer->period_ms) && (WICED_MILLI_SECONDS_PERIODIC_TIMER == p_timer->type))
+    {
+        return WICED_BT_BADARG;
+    }
+
+    p_timer->expiry_ms = (uint64_t)host_rtos_get_time() + p_timer->period_ms;
+    p_timer->in_use = WICED_TRUE;
+    p_timer->next = host_bt_stack_timers;
+    host_bt_stack_timers = p_timer;
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_stop_timer
+********************************************************************************
+* Summary:
+*   Stops a timer.
+*
+* Parameters:
+*   wiced_timer_t *p_timer: Timer
+*
+* Return:
+*   wiced_result_t: WICED_BT_SUCCESS
+*
+*******************************************************************************/
+wiced_result_t wiced_stop_timer(wiced_timer_t *p_timer)
+{
+    host_bt_stack_unlink_timer(p_timer);
+
+    return WICED_BT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_is_timer_in_use
+********************************************************************************
+* Summary:
+*   Checks whether a timer runs.
+*
+* Parameters:
+*   wiced_timer_t *p_timer: Timer
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the timer runs
+*
+*******************************************************************************/
+wiced_bool_t wiced_is_timer_in_use(wiced_timer_t *p_timer)
+{
+    return p_timer->in_use;
+}
+
+/*******************************************************************************
+* Function Definitions: GATT
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_register
+********************************************************************************
+* Summary:
+*   Registers the GATT callback.
+*
+* Parameters:
+*   wiced_bt_gatt_cback_t *p_gatt_cback: GATT callback
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_register(wiced_bt_gatt_cback_t *p_gatt_cback)
+{
+    host_bt_stack_gatt_cback = p_gatt_cback;
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_db_init
+********************************************************************************
+* Summary:
+*   Sets the GATT DB. The DB is not copied: attributes added to it later, as
+*   the benchmarks do, are found as long as its length is set again.
+*
+* Parameters:
+*   const uint8_t *p_gatt_db : GATT DB
+*   uint32_t gatt_db_size    : Length of the GATT DB
+*   wiced_bt_db_hash_t hash  : Not used
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_db_init(const uint8_t *p_gatt_db, uint32_t gatt_db_size,
+                                             wiced_bt_db_hash_t hash)
+{
+    CY_UNUSED_PARAMETER(hash);
+
+    host_bt_stack_db = p_gatt_db;
+    host_bt_stack_db_len = gatt_db_size;
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_disconnect
+********************************************************************************
+* Summary:
+*   Disconnects a client. GATT_CONNECTION_STATUS_EVT follows.
+*
+* Parameters:
+*   uint16_t conn_id: Connection
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS,
+*                           WICED_BT_GATT_INVALID_CONNECTION_ID if not connected
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_disconnect(uint16_t conn_id)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    host_bt_stack_evt_t *p_evt;
+
+    if (NULL == p_link)
+    {
+        return WICED_BT_GATT_INVALID_CONNECTION_ID;
+    }
+
+    host_bt_stack_print("< %u DISCONNECT\n", conn_id);
+    p_link->connected = WICED_FALSE;
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_GATT, GATT_CONNECTION_STATUS_EVT);
+    memcpy(p_evt->bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    p_evt->data.gatt.connection_status.addr_type = p_link->addr_type;
+    p_evt->data.gatt.connection_status.conn_id = conn_id;
+    p_evt->data.gatt.connection_status.connected = WICED_FALSE;
+    p_evt->data.gatt.connection_status.reason = GATT_CONN_TERMINATE_LOCAL_HOST;
+    p_evt->data.gatt.connection_status.transport = BT_TRANSPORT_LE;
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_find_handle_by_type
+********************************************************************************
+* Summary:
+*   Walks the GATT DB for the first attribute of a type in a handle range.
+*
+* Parameters:
+*   uint16_t s_handle             : First handle of the range
+*   uint16_t e_handle             : Last handle of the range
+*   const wiced_bt_uuid_t *p_uuid : Attribute type
+*
+* Return:
+*   uint16_t: Handle of the attribute, 0 if there is none
+*
+*******************************************************************************/
+uint16_t wiced_bt_gatt_find_handle_by_type(uint16_t s_handle, uint16_t e_handle,
+                                           const wiced_bt_uuid_t *p_uuid)
+{
+    uint32_t pos = 0;
+    uint16_t handle;
+    uint16_t uuid_len;
+    const uint8_t *p_attr;
+
+    while ((pos + LEGATTDB_ATTR_HDR_LEN) <= host_bt_stack_db_len)
+    {
+        p_attr = &host_bt_stack_db[pos];
+        handle = (uint16_t)(p_attr[0] | (p_attr[1] << 8));
+        uuid_len = (0u != (p_attr[2] & GATTDB_PERM_SERVICE_UUID_128)) ? LEN_UUID_128 : LEN_UUID_16;
+
+        if (handle > e_handle)
+        {
+            break;
+        }
+        if ((handle >= s_handle) && (uuid_len == p_uuid->len) &&
+            (0 == memcmp(&p_attr[LEGATTDB_ATTR_HDR_LEN], &p_uuid->uu, uuid_len)))
+        {
+            return handle;
+        }
+
+        pos += LEGATTDB_ATTR_HDR_LEN + p_attr[3];
+    }
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_get_handle_from_stream
+********************************************************************************
+* Summary:
+*   Returns a handle of the handle list of a Read Multiple request.
+*
+* Parameters:
+*   uint8_t *p_handle_stream: Handle list, little endian
+*   uint16_t handle_index   : Index of the handle
+*
+* Return:
+*   uint16_t: Handle
+*
+*******************************************************************************/
+uint16_t wiced_bt_gatt_get_handle_from_stream(uint8_t *p_handle_stream, uint16_t handle_index)
+{
+    return (uint16_t)(p_handle_stream[2u * handle_index] | (p_handle_stream[(2u * handle_index) + 1u] << 8));
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_put_read_by_type_rsp_in_stream
+********************************************************************************
+* Summary:
+*   Adds a handle-value pair to a Read By Type response. The first pair sets
+*   the pair length, cutting the value to fit; later pairs must have the same
+*   length.
+*
+* Parameters:
+*   uint8_t *p_stream      : Free space of the response
+*   int stream_len         : Length of the free space
+*   uint8_t *p_pair_len    : Pair length, 0 before the first pair
+*   uint16_t attr_handle   : Handle of the attribute
+*   uint16_t attr_len      : Length of the value
+*   const uint8_t *p_attr  : Value
+*
+* Return:
+*   int: Bytes added, 0 if the pair does not fit or has another length
+*
+*******************************************************************************/
+int wiced_bt_gatt_put_read_by_type_rsp_in_stream(uint8_t *p_stream, int stream_len, uint8_t *p_pair_len,
+                                                 uint16_t attr_handle, uint16_t attr_len,
+                                                 const uint8_t *p_attr)
+{
+    int pair_len = MIN((int)attr_len + 2, UINT8_MAX);
+
+    if (0u == *p_pair_len)
+    {
+        pair_len = MIN(pair_len, stream_len);
+        if (pair_len < 2)
+        {
+            return 0;
+        }
+        *p_pair_len = (uint8_t)pair_len;
+    }
+    else if ((pair_len != *p_pair_len) || (pair_len > stream_len))
+    {
+        return 0;
+    }
+
+    p_stream[0] = (uint8_t)(attr_handle & 0xFFu);
+    p_stream[1] = (uint8_t)(attr_handle >> 8);
+    memcpy(&p_stream[2], p_attr, pair_len - 2);
+
+    return pair_len;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_put_read_multi_rsp_in_stream
+********************************************************************************
+* Summary:
+*   Adds a value to a Read Multiple or Read Multiple Variable Length response.
+*   The variable length response prefixes the value with its length.
+*
+* Parameters:
+*   wiced_bt_gatt_opcode_t opcode: Request
+*   uint8_t *p_dest              : Free space of the response
+*   int dest_buff_len            : Length of the free space
+*   uint16_t handle              : Handle of the attribute
+*   uint16_t attr_len            : Length of the value
+*   const uint8_t *p_attr        : Value
+*
+* Return:
+*   int: Bytes added, 0 if the value does not fit
+*
+*******************************************************************************/
+int wiced_bt_gatt_put_read_multi_rsp_in_stream(wiced_bt_gatt_opcode_t opcode, uint8_t *p_dest,
+                                               int dest_buff_len, uint16_t handle, uint16_t attr_len,
+                                               const uint8_t *p_attr)
+{
+    int hdr_len = (GATT_REQ_READ_MULTI_VAR_LENGTH == opcode) ? 2 : 0;
+
+    CY_UNUSED_PARAMETER(handle);
+
+    if ((hdr_len + attr_len) > dest_buff_len)
+    {
+        return 0;
+    }
+
+    if (0 != hdr_len)
+    {
+        p_dest[0] = (uint8_t)(attr_len & 0xFFu);
+        p_dest[1] = (uint8_t)(attr_len >> 8);
+    }
+    memcpy(&p_dest[hdr_len], p_attr, attr_len);
+
+    return hdr_len + attr_len;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_error_rsp
+********************************************************************************
+* Summary:
+*   Sends an Error Response.
+*
+* Parameters:
+*   uint16_t conn_id              : Connection
+*   wiced_bt_gatt_opcode_t opcode : Request that failed
+*   uint16_t handle               : Handle in error
+*   wiced_bt_gatt_status_t status : Error
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_error_rsp(uint16_t conn_id, wiced_bt_gatt_opcode_t opcode,
+                                                           uint16_t handle, wiced_bt_gatt_status_t status)
+{
+    uint8_t pdu[4] = { opcode, (uint8_t)(handle & 0xFFu), (uint8_t)(handle >> 8), (uint8_t)status };
+
+    host_bt_stack_last_pdu.req_opcode = opcode;
+    host_bt_stack_last_pdu.status = status;
+
+    return host_bt_stack_send(conn_id, GATT_RSP_ERROR, handle, pdu, sizeof(pdu), NULL, 0, NULL, NULL);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_mtu_rsp
+********************************************************************************
+* Summary:
+*   Sends an Exchange MTU Response. The link uses the smaller of both MTUs.
+*
+* Parameters:
+*   uint16_t conn_id    : Connection
+*   uint16_t remote_mtu : MTU of the client
+*   uint16_t my_mtu     : MTU of the server
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_mtu_rsp(uint16_t conn_id, uint16_t remote_mtu,
+                                                         uint16_t my_mtu)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    uint8_t pdu[2] = { (uint8_t)(my_mtu & 0xFFu), (uint8_t)(my_mtu >> 8) };
+    wiced_bt_gatt_status_t status;
+
+    status = host_bt_stack_send(conn_id, GATT_RSP_MTU, 0, NULL, 0, pdu, sizeof(pdu), NULL, NULL);
+    if ((WICED_BT_GATT_SUCCESS == status) && (NULL != p_link))
+    {
+        p_link->mtu = MAX(GATT_DEF_BLE_MTU_SIZE, MIN(remote_mtu, my_mtu));
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_read_handle_rsp
+********************************************************************************
+* Summary:
+*   Sends a Read or Read Blob Response.
+*
+* Parameters:
+*   uint16_t conn_id             : Connection
+*   wiced_bt_gatt_opcode_t opcode: Request
+*   uint16_t len                 : Length of the value
+*   uint8_t *p_attr              : Value
+*   void *p_app_ctxt             : Returned with GATT_APP_BUFFER_TRANSMITTED_EVT
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_handle_rsp(uint16_t conn_id,
+                                                                 wiced_bt_gatt_opcode_t opcode,
+                                                                 uint16_t len, uint8_t *p_attr,
+                                                                 void *p_app_ctxt)
+{
+    return host_bt_stack_send(conn_id, (uint8_t)(opcode + 1u), 0, NULL, 0, p_attr, len, p_attr, p_app_ctxt);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_read_by_type_rsp
+********************************************************************************
+* Summary:
+*   Sends a Read By Type Response.
+*
+* Parameters:
+*   uint16_t conn_id             : Connection
+*   wiced_bt_gatt_opcode_t opcode: Request
+*   uint8_t type_len             : Length of each handle-value pair
+*   uint16_t data_len            : Length of the pairs
+*   uint8_t *p_data              : Pairs
+*   void *p_app_ctxt             : Returned with GATT_APP_BUFFER_TRANSMITTED_EVT
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_by_type_rsp(uint16_t conn_id,
+                                                                  wiced_bt_gatt_opcode_t opcode,
+                                                                  uint8_t type_len, uint16_t data_len,
+                                                                  uint8_t *p_data, void *p_app_ctxt)
+{
+    if ((0u == type_len) || (0u != (data_len % type_len)))
+    {
+        host_bt_stack_error("read by type response of %u bytes with pairs of %u bytes\n", data_len, type_len);
+    }
+
+    return host_bt_stack_send(conn_id, (uint8_t)(opcode + 1u), 0, &type_len, 1, p_data, data_len,
+                              p_data, p_app_ctxt);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_read_multiple_rsp
+********************************************************************************
+* Summary:
+*   Sends a Read Multiple or Read Multiple Variable Length Response.
+*
+* Parameters:
+*   uint16_t conn_id             : Connection
+*   wiced_bt_gatt_opcode_t opcode: Request
+*   uint16_t data_len            : Length of the values
+*   uint8_t *p_data              : Values
+*   void *p_app_ctxt             : Returned with GATT_APP_BUFFER_TRANSMITTED_EVT
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_read_multiple_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode,
+                                                                   uint16_t data_len, uint8_t *p_data,
+                                                                   void *p_app_ctxt)
+{
+    return host_bt_stack_send(conn_id, (uint8_t)(opcode + 1u), 0, NULL, 0, p_data, data_len,
+                              p_data, p_app_ctxt);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_write_rsp
+********************************************************************************
+* Summary:
+*   Sends a Write Response.
+*
+* Parameters:
+*   uint16_t conn_id             : Connection
+*   wiced_bt_gatt_opcode_t opcode: Request
+*   uint16_t handle              : Handle written
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_write_rsp(uint16_t conn_id, wiced_bt_gatt_opcode_t opcode,
+                                                           uint16_t handle)
+{
+    if (GATT_REQ_WRITE != opcode)
+    {
+        host_bt_stack_error("write response to opcode 0x%02x\n", opcode);
+    }
+
+    return host_bt_stack_send(conn_id, GATT_RSP_WRITE, handle, NULL, 0, NULL, 0, NULL, NULL);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_prepare_write_rsp
+********************************************************************************
+* Summary:
+*   Sends a Prepare Write Response, which echoes the request.
+*
+* Parameters:
+*   uint16_t conn_id             : Connection
+*   wiced_bt_gatt_opcode_t opcode: Request
+*   uint16_t handle              : Handle
+*   uint16_t offset              : Offset of the part
+*   uint16_t len                 : Length of the part
+*   uint8_t *p_data              : Part
+*   void *p_app_ctxt             : Returned with GATT_APP_BUFFER_TRANSMITTED_EVT
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_prepare_write_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode,
+                                                                   uint16_t handle, uint16_t offset,
+                                                                   uint16_t len, uint8_t *p_data,
+                                                                   void *p_app_ctxt)
+{
+    uint8_t hdr[4] = { (uint8_t)(handle & 0xFFu), (uint8_t)(handle >> 8),
+                       (uint8_t)(offset & 0xFFu), (uint8_t)(offset >> 8) };
+
+    return host_bt_stack_send(conn_id, (uint8_t)(opcode + 1u), handle, hdr, sizeof(hdr), p_data, len,
+                              p_data, p_app_ctxt);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_execute_write_rsp
+********************************************************************************
+* Summary:
+*   Sends an Execute Write Response.
+*
+* Parameters:
+*   uint16_t conn_id             : Connection
+*   wiced_bt_gatt_opcode_t opcode: Request
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send()
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_execute_write_rsp(uint16_t conn_id,
+                                                                   wiced_bt_gatt_opcode_t opcode)
+{
+    return host_bt_stack_send(conn_id, (uint8_t)(opcode + 1u), 0, NULL, 0, NULL, 0, NULL, NULL);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_notification
+********************************************************************************
+* Summary:
+*   Sends a Handle Value Notification.
+*
+* Parameters:
+*   uint16_t conn_id    : Connection
+*   uint16_t attr_handle: Handle
+*   uint16_t val_len    : Length of the value
+*   uint8_t *p_val      : Value
+*   void *p_app_ctxt    : Returned with GATT_APP_BUFFER_TRANSMITTED_EVT
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send(), WICED_BT_GATT_CONGESTED
+*                           while the link is congested
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_notification(uint16_t conn_id, uint16_t attr_handle,
+                                                              uint16_t val_len, uint8_t *p_val,
+                                                              void *p_app_ctxt)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    uint8_t hdr[2] = { (uint8_t)(attr_handle & 0xFFu), (uint8_t)(attr_handle >> 8) };
+
+    if ((NULL != p_link) && p_link->congested)
+    {
+        return WICED_BT_GATT_CONGESTED;
+    }
+
+    return host_bt_stack_send(conn_id, GATT_HANDLE_VALUE_NOTIF, attr_handle, hdr, sizeof(hdr), p_val, val_len,
+                              p_val, p_app_ctxt);
+}
+
+/*******************************************************************************
+* Function Name: wiced_bt_gatt_server_send_indication
+********************************************************************************
+* Summary:
+*   Sends a Handle Value Indication. One indication at a time waits for its
+*   confirmation.
+*
+* Parameters:
+*   uint16_t conn_id    : Connection
+*   uint16_t attr_handle: Handle
+*   uint16_t val_len    : Length of the value
+*   uint8_t *p_val      : Value
+*   void *p_app_ctxt    : Returned with GATT_APP_BUFFER_TRANSMITTED_EVT
+*
+* Return:
+*   wiced_bt_gatt_status_t: See host_bt_stack_send(), WICED_BT_GATT_CONGESTED
+*                           while the link is congested
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t wiced_bt_gatt_server_send_indication(uint16_t conn_id, uint16_t attr_handle,
+                                                            uint16_t val_len, uint8_t *p_val,
+                                                            void *p_app_ctxt)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    uint8_t hdr[2] = { (uint8_t)(attr_handle & 0xFFu), (uint8_t)(attr_handle >> 8) };
+    wiced_bt_gatt_status_t status;
+
+    if (NULL != p_link)
+    {
+        if (p_link->congested)
+        {
+            return WICED_BT_GATT_CONGESTED;
+        }
+        if (p_link->ind_pending)
+        {
+            host_bt_stack_error("indication on connection %u before the confirmation\n", conn_id);
+        }
+    }
+
+    status = host_bt_stack_send(conn_id, GATT_HANDLE_VALUE_IND, attr_handle, hdr, sizeof(hdr), p_val, val_len,
+                                p_val, p_app_ctxt);
+    if ((WICED_BT_GATT_SUCCESS == status) && (NULL != p_link))
+    {
+        p_link->ind_pending = WICED_TRUE;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Definitions: driver
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: host_bt_stack_enable
+********************************************************************************
+* Summary:
+*   Enables the stack: asks the application for the local identity keys,
+*   generating new ones if it has none, then delivers BTM_ENABLED_EVT.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_bt_stack_enable(void)
+{
+    wiced_bt_management_evt_data_t data;
+    uint8_t i;
+
+    CY_ASSERT(NULL != host_bt_stack_mgmt_cback);
+
+    memset(&data, 0, sizeof(data));
+    if (WICED_BT_SUCCESS != host_bt_stack_deliver_mgmt(BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT, &data))
+    {
+        for (i = 0; i < sizeof(data.local_identity_keys_update.local_key_data); i++)
+        {
+            data.local_identity_keys_update.local_key_data[i] = (uint8_t)(0xA5u ^ i);
+        }
+        (void)host_bt_stack_deliver_mgmt(BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT, &data);
+    }
+
+    memset(&data, 0, sizeof(data));
+    data.enabled.status = WICED_BT_SUCCESS;
+    (void)host_bt_stack_deliver_mgmt(BTM_ENABLED_EVT, &data);
+
+    host_bt_stack_pump();
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_pump
+********************************************************************************
+* Summary:
+*   Delivers the queued events, including the events they cause.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_bt_stack_pump(void)
+{
+    host_bt_stack_evt_t evt;
+
+    while (host_bt_stack_evt_tail != host_bt_stack_evt_head)
+    {
+        evt = host_bt_stack_evt_queue[host_bt_stack_evt_tail % HOST_BT_STACK_EVT_QUEUE_SIZE];
+        host_bt_stack_evt_tail++;
+        host_bt_stack_deliver(&evt);
+    }
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_advance
+********************************************************************************
+* Summary:
+*   Moves the simulated time forward, running the timers that expire in
+*   order of expiry.
+*
+* Parameters:
+*   uint32_t ms: Milliseconds to move forward
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_bt_stack_advance(uint32_t ms)
+{
+    uint64_t target = (uint64_t)host_rtos_get_time() + ms;
+    wiced_timer_t *p_timer;
+    wiced_timer_t *p_next;
+
+    for (;;)
+    {
+        p_next = NULL;
+        for (p_timer = host_bt_stack_timers; NULL != p_timer; p_timer = p_timer->next)
+        {
+            if ((p_timer->expiry_ms <= target) &&
+                ((NULL == p_next) || (p_timer->expiry_ms < p_next->expiry_ms)))
+            {
+                p_next = p_timer;
+            }
+        }
+        if (NULL == p_next)
+        {
+            break;
+        }
+
+        host_rtos_set_time((uint32_t)p_next->expiry_ms);
+        if ((WICED_MILLI_SECONDS_PERIODIC_TIMER == p_next->type) ||
+            (WICED_SECONDS_PERIODIC_TIMER == p_next->type))
+        {
+            p_next->expiry_ms += p_next->period_ms;
+        }
+        else
+        {
+            host_bt_stack_unlink_timer(p_next);
+        }
+
+        p_next->cback(p_next->cb_params);
+        host_bt_stack_pump();
+    }
+
+    host_rtos_set_time((uint32_t)target);
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_connect
+********************************************************************************
+* Summary:
+*   Connects a client. The client must find the device advertising in a
+*   connectable mode, directed to it in the directed modes. The controller
+*   stops advertising, then GATT_CONNECTION_STATUS_EVT is delivered.
+*
+* Parameters:
+*   uint16_t conn_id                        : Connection ID given to the link
+*   const wiced_bt_device_address_t bd_addr: Address of the client
+*   wiced_bt_ble_address_type_t addr_type   : Address type of the client
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the client connected
+*
+*******************************************************************************/
+wiced_bool_t host_bt_stack_connect(uint16_t conn_id, const wiced_bt_device_address_t bd_addr,
+                                   wiced_bt_ble_address_type_t addr_type)
+{
+    host_bt_stack_link_t *p_link = NULL;
+    host_bt_stack_evt_t *p_evt;
+    wiced_bool_t directed = WICED_FALSE;
+    wiced_bool_t connectable = WICED_FALSE;
+    uint8_t i;
+
+    switch (host_bt_stack_adv_mode)
+    {
+        case BTM_BLE_ADVERT_DIRECTED_HIGH:
+        case BTM_BLE_ADVERT_DIRECTED_LOW:
+            directed = WICED_TRUE;
+            connectable = WICED_TRUE;
+            break;
+        case BTM_BLE_ADVERT_UNDIRECTED_HIGH:
+        case BTM_BLE_ADVERT_UNDIRECTED_LOW:
+            connectable = WICED_TRUE;
+            break;
+        default:
+            break;
+    }
+    for (i = 0; i < HOST_BT_STACK_MAX_EXT_ADV_SETS; i++)
+    {
+        if ((0u != (host_bt_stack_ext_adv_enabled & (1u << i))) &&
+            (0u != (host_bt_stack_ext_adv_props[i] & WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV)))
+        {
+            connectable = WICED_TRUE;
+            directed = (0u != (host_bt_stack_ext_adv_props[i] & WICED_BT_BLE_EXT_ADV_EVENT_DIRECTED_ADV));
+        }
+    }
+
+    if (!connectable || (directed && (0 != memcmp(bd_addr, host_bt_stack_adv_peer, BD_ADDR_LEN))))
+    {
+        host_bt_stack_print("! %u not advertising to this client\n", conn_id);
+        return WICED_FALSE;
+    }
+
+    for (i = 0; i < HOST_BT_STACK_MAX_LINKS; i++)
+    {
+        if (host_bt_stack_links[i].connected && (conn_id == host_bt_stack_links[i].conn_id))
+        {
+            host_bt_stack_print("! %u already connected\n", conn_id);
+            return WICED_FALSE;
+        }
+        if ((NULL == p_link) && !host_bt_stack_links[i].connected)
+        {
+            p_link = &host_bt_stack_links[i];
+        }
+    }
+    if (NULL == p_link)
+    {
+        host_bt_stack_print("! %u no free link\n", conn_id);
+        return WICED_FALSE;
+    }
+
+    memset(p_link, 0, sizeof(*p_link));
+    p_link->connected = WICED_TRUE;
+    p_link->conn_id = conn_id;
+    memcpy(p_link->bd_addr, bd_addr, BD_ADDR_LEN);
+    p_link->addr_type = addr_type;
+    p_link->mtu = GATT_DEF_BLE_MTU_SIZE;
+
+    /* The controller stops the advertising the client connected to */
+    if (BTM_BLE_ADVERT_OFF != host_bt_stack_adv_mode)
+    {
+        (void)wiced_bt_start_advertisements(BTM_BLE_ADVERT_OFF, 0, NULL);
+    }
+    for (i = 0; i < HOST_BT_STACK_MAX_EXT_ADV_SETS; i++)
+    {
+        if ((0u != (host_bt_stack_ext_adv_enabled & (1u << i))) &&
+            (0u != (host_bt_stack_ext_adv_props[i] & WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV)))
+        {
+            host_bt_stack_ext_adv_enabled &= (uint8_t)~(1u << i);
+            host_bt_stack_print("~ EXT_ADV set %u off\n", i);
+        }
+    }
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_GATT, GATT_CONNECTION_STATUS_EVT);
+    memcpy(p_evt->bd_addr, bd_addr, BD_ADDR_LEN);
+    p_evt->data.gatt.connection_status.addr_type = addr_type;
+    p_evt->data.gatt.connection_status.conn_id = conn_id;
+    p_evt->data.gatt.connection_status.connected = WICED_TRUE;
+    p_evt->data.gatt.connection_status.reason = GATT_CONN_UNKNOWN;
+    p_evt->data.gatt.connection_status.transport = BT_TRANSPORT_LE;
+    p_evt->data.gatt.connection_status.link_role = 1u;    /* Peripheral */
+    host_bt_stack_pump();
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_disconnect
+********************************************************************************
+* Summary:
+*   Disconnects a client, as if it left or the link was lost.
+*
+* Parameters:
+*   uint16_t conn_id                      : Connection
+*   wiced_bt_gatt_disconn_reason_t reason : Reason of the disconnection
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the client was connected
+*
+*******************************************************************************/
+wiced_bool_t host_bt_stack_disconnect(uint16_t conn_id, wiced_bt_gatt_disconn_reason_t reason)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    host_bt_stack_evt_t *p_evt;
+
+    if (NULL == p_link)
+    {
+        host_bt_stack_print("! %u not connected\n", conn_id);
+        return WICED_FALSE;
+    }
+
+    p_link->connected = WICED_FALSE;
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_GATT, GATT_CONNECTION_STATUS_EVT);
+    memcpy(p_evt->bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    p_evt->data.gatt.connection_status.addr_type = p_link->addr_type;
+    p_evt->data.gatt.connection_status.conn_id = conn_id;
+    p_evt->data.gatt.connection_status.connected = WICED_FALSE;
+    p_evt->data.gatt.connection_status.reason = reason;
+    p_evt->data.gatt.connection_status.transport = BT_TRANSPORT_LE;
+    host_bt_stack_pump();
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_request
+********************************************************************************
+* Summary:
+*   Delivers a request of a client as GATT_ATTRIBUTE_REQUEST_EVT. Requests
+*   that need a response must get exactly one, within the MTU of the link.
+*
+* Parameters:
+*   uint16_t conn_id                      : Connection
+*   wiced_bt_gatt_opcode_t opcode         : Request, command or confirmation
+*   wiced_bt_gatt_request_data_t *p_data  : Parameters of the request
+*
+* Return:
+*   wiced_bt_gatt_status_t: Status returned by the GATT callback,
+*                           WICED_BT_GATT_INVALID_CONNECTION_ID if not connected
+*
+*******************************************************************************/
+wiced_bt_gatt_status_t host_bt_stack_request(uint16_t conn_id, wiced_bt_gatt_opcode_t opcode,
+                                             wiced_bt_gatt_request_data_t *p_data)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    wiced_bt_gatt_event_data_t data;
+    wiced_bt_gatt_status_t status;
+    wiced_bool_t needs_rsp;
+
+    if ((NULL == p_link) || (NULL == host_bt_stack_gatt_cback))
+    {
+        host_bt_stack_print("! %u not connected\n", conn_id);
+        return WICED_BT_GATT_INVALID_CONNECTION_ID;
+    }
+
+    needs_rsp = (GATT_CMD_WRITE != opcode) && (GATT_CMD_SIGNED_WRITE != opcode) &&
+                (GATT_HANDLE_VALUE_CONF != opcode) && (GATT_HANDLE_VALUE_NOTIF != opcode);
+    if (GATT_HANDLE_VALUE_CONF == opcode)
+    {
+        if (!p_link->ind_pending)
+        {
+            host_bt_stack_print("! %u no indication to confirm\n", conn_id);
+            return WICED_BT_GATT_ERROR;
+        }
+        p_link->ind_pending = WICED_FALSE;
+    }
+
+    memset(&data, 0, sizeof(data));
+    data.attribute_request.conn_id = conn_id;
+    data.attribute_request.opcode = opcode;
+    data.attribute_request.data = *p_data;
+    data.attribute_request.len_requested = (uint16_t)(p_link->mtu - ((GATT_REQ_READ_BY_TYPE == opcode) ? 2u : 1u));
+
+    p_link->rsp_pending = needs_rsp;
+    status = host_bt_stack_gatt_cback(GATT_ATTRIBUTE_REQUEST_EVT, &data);
+    host_bt_stack_pump();
+
+    p_link = host_bt_stack_find_link(conn_id);
+    if ((NULL != p_link) && p_link->rsp_pending)
+    {
+        p_link->rsp_pending = WICED_FALSE;
+        host_bt_stack_error("no response to %s on connection %u\n", host_bt_stack_opcode_name(opcode), conn_id);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_pair
+********************************************************************************
+* Summary:
+*   Pairs and bonds with a client, LE Secure Connections Just Works: the
+*   application gives its IO capabilities, the link is encrypted, the keys
+*   are distributed and the pairing completes.
+*
+* Parameters:
+*   uint16_t conn_id: Connection
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the client was connected
+*
+*******************************************************************************/
+wiced_bool_t host_bt_stack_pair(uint16_t conn_id)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    host_bt_stack_evt_t *p_evt;
+    uint8_t i;
+
+    if (NULL == p_link)
+    {
+        host_bt_stack_print("! %u not connected\n", conn_id);
+        return WICED_FALSE;
+    }
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_PAIRING_IO_CAPABILITIES_BLE_REQUEST_EVT);
+    memcpy(p_evt->data.mgmt.pairing_io_capabilities_ble_request.bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_ENCRYPTION_STATUS_EVT);
+    memcpy(p_evt->bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    p_evt->data.mgmt.encryption_status.transport = BT_TRANSPORT_LE;
+    p_evt->data.mgmt.encryption_status.result = WICED_BT_SUCCESS;
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT);
+    memcpy(p_evt->data.mgmt.paired_device_link_keys_update.bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    memcpy(p_evt->data.mgmt.paired_device_link_keys_update.conn_addr, p_link->bd_addr, BD_ADDR_LEN);
+    for (i = 0; i < sizeof(p_evt->data.mgmt.paired_device_link_keys_update.key_data); i++)
+    {
+        p_evt->data.mgmt.paired_device_link_keys_update.key_data.key_data[i] = (uint8_t)(p_link->bd_addr[i % BD_ADDR_LEN] ^ i);
+    }
+
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_MGMT, BTM_PAIRING_COMPLETE_EVT);
+    memcpy(p_evt->bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    p_evt->data.mgmt.pairing_complete.transport = BT_TRANSPORT_LE;
+    p_evt->data.mgmt.pairing_complete.pairing_complete_info.ble.status = WICED_BT_SUCCESS;
+    p_evt->data.mgmt.pairing_complete.pairing_complete_info.ble.reason = SMP_SUCCESS;
+
+    host_bt_stack_pump();
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_encrypt
+********************************************************************************
+* Summary:
+*   Encrypts the link of a bonded client with the keys the application
+*   stored. The encryption fails if the application has no keys.
+*
+* Parameters:
+*   uint16_t conn_id: Connection
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the link was encrypted
+*
+*******************************************************************************/
+wiced_bool_t host_bt_stack_encrypt(uint16_t conn_id)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    wiced_bt_management_evt_data_t data;
+    wiced_result_t result;
+
+    if (NULL == p_link)
+    {
+        host_bt_stack_print("! %u not connected\n", conn_id);
+        return WICED_FALSE;
+    }
+
+    memset(&data, 0, sizeof(data));
+    memcpy(data.paired_device_link_keys_request.bd_addr, p_link->bd_addr, BD_ADDR_LEN);
+    result = host_bt_stack_deliver_mgmt(BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT, &data);
+
+    memset(&data, 0, sizeof(data));
+    data.encryption_status.bd_addr = p_link->bd_addr;
+    data.encryption_status.transport = BT_TRANSPORT_LE;
+    data.encryption_status.result = (WICED_BT_SUCCESS == result) ? WICED_BT_SUCCESS : WICED_BT_ERROR;
+    (void)host_bt_stack_deliver_mgmt(BTM_ENCRYPTION_STATUS_EVT, &data);
+    host_bt_stack_pump();
+
+    return (WICED_BT_SUCCESS == result);
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_congest
+********************************************************************************
+* Summary:
+*   Changes the congestion of a link and delivers GATT_CONGESTION_EVT.
+*
+* Parameters:
+*   uint16_t conn_id       : Connection
+*   wiced_bool_t congested : WICED_TRUE while the link cannot take more PDUs
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_bt_stack_congest(uint16_t conn_id, wiced_bool_t congested)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    host_bt_stack_evt_t *p_evt;
+
+    if (NULL == p_link)
+    {
+        host_bt_stack_print("! %u not connected\n", conn_id);
+        return;
+    }
+
+    p_link->congested = congested;
+    p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_GATT, GATT_CONGESTION_EVT);
+    p_evt->data.gatt.congestion.conn_id = conn_id;
+    p_evt->data.gatt.congestion.congested = congested;
+    host_bt_stack_pump();
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_get_last_pdu
+********************************************************************************
+* Summary:
+*   Returns the last PDU the GATT server sent.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   const host_bt_stack_pdu_t*: Last PDU
+*
+*******************************************************************************/
+const host_bt_stack_pdu_t *host_bt_stack_get_last_pdu(void)
+{
+    return &host_bt_stack_last_pdu;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_get_pdu_count
+********************************************************************************
+* Summary:
+*   Returns the number of PDUs the GATT server sent.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint32_t: Number of PDUs
+*
+*******************************************************************************/
+uint32_t host_bt_stack_get_pdu_count(void)
+{
+    return host_bt_stack_pdu_count;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_get_error_count
+********************************************************************************
+* Summary:
+*   Returns the number of protocol errors of the application: responses
+*   missing, unexpected or longer than the MTU.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint32_t: Number of errors
+*
+*******************************************************************************/
+uint32_t host_bt_stack_get_error_count(void)
+{
+    return host_bt_stack_error_count;
+}
+
+/*******************************************************************************
+* Function Definitions: internal
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: host_bt_stack_print
+********************************************************************************
+* Summary:
+*   Prints a line of the transcript, unless the program runs quiet.
+*
+* Parameters:
+*   const char *p_fmt: printf() format and arguments
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_bt_stack_print(const char *p_fmt, ...)
+{
+    va_list args;
+
+    if (!host_sim_quiet)
+    {
+        va_start(args, p_fmt);
+        vprintf(p_fmt, args);
+        va_end(args);
+    }
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_error
+********************************************************************************
+* Summary:
+*   Reports a protocol error of the application. Errors are always printed.
+*
+* Parameters:
+*   const char *p_fmt: printf() format and arguments
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_bt_stack_error(const char *p_fmt, ...)
+{
+    va_list args;
+
+    host_bt_stack_error_count++;
+
+    printf("! ERROR ");
+    va_start(args, p_fmt);
+    vprintf(p_fmt, args);
+    va_end(args);
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_find_link
+********************************************************************************
+* Summary:
+*   Finds the link of a connection.
+*
+* Parameters:
+*   uint16_t conn_id: Connection
+*
+* Return:
+*   host_bt_stack_link_t*: Link, NULL if not connected
+*
+*******************************************************************************/
+static host_bt_stack_link_t *host_bt_stack_find_link(uint16_t conn_id)
+{
+    uint8_t i;
+
+    for (i = 0; i < HOST_BT_STACK_MAX_LINKS; i++)
+    {
+        if (host_bt_stack_links[i].connected && (conn_id == host_bt_stack_links[i].conn_id))
+        {
+            return &host_bt_stack_links[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_find_link_by_bda
+********************************************************************************
+* Summary:
+*   Finds the link of a peer.
+*
+* Parameters:
+*   const wiced_bt_device_address_t bd_addr: Address of the peer
+*
+* Return:
+*   host_bt_stack_link_t*: Link, NULL if not connected
+*
+*******************************************************************************/
+static host_bt_stack_link_t *host_bt_stack_find_link_by_bda(const wiced_bt_device_address_t bd_addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < HOST_BT_STACK_MAX_LINKS; i++)
+    {
+        if (host_bt_stack_links[i].connected &&
+            (0 == memcmp(bd_addr, host_bt_stack_links[i].bd_addr, BD_ADDR_LEN)))
+        {
+            return &host_bt_stack_links[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_queue
+********************************************************************************
+* Summary:
+*   Adds an event to the queue delivered by host_bt_stack_pump().
+*
+* Parameters:
+*   host_bt_stack_evt_kind_t kind: Callback the event is delivered to
+*   uint8_t event                : Event code
+*
+* Return:
+*   host_bt_stack_evt_t*: Event, with its data cleared
+*
+*******************************************************************************/
+static host_bt_stack_evt_t *host_bt_stack_queue(host_bt_stack_evt_kind_t kind, uint8_t event)
+{
+    host_bt_stack_evt_t *p_evt;
+
+    if ((host_bt_stack_evt_head - host_bt_stack_evt_tail) >= HOST_BT_STACK_EVT_QUEUE_SIZE)
+    {
+        printf("Simulated stack event queue full\n");
+        CY_ASSERT(0);
+    }
+
+    p_evt = &host_bt_stack_evt_queue[host_bt_stack_evt_head % HOST_BT_STACK_EVT_QUEUE_SIZE];
+    host_bt_stack_evt_head++;
+
+    memset(p_evt, 0, sizeof(*p_evt));
+    p_evt->kind = kind;
+    p_evt->event = event;
+
+    return p_evt;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_deliver
+********************************************************************************
+* Summary:
+*   Delivers a queued event to its callback.
+*
+* Parameters:
+*   host_bt_stack_evt_t *p_evt: Event
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_bt_stack_deliver(host_bt_stack_evt_t *p_evt)
+{
+    switch (p_evt->kind)
+    {
+        case HOST_BT_STACK_EVT_MGMT:
+            if (BTM_PAIRING_COMPLETE_EVT == p_evt->event)
+            {
+                p_evt->data.mgmt.pairing_complete.bd_addr = p_evt->bd_addr;
+            }
+            else if (BTM_ENCRYPTION_STATUS_EVT == p_evt->event)
+            {
+                p_evt->data.mgmt.encryption_status.bd_addr = p_evt->bd_addr;
+            }
+            (void)host_bt_stack_deliver_mgmt(p_evt->event, &p_evt->data.mgmt);
+            break;
+
+        case HOST_BT_STACK_EVT_GATT:
+            if (GATT_CONNECTION_STATUS_EVT == p_evt->event)
+            {
+                p_evt->data.gatt.connection_status.bd_addr = p_evt->bd_addr;
+            }
+            if (NULL != host_bt_stack_gatt_cback)
+            {
+                (void)host_bt_stack_gatt_cback(p_evt->event, &p_evt->data.gatt);
+            }
+            break;
+
+        case HOST_BT_STACK_EVT_SERIALIZED:
+            p_evt->data.serialized.fn(p_evt->data.serialized.p_data);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_deliver_mgmt
+********************************************************************************
+* Summary:
+*   Delivers a management event.
+*
+* Parameters:
+*   uint8_t event                         : Event code
+*   wiced_bt_management_evt_data_t *p_data: Event data
+*
+* Return:
+*   wiced_result_t: Result of the management callback
+*
+*******************************************************************************/
+static wiced_result_t host_bt_stack_deliver_mgmt(uint8_t event, wiced_bt_management_evt_data_t *p_data)
+{
+    return host_bt_stack_mgmt_cback(event, p_data);
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_send
+********************************************************************************
+* Summary:
+*   Sends a PDU of the GATT server: checks it against the link, keeps it for
+*   the driver and prints it. GATT_APP_BUFFER_TRANSMITTED_EVT returns the
+*   buffer of the application once the callback that sent it returns.
+*
+* Parameters:
+*   uint16_t conn_id     : Connection
+*   uint8_t opcode       : Opcode of the PDU
+*   uint16_t handle      : Handle of the PDU, if it has one
+*   const uint8_t *p_hdr : Parameters before the data
+*   uint16_t hdr_len     : Length of the parameters
+*   const uint8_t *p_data: Data
+*   uint16_t len         : Length of the data
+*   uint8_t *p_app_data  : Buffer of the application
+*   void *p_app_ctxt     : Context of the buffer, NULL if there is nothing to return
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_SUCCESS,
+*                           WICED_BT_GATT_INVALID_CONNECTION_ID if not connected
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t host_bt_stack_send(uint16_t conn_id, uint8_t opcode, uint16_t handle,
+                                                 const uint8_t *p_hdr, uint16_t hdr_len,
+                                                 const uint8_t *p_data, uint16_t len,
+                                                 uint8_t *p_app_data, void *p_app_ctxt)
+{
+    host_bt_stack_link_t *p_link = host_bt_stack_find_link(conn_id);
+    host_bt_stack_pdu_t *p_pdu = &host_bt_stack_last_pdu;
+    host_bt_stack_evt_t *p_evt;
+    wiced_bool_t is_rsp = (GATT_HANDLE_VALUE_NOTIF != opcode) && (GATT_HANDLE_VALUE_IND != opcode);
+    uint16_t i;
+
+    if (NULL != p_app_ctxt)
+    {
+        p_evt = host_bt_stack_queue(HOST_BT_STACK_EVT_GATT, GATT_APP_BUFFER_TRANSMITTED_EVT);
+        p_evt->data.gatt.buffer_xmitted.p_app_data = p_app_data;
+        p_evt->data.gatt.buffer_xmitted.p_app_ctxt = p_app_ctxt;
+    }
+
+    if (NULL == p_link)
+    {
+        host_bt_stack_error("%s on connection %u, which is not connected\n",
+                            host_bt_stack_opcode_name(opcode), conn_id);
+        return WICED_BT_GATT_INVALID_CONNECTION_ID;
+    }
+
+    if (is_rsp)
+    {
+        if (!p_link->rsp_pending)
+        {
+            host_bt_stack_error("%s on connection %u without a request\n", host_bt_stack_opcode_name(opcode), conn_id);
+        }
+        p_link->rsp_pending = WICED_FALSE;
+    }
+    if ((1u + hdr_len + len) > p_link->mtu)
+    {
+        host_bt_stack_error("%s of %u bytes on connection %u, MTU %u\n", host_bt_stack_opcode_name(opcode),
+                            1u + hdr_len + len, conn_id, p_link->mtu);
+    }
+
+    if (GATT_RSP_ERROR != opcode)
+    {
+        p_pdu->req_opcode = 0;
+        p_pdu->status = WICED_BT_GATT_SUCCESS;
+    }
+    p_pdu->conn_id = conn_id;
+    p_pdu->opcode = opcode;
+    p_pdu->handle = handle;
+    p_pdu->len = (uint16_t)MIN(len, sizeof(p_pdu->data));
+    if (0u != p_pdu->len)
+    {
+        memcpy(p_pdu->data, p_data, p_pdu->len);
+    }
+    host_bt_stack_pdu_count++;
+
+    if (!host_sim_quiet)
+    {
+        printf("< %u %s", conn_id, host_bt_stack_opcode_name(opcode));
+        for (i = 0; i < hdr_len; i++)
+        {
+            printf(" %02x", p_hdr[i]);
+        }
+        if ((0u != hdr_len) && (0u != len))
+        {
+            printf(" |");
+        }
+        for (i = 0; (i < len) && (i < HOST_BT_STACK_MAX_DUMP_LEN); i++)
+        {
+            printf(" %02x", p_data[i]);
+        }
+        if (len > HOST_BT_STACK_MAX_DUMP_LEN)
+        {
+            printf(" ... (%u bytes)", len);
+        }
+        printf("\n");
+    }
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_unlink_timer
+********************************************************************************
+* Summary:
+*   Removes a timer from the running timers.
+*
+* Parameters:
+*   wiced_timer_t *p_timer: Timer
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_bt_stack_unlink_timer(wiced_timer_t *p_timer)
+{
+    wiced_timer_t **pp_timer;
+
+    if (!p_timer->in_use)
+    {
+        return;
+    }
+
+    for (pp_timer = &host_bt_stack_timers; NULL != *pp_timer; pp_timer = &(*pp_timer)->next)
+    {
+        if (p_timer == *pp_timer)
+        {
+            *pp_timer = p_timer->next;
+            break;
+        }
+    }
+    p_timer->next = NULL;
+    p_timer->in_use = WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: host_bt_stack_opcode_name
+********************************************************************************
+* Summary:
+*   Returns the name of an ATT opcode for the transcript.
+*
+* Parameters:
+*   uint8_t opcode: Opcode
+*
+* Return:
+*   const char*: Name
+*
+*******************************************************************************/
+static const char *host_bt_stack_opcode_name(uint8_t opcode)
+{
+    switch (opcode)
+    {
+        case GATT_RSP_ERROR:                    return "ERROR_RSP";
+        case GATT_REQ_MTU:                      return "MTU_REQ";
+        case GATT_RSP_MTU:                      return "MTU_RSP";
+        case GATT_REQ_READ_BY_TYPE:             return "READ_BY_TYPE_REQ";
+        case GATT_RSP_READ_BY_TYPE:             return "READ_BY_TYPE_RSP";
+        case GATT_REQ_READ:                     return "READ_REQ";
+        case GATT_RSP_READ:                     return "READ_RSP";
+        case GATT_REQ_READ_BLOB:                return "READ_BLOB_REQ";
+        case GATT_RSP_READ_BLOB:                return "READ_BLOB_RSP";
+        case GATT_REQ_READ_MULTI:               return "READ_MULTI_REQ";
+        case GATT_RSP_READ_MULTI:               return "READ_MULTI_RSP";
+        case GATT_REQ_WRITE:                    return "WRITE_REQ";
+        case GATT_RSP_WRITE:                    return "WRITE_RSP";
+        case GATT_REQ_PREPARE_WRITE:            return "PREPARE_WRITE_REQ";
+        case GATT_RSP_PREPARE_WRITE:            return "PREPARE_WRITE_RSP";
+        case GATT_REQ_EXECUTE_WRITE:            return "EXECUTE_WRITE_REQ";
+        case GATT_RSP_EXECUTE_WRITE:            return "EXECUTE_WRITE_RSP";
+        case GATT_HANDLE_VALUE_NOTIF:           return "NOTIFICATION";
+        case GATT_HANDLE_VALUE_IND:             return "INDICATION";
+        case GATT_HANDLE_VALUE_CONF:            return "CONFIRMATION";
+        case GATT_REQ_READ_MULTI_VAR_LENGTH:    return "READ_MULTI_VAR_REQ";
+        case GATT_RSP_READ_MULTI_VAR_LENGTH:    return "READ_MULTI_VAR_RSP";
+        case GATT_CMD_WRITE:                    return "WRITE_CMD";
+        default:                                return "PDU";
+    }
+}
+
+/* END OF FILE [] */
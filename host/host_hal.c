@@ -0,0 +1,610 @@
+/******************************************************************************
+* File Name:   host_hal.c
+*
+* Description: Board stand-in of the host build: the BSP and retarget-io initialization,
+*              the PWM driven LEDs, the user button and a flash block kept in RAM, with
+*              the geometry of the PSOC 6 work flash. The flash can be loaded from and
+*              saved to a file so that bonds survive a restart of the program.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "cyhal.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+#include "cybsp_bt_config.h"
+#include "host_sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* PSOC 6 work flash */
+#define HOST_HAL_FLASH_START            (0x14000000u)
+#define HOST_HAL_FLASH_SIZE             (0x8000u)
+#define HOST_HAL_FLASH_SECTOR_SIZE      (512u)
+#define HOST_HAL_FLASH_PAGE_SIZE        (512u)
+#define HOST_HAL_FLASH_ERASE_VALUE      (0x00u)
+
+#define HOST_HAL_MAX_CALLBACKS          (4u)
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+const cybt_platform_config_t cybsp_bt_platform_cfg =
+{
+    .hci_baudrate = 3000000u,
+};
+
+static const cyhal_flash_block_info_t host_hal_flash_block =
+{
+    .start_address  = HOST_HAL_FLASH_START,
+    .size           = HOST_HAL_FLASH_SIZE,
+    .sector_size    = HOST_HAL_FLASH_SECTOR_SIZE,
+    .page_size      = HOST_HAL_FLASH_PAGE_SIZE,
+    .erase_value    = HOST_HAL_FLASH_ERASE_VALUE,
+};
+
+/* Starts erased, the erase value is 0x00 */
+static uint8_t                      host_hal_flash[HOST_HAL_FLASH_SIZE];
+
+static cyhal_gpio_callback_data_t  *host_hal_callbacks[HOST_HAL_MAX_CALLBACKS];
+static cyhal_gpio_event_t           host_hal_events[HOST_HAL_MAX_CALLBACKS];
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void host_hal_pwm_report(const cyhal_pwm_t *obj);
+static wiced_bool_t host_hal_flash_check(uint32_t address, size_t size);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cybsp_init
+********************************************************************************
+* Summary:
+*   Initializes the board, nothing to do on the host.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_retarget_io_init
+********************************************************************************
+* Summary:
+*   Sends printf() to the standard output, one line at a time so that the
+*   output of the tasks and of the stack thread do not mix.
+*
+* Parameters:
+*   cyhal_gpio_t tx, rx: Not used
+*   uint32_t baudrate  : Not used
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cy_retarget_io_init(cyhal_gpio_t tx, cyhal_gpio_t rx, uint32_t baudrate)
+{
+    CY_UNUSED_PARAMETER(tx);
+    CY_UNUSED_PARAMETER(rx);
+    CY_UNUSED_PARAMETER(baudrate);
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cybt_platform_config_init
+********************************************************************************
+* Summary:
+*   Nothing to configure, there is no HCI transport.
+*
+* Parameters:
+*   const cybt_platform_config_t *p_bt_platform_cfg: Not used
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void cybt_platform_config_init(const cybt_platform_config_t *p_bt_platform_cfg)
+{
+    CY_UNUSED_PARAMETER(p_bt_platform_cfg);
+}
+
+/*******************************************************************************
+* Function Name: cyhal_pwm_init_adv
+********************************************************************************
+* Summary:
+*   Initializes the PWM of an LED, stopped.
+*
+* Parameters:
+*   See the HAL documentation, only the pin is used.
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_pwm_init_adv(cyhal_pwm_t *obj, cyhal_gpio_t pin, cyhal_gpio_t compl_pin,
+                             cyhal_pwm_alignment_t pwm_alignment, bool continuous,
+                             uint32_t dead_time_us, bool invert, const cyhal_clock_t *clk)
+{
+    CY_UNUSED_PARAMETER(compl_pin);
+    CY_UNUSED_PARAMETER(pwm_alignment);
+    CY_UNUSED_PARAMETER(continuous);
+    CY_UNUSED_PARAMETER(dead_time_us);
+    CY_UNUSED_PARAMETER(invert);
+    CY_UNUSED_PARAMETER(clk);
+
+    memset(obj, 0, sizeof(*obj));
+    obj->pin = pin;
+    obj->duty_cycle = 100.0f;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_pwm_set_duty_cycle
+********************************************************************************
+* Summary:
+*   Sets the duty cycle of an LED. The LEDs are active low.
+*
+* Parameters:
+*   cyhal_pwm_t *obj        : PWM
+*   float duty_cycle        : Percent of the period the output is high
+*   uint32_t frequencyhal_hz: Frequency of the PWM
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_pwm_set_duty_cycle(cyhal_pwm_t *obj, float duty_cycle, uint32_t frequencyhal_hz)
+{
+    obj->duty_cycle = duty_cycle;
+    obj->frequency_hz = frequencyhal_hz;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_pwm_start
+********************************************************************************
+* Summary:
+*   Starts the PWM of an LED and reports the state of the LED.
+*
+* Parameters:
+*   cyhal_pwm_t *obj: PWM
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_pwm_start(cyhal_pwm_t *obj)
+{
+    obj->running = true;
+    host_hal_pwm_report(obj);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_pwm_stop
+********************************************************************************
+* Summary:
+*   Stops the PWM of an LED.
+*
+* Parameters:
+*   cyhal_pwm_t *obj: PWM
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_pwm_stop(cyhal_pwm_t *obj)
+{
+    obj->running = false;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_gpio_init
+********************************************************************************
+* Summary:
+*   Initializes a pin, nothing to do on the host.
+*
+* Parameters:
+*   See the HAL documentation.
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                          cyhal_gpio_drive_mode_t drive_mode, bool init_val)
+{
+    CY_UNUSED_PARAMETER(pin);
+    CY_UNUSED_PARAMETER(direction);
+    CY_UNUSED_PARAMETER(drive_mode);
+    CY_UNUSED_PARAMETER(init_val);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_gpio_register_callback
+********************************************************************************
+* Summary:
+*   Registers the interrupt handler of a pin.
+*
+* Parameters:
+*   cyhal_gpio_t pin                          : Pin
+*   cyhal_gpio_callback_data_t *callback_data : Handler, NULL to remove it
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void cyhal_gpio_register_callback(cyhal_gpio_t pin, cyhal_gpio_callback_data_t *callback_data)
+{
+    CY_ASSERT(pin < HOST_HAL_MAX_CALLBACKS);
+
+    if (NULL != callback_data)
+    {
+        callback_data->pin = pin;
+    }
+    host_hal_callbacks[pin] = callback_data;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_gpio_enable_event
+********************************************************************************
+* Summary:
+*   Enables or disables the interrupt of a pin.
+*
+* Parameters:
+*   cyhal_gpio_t pin         : Pin
+*   cyhal_gpio_event_t event : Edges that interrupt
+*   uint8_t intr_priority    : Not used
+*   bool enable              : true to enable the edges, false to disable them
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void cyhal_gpio_enable_event(cyhal_gpio_t pin, cyhal_gpio_event_t event, uint8_t intr_priority,
+                             bool enable)
+{
+    CY_UNUSED_PARAMETER(intr_priority);
+    CY_ASSERT(pin < HOST_HAL_MAX_CALLBACKS);
+
+    host_hal_events[pin] = enable ? (cyhal_gpio_event_t)(host_hal_events[pin] | event) :
+                                    (cyhal_gpio_event_t)(host_hal_events[pin] & ~event);
+}
+
+/*******************************************************************************
+* Function Name: host_hal_press_button
+********************************************************************************
+* Summary:
+*   Presses the user button: runs its interrupt handler on a falling edge.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_hal_press_button(void)
+{
+    cyhal_gpio_callback_data_t *p_cb = host_hal_callbacks[CYBSP_USER_BTN];
+
+    if ((NULL != p_cb) && (0 != (host_hal_events[CYBSP_USER_BTN] & CYHAL_GPIO_IRQ_FALL)))
+    {
+        p_cb->callback(p_cb->callback_arg, CYHAL_GPIO_IRQ_FALL);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cyhal_flash_init
+********************************************************************************
+* Summary:
+*   Opens the flash.
+*
+* Parameters:
+*   cyhal_flash_t *obj: Flash
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cyhal_flash_init(cyhal_flash_t *obj)
+{
+    obj->opened = true;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_flash_free
+********************************************************************************
+* Summary:
+*   Closes the flash.
+*
+* Parameters:
+*   cyhal_flash_t *obj: Flash
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void cyhal_flash_free(cyhal_flash_t *obj)
+{
+    obj->opened = false;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_flash_get_info
+********************************************************************************
+* Summary:
+*   Returns the geometry of the flash: one block.
+*
+* Parameters:
+*   const cyhal_flash_t *obj: Flash
+*   cyhal_flash_info_t *info: Set to the blocks of the flash
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void cyhal_flash_get_info(const cyhal_flash_t *obj, cyhal_flash_info_t *info)
+{
+    CY_UNUSED_PARAMETER(obj);
+
+    info->block_count = 1u;
+    info->blocks = &host_hal_flash_block;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_flash_read
+********************************************************************************
+* Summary:
+*   Reads the flash.
+*
+* Parameters:
+*   cyhal_flash_t *obj: Flash
+*   uint32_t address  : Address of the first byte
+*   uint8_t *data     : Set to the bytes read
+*   size_t size       : Number of bytes to read
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS, CY_RSLT_HOST_ERROR outside the flash
+*
+*******************************************************************************/
+cy_rslt_t cyhal_flash_read(cyhal_flash_t *obj, uint32_t address, uint8_t *data, size_t size)
+{
+    if (!obj->opened || !host_hal_flash_check(address, size))
+    {
+        return CY_RSLT_HOST_ERROR;
+    }
+
+    memcpy(data, &host_hal_flash[address - HOST_HAL_FLASH_START], size);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_flash_erase
+********************************************************************************
+* Summary:
+*   Erases a sector of the flash.
+*
+* Parameters:
+*   cyhal_flash_t *obj: Flash
+*   uint32_t address  : Address of the sector
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS, CY_RSLT_HOST_ERROR for an address that does
+*              not start a sector
+*
+*******************************************************************************/
+cy_rslt_t cyhal_flash_erase(cyhal_flash_t *obj, uint32_t address)
+{
+    if (!obj->opened || !host_hal_flash_check(address, HOST_HAL_FLASH_SECTOR_SIZE) ||
+        (0u != ((address - HOST_HAL_FLASH_START) % HOST_HAL_FLASH_SECTOR_SIZE)))
+    {
+        return CY_RSLT_HOST_ERROR;
+    }
+
+    memset(&host_hal_flash[address - HOST_HAL_FLASH_START], HOST_HAL_FLASH_ERASE_VALUE,
+           HOST_HAL_FLASH_SECTOR_SIZE);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_flash_program
+********************************************************************************
+* Summary:
+*   Programs a page of the flash. As on PSOC 6 the page is erased first, so
+*   the page holds the data afterwards.
+*
+* Parameters:
+*   cyhal_flash_t *obj  : Flash
+*   uint32_t address    : Address of the page
+*   const uint32_t *data: Content of the page
+*
+* Return:
+*   cy_rslt_t: CY_RSLT_SUCCESS, CY_RSLT_HOST_ERROR for an address that does
+*              not start a page
+*
+*******************************************************************************/
+cy_rslt_t cyhal_flash_program(cyhal_flash_t *obj, uint32_t address, const uint32_t *data)
+{
+    if (!obj->opened || !host_hal_flash_check(address, HOST_HAL_FLASH_PAGE_SIZE) ||
+        (0u != ((address - HOST_HAL_FLASH_START) % HOST_HAL_FLASH_PAGE_SIZE)))
+    {
+        return CY_RSLT_HOST_ERROR;
+    }
+
+    memcpy(&host_hal_flash[address - HOST_HAL_FLASH_START], data, HOST_HAL_FLASH_PAGE_SIZE);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: host_hal_flash_load
+********************************************************************************
+* Summary:
+*   Loads the flash from a file saved by host_hal_flash_save(). A missing
+*   file leaves the flash erased.
+*
+* Parameters:
+*   const char *p_path: File
+*
+* Return:
+*   wiced_bool_t: WICED_FALSE if the file exists but cannot be read
+*
+*******************************************************************************/
+wiced_bool_t host_hal_flash_load(const char *p_path)
+{
+    FILE *p_file = fopen(p_path, "rb");
+    size_t len;
+
+    if (NULL == p_file)
+    {
+        return WICED_TRUE;
+    }
+
+    len = fread(host_hal_flash, 1, sizeof(host_hal_flash), p_file);
+    fclose(p_file);
+
+    return (sizeof(host_hal_flash) == len);
+}
+
+/*******************************************************************************
+* Function Name: host_hal_flash_save
+********************************************************************************
+* Summary:
+*   Saves the flash to a file.
+*
+* Parameters:
+*   const char *p_path: File
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the file was written
+*
+*******************************************************************************/
+wiced_bool_t host_hal_flash_save(const char *p_path)
+{
+    FILE *p_file = fopen(p_path, "wb");
+    size_t len;
+
+    if (NULL == p_file)
+    {
+        return WICED_FALSE;
+    }
+
+    len = fwrite(host_hal_flash, 1, sizeof(host_hal_flash), p_file);
+
+    return (0 == fclose(p_file)) && (sizeof(host_hal_flash) == len);
+}
+
+/*******************************************************************************
+* Function Name: host_hal_pwm_report
+********************************************************************************
+* Summary:
+*   Prints the state of an LED when it changes.
+*
+* Parameters:
+*   const cyhal_pwm_t *obj: PWM of the LED
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_hal_pwm_report(const cyhal_pwm_t *obj)
+{
+    static const char *led_state[] = { "on", "blinking", "off" };
+    static uint8_t last_state[HOST_HAL_MAX_CALLBACKS] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    uint8_t state;
+
+    state = (obj->duty_cycle <= 0.0f) ? 0u : ((obj->duty_cycle >= 100.0f) ? 2u : 1u);
+    if ((obj->pin < HOST_HAL_MAX_CALLBACKS) && (state != last_state[obj->pin]))
+    {
+        last_state[obj->pin] = state;
+        if (!host_sim_quiet)
+        {
+            printf("[HAL] LED%lu %s\n", (unsigned long)obj->pin, led_state[state]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: host_hal_flash_check
+********************************************************************************
+* Summary:
+*   Checks that a range of addresses is in the flash.
+*
+* Parameters:
+*   uint32_t address: Address of the first byte
+*   size_t size     : Number of bytes
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the whole range is in the flash
+*
+*******************************************************************************/
+static wiced_bool_t host_hal_flash_check(uint32_t address, size_t size)
+{
+    return (address >= HOST_HAL_FLASH_START) &&
+           ((address - HOST_HAL_FLASH_START) <= HOST_HAL_FLASH_SIZE) &&
+           (size <= (HOST_HAL_FLASH_SIZE - (address - HOST_HAL_FLASH_START)));
+}
+
+/* END OF FILE [] */
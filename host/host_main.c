@@ -0,0 +1,734 @@
+/******************************************************************************
+* File Name:   host_main.c
+*
+* Description: Entry point of the host build. Parses the command line, then runs the
+*              application, main() of main.c renamed app_main(), with a driver: a replay
+*              of client and controller events read from a script, or a benchmark.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "wiced_bt_gatt.h"
+#include "cy_utils.h"
+#include "host_sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_MAIN_MAX_LINE_LEN          (2048u)
+#define HOST_MAIN_MAX_TOKENS            (520u)
+
+/* Exit status of the program */
+#define HOST_MAIN_STATUS_PASS           (0)
+#define HOST_MAIN_STATUS_FAIL           (1)
+#define HOST_MAIN_STATUS_USAGE          (2)
+#define HOST_MAIN_STATUS_ASSERT         (3)
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+/* Set by -q: no transcript, only errors and results */
+wiced_bool_t host_sim_quiet = WICED_FALSE;
+
+static const char *host_main_flash_path;
+static const char *host_main_script_path;
+static uint32_t    host_main_line;
+static uint32_t    host_main_failures;
+static uint32_t    host_main_pdu_mark;      /* PDUs sent before the last command */
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void host_main_usage(const char *p_prog);
+static int host_main_replay(int argc, char **argv);
+static wiced_bool_t host_main_run_command(int argc, char **argv);
+static wiced_bool_t host_main_parse_num(const char *p_str, uint32_t max, uint32_t *p_value);
+static wiced_bool_t host_main_parse_bda(const char *p_str, wiced_bt_device_address_t bd_addr);
+static int host_main_parse_bytes(int argc, char **argv, uint8_t *p_buf, int buf_len);
+static wiced_bool_t host_main_expect(int argc, char **argv);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*   Parses the command line and runs the application with the replay or the
+*   benchmark it selects.
+*
+*   host_findme [-q] [--flash <file>] <script>|-
+*   host_findme -b <benchmark> [<arguments>]
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Arguments
+*
+* Return:
+*   int: 0 if the replay or benchmark passed, 1 if it failed, 2 for a usage
+*        error, 3 if the application asserted
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    wiced_bool_t driver_set = WICED_FALSE;
+    int i = 1;
+
+    while ((i < argc) && !driver_set)
+    {
+        if (0 == strcmp(argv[i], "-q"))
+        {
+            host_sim_quiet = WICED_TRUE;
+            i++;
+        }
+        else if ((0 == strcmp(argv[i], "--flash")) && ((i + 1) < argc))
+        {
+            host_main_flash_path = argv[i + 1];
+            i += 2;
+        }
+        else if ((0 == strcmp(argv[i], "-b")) && ((i + 1) < argc))
+        {
+            /* Benchmarks time the application alone: no transcript and no log task */
+            host_sim_quiet = WICED_TRUE;
+            host_rtos_disable_tasks();
+            host_rtos_set_driver(host_bench_run, argc - (i + 1), &argv[i + 1]);
+            driver_set = WICED_TRUE;
+        }
+        else if ((('-' != argv[i][0]) || (0 == strcmp(argv[i], "-"))) && ((i + 1) == argc))
+        {
+            host_main_script_path = argv[i];
+            host_rtos_set_driver(host_main_replay, 0, NULL);
+            driver_set = WICED_TRUE;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (!driver_set)
+    {
+        host_main_usage(argv[0]);
+        return HOST_MAIN_STATUS_USAGE;
+    }
+
+    if ((NULL != host_main_flash_path) && !host_hal_flash_load(host_main_flash_path))
+    {
+        printf("Cannot load the flash from %s\n", host_main_flash_path);
+        return HOST_MAIN_STATUS_USAGE;
+    }
+
+    /* Does not return: the scheduler exits with the status of the driver */
+    return app_main();
+}
+
+/*******************************************************************************
+* Function Name: host_assert_failed
+********************************************************************************
+* Summary:
+*   CY_ASSERT() of the host build: reports where the application halted and
+*   exits.
+*
+* Parameters:
+*   const char *p_file: Source file of the assertion
+*   int line          : Line of the assertion
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_assert_failed(const char *p_file, int line)
+{
+    printf("! ASSERT %s:%d", p_file, line);
+    if (0u != host_main_line)
+    {
+        printf(" at line %lu of %s", (unsigned long)host_main_line, host_main_script_path);
+    }
+    printf("\n");
+    fflush(stdout);
+
+    exit(HOST_MAIN_STATUS_ASSERT);
+}
+
+/*******************************************************************************
+* Function Name: host_main_usage
+********************************************************************************
+* Summary:
+*   Prints the command line and the replay commands.
+*
+* Parameters:
+*   const char *p_prog: Name of the program
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void host_main_usage(const char *p_prog)
+{
+    printf("usage: %s [-q] [--flash <file>] <script>|-\n"
+           "       %s -b <benchmark> [<arguments>]\n"
+           "\n"
+           "Replay commands, one per line, numbers in C notation, # starts a comment:\n"
+           "  connect <conn> <bd addr> [random]    disconnect <conn> [reason]\n"
+           "  mtu <conn> <mtu>                     read <conn> <handle> [offset]\n"
+           "  write <conn> <handle> <bytes>        write_cmd <conn> <handle> <bytes>\n"
+           "  prepare <conn> <handle> <offset> <bytes>\n"
+           "  execute <conn> 0|1                   confirm <conn> <handle>\n"
+           "  read_by_type <conn> <start> <end> <uuid16>\n"
+           "  read_multi <conn> <handles>          read_multi_var <conn> <handles>\n"
+           "  pair <conn>    encrypt <conn>        congest <conn> 0|1\n"
+           "  wait <ms>      button\n"
+           "  expect <response> [<bytes>]          expect error <opcode> <handle> <status>\n"
+           "  expect none\n"
+           "\n"
+           "Benchmarks:\n", p_prog, p_prog);
+    host_bench_list();
+}
+
+/*******************************************************************************
+* Function Name: host_main_replay
+********************************************************************************
+* Summary:
+*   Driver of a replay: runs the commands of the script, letting the tasks
+*   run after each one, then saves the flash.
+*
+* Parameters:
+*   int argc   : Not used
+*   char **argv: Not used
+*
+* Return:
+*   int: HOST_MAIN_STATUS_PASS if no command failed and the application made
+*        no protocol error
+*
+*******************************************************************************/
+static int host_main_replay(int argc, char **argv)
+{
+    static char line[HOST_MAIN_MAX_LINE_LEN];
+    static char *tokens[HOST_MAIN_MAX_TOKENS];
+    FILE *p_script;
+    char *p_token;
+    int num_tokens;
+
+    CY_UNUSED_PARAMETER(argc);
+    CY_UNUSED_PARAMETER(argv);
+
+    p_script = (0 == strcmp(host_main_script_path, "-")) ? stdin : fopen(host_main_script_path, "r");
+    if (NULL == p_script)
+    {
+        printf("Cannot open %s\n", host_main_script_path);
+        return HOST_MAIN_STATUS_USAGE;
+    }
+
+    while (NULL != fgets(line, sizeof(line), p_script))
+    {
+        host_main_line++;
+
+        p_token = strchr(line, '#');
+        if (NULL != p_token)
+        {
+            *p_token = '\0';
+        }
+
+        num_tokens = 0;
+        for (p_token = strtok(line, " \t\r\n"); (NULL != p_token) && (num_tokens < (int)HOST_MAIN_MAX_TOKENS);
+             p_token = strtok(NULL, " \t\r\n"))
+        {
+            tokens[num_tokens++] = p_token;
+        }
+        if (0 == num_tokens)
+        {
+            continue;
+        }
+
+        if (!host_sim_quiet)
+        {
+            printf(">");
+            for (int i = 0; i < num_tokens; i++)
+            {
+                printf(" %s", tokens[i]);
+            }
+            printf("\n");
+        }
+
+        if (!host_main_run_command(num_tokens, tokens))
+        {
+            host_main_failures++;
+            printf("! FAILED line %lu\n", (unsigned long)host_main_line);
+        }
+
+        /* Let the log task print what the command caused */
+        host_rtos_idle();
+    }
+
+    if (stdin != p_script)
+    {
+        (void)fclose(p_script);
+    }
+
+    if ((NULL != host_main_flash_path) && !host_hal_flash_save(host_main_flash_path))
+    {
+        printf("Cannot save the flash to %s\n", host_main_flash_path);
+        host_main_failures++;
+    }
+
+    printf("%lu commands failed, %lu protocol errors\n", (unsigned long)host_main_failures,
+           (unsigned long)host_bt_stack_get_error_count());
+
+    return ((0u == host_main_failures) && (0u == host_bt_stack_get_error_count())) ?
+           HOST_MAIN_STATUS_PASS : HOST_MAIN_STATUS_FAIL;
+}
+
+/*******************************************************************************
+* Function Name: host_main_run_command
+********************************************************************************
+* Summary:
+*   Runs a command of a replay.
+*
+* Parameters:
+*   int argc   : Number of tokens of the command
+*   char **argv: Tokens of the command
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the command was valid and succeeded
+*
+*******************************************************************************/
+static wiced_bool_t host_main_run_command(int argc, char **argv)
+{
+    static uint8_t value[HOST_BT_STACK_MAX_PDU_LEN];
+    static uint8_t handles[HOST_BT_STACK_MAX_PDU_LEN];
+    wiced_bt_gatt_request_data_t req;
+    wiced_bt_device_address_t bd_addr;
+    const char *p_cmd = argv[0];
+    uint32_t conn_id = 0;
+    uint32_t arg[3] = { 0 };
+    int len;
+    int i;
+
+    memset(&req, 0, sizeof(req));
+
+    if (0 == strcmp(p_cmd, "wait"))
+    {
+        if ((2 != argc) || !host_main_parse_num(argv[1], UINT32_MAX, &arg[0]))
+        {
+            return WICED_FALSE;
+        }
+        host_bt_stack_advance(arg[0]);
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "button"))
+    {
+        host_hal_press_button();
+        host_bt_stack_pump();
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "expect"))
+    {
+        return host_main_expect(argc - 1, &argv[1]);
+    }
+
+    host_main_pdu_mark = host_bt_stack_get_pdu_count();
+
+    /* Every other command names a connection */
+    if ((argc < 2) || !host_main_parse_num(argv[1], UINT16_MAX, &conn_id))
+    {
+        return WICED_FALSE;
+    }
+
+    if (0 == strcmp(p_cmd, "connect"))
+    {
+        if ((argc < 3) || (argc > 4) || !host_main_parse_bda(argv[2], bd_addr) ||
+            ((4 == argc) && (0 != strcmp(argv[3], "random"))))
+        {
+            return WICED_FALSE;
+        }
+        return host_bt_stack_connect((uint16_t)conn_id, bd_addr,
+                                     (4 == argc) ? BLE_ADDR_RANDOM : BLE_ADDR_PUBLIC);
+    }
+    if (0 == strcmp(p_cmd, "disconnect"))
+    {
+        arg[0] = GATT_CONN_TERMINATE_PEER_USER;
+        if ((argc > 3) || ((3 == argc) && !host_main_parse_num(argv[2], UINT16_MAX, &arg[0])))
+        {
+            return WICED_FALSE;
+        }
+        return host_bt_stack_disconnect((uint16_t)conn_id, (wiced_bt_gatt_disconn_reason_t)arg[0]);
+    }
+    if (0 == strcmp(p_cmd, "pair"))
+    {
+        return (2 == argc) && host_bt_stack_pair((uint16_t)conn_id);
+    }
+    if (0 == strcmp(p_cmd, "encrypt"))
+    {
+        return (2 == argc) && host_bt_stack_encrypt((uint16_t)conn_id);
+    }
+    if (0 == strcmp(p_cmd, "congest"))
+    {
+        if ((3 != argc) || !host_main_parse_num(argv[2], 1, &arg[0]))
+        {
+            return WICED_FALSE;
+        }
+        host_bt_stack_congest((uint16_t)conn_id, (wiced_bool_t)arg[0]);
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "mtu"))
+    {
+        if ((3 != argc) || !host_main_parse_num(argv[2], UINT16_MAX, &arg[0]))
+        {
+            return WICED_FALSE;
+        }
+        req.remote_mtu = (uint16_t)arg[0];
+        (void)host_bt_stack_request((uint16_t)conn_id, GATT_REQ_MTU, &req);
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "read"))
+    {
+        if ((argc < 3) || (argc > 4) || !host_main_parse_num(argv[2], UINT16_MAX, &arg[0]) ||
+            ((4 == argc) && !host_main_parse_num(argv[3], UINT16_MAX, &arg[1])))
+        {
+            return WICED_FALSE;
+        }
+        req.read_req.handle = (uint16_t)arg[0];
+        req.read_req.offset = (uint16_t)arg[1];
+        (void)host_bt_stack_request((uint16_t)conn_id, (4 == argc) ? GATT_REQ_READ_BLOB : GATT_REQ_READ, &req);
+        return WICED_TRUE;
+    }
+    if ((0 == strcmp(p_cmd, "write")) || (0 == strcmp(p_cmd, "write_cmd")))
+    {
+        if ((argc < 3) || !host_main_parse_num(argv[2], UINT16_MAX, &arg[0]))
+        {
+            return WICED_FALSE;
+        }
+        len = host_main_parse_bytes(argc - 3, &argv[3], value, sizeof(value));
+        if (len < 0)
+        {
+            return WICED_FALSE;
+        }
+        req.write_req.handle = (uint16_t)arg[0];
+        req.write_req.val_len = (uint16_t)len;
+        req.write_req.p_val = value;
+        (void)host_bt_stack_request((uint16_t)conn_id, ('_' == p_cmd[5]) ? GATT_CMD_WRITE : GATT_REQ_WRITE, &req);
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "prepare"))
+    {
+        if ((argc < 4) || !host_main_parse_num(argv[2], UINT16_MAX, &arg[0]) ||
+            !host_main_parse_num(argv[3], UINT16_MAX, &arg[1]))
+        {
+            return WICED_FALSE;
+        }
+        len = host_main_parse_bytes(argc - 4, &argv[4], value, sizeof(value));
+        if (len < 0)
+        {
+            return WICED_FALSE;
+        }
+        req.write_req.handle = (uint16_t)arg[0];
+        req.write_req.offset = (uint16_t)arg[1];
+        req.write_req.val_len = (uint16_t)len;
+        req.write_req.p_val = value;
+        (void)host_bt_stack_request((uint16_t)conn_id, GATT_REQ_PREPARE_WRITE, &req);
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "execute"))
+    {
+        if ((3 != argc) || !host_main_parse_num(argv[2], 1, &arg[0]))
+        {
+            return WICED_FALSE;
+        }
+        req.exec_write_req = (0u != arg[0]) ? GATT_PREPARE_WRITE_EXEC : GATT_PREPARE_WRITE_CANCEL;
+        (void)host_bt_stack_request((uint16_t)conn_id, GATT_REQ_EXECUTE_WRITE, &req);
+        return WICED_TRUE;
+    }
+    if (0 == strcmp(p_cmd, "confirm"))
+    {
+        if ((3 != argc) || !host_main_parse_num(argv[2], UINT16_MAX, &arg[0]))
+        {
+            return WICED_FALSE;
+        }
+        req.confirm_handle = (uint16_t)arg[0];
+        return (WICED_BT_GATT_SUCCESS == host_bt_stack_request((uint16_t)conn_id, GATT_HANDLE_VALUE_CONF, &req));
+    }
+    if (0 == strcmp(p_cmd, "read_by_type"))
+    {
+        if ((5 != argc) || !host_main_parse_num(argv[2], UINT16_MAX, &arg[0]) ||
+            !host_main_parse_num(argv[3], UINT16_MAX, &arg[1]) ||
+            !host_main_parse_num(argv[4], UINT16_MAX, &arg[2]))
+        {
+            return WICED_FALSE;
+        }
+        req.read_by_type.s_handle = (uint16_t)arg[0];
+        req.read_by_type.e_handle = (uint16_t)arg[1];
+        req.read_by_type.uuid.len = LEN_UUID_16;
+        req.read_by_type.uuid.uu.uuid16 = (uint16_t)arg[2];
+        (void)host_bt_stack_request((uint16_t)conn_id, GATT_REQ_READ_BY_TYPE, &req);
+        return WICED_TRUE;
+    }
+    if ((0 == strcmp(p_cmd, "read_multi")) || (0 == strcmp(p_cmd, "read_multi_var")))
+    {
+        if ((argc < 4) || ((argc - 2) > (int)(sizeof(handles) / 2u)))
+        {
+            return WICED_FALSE;
+        }
+        for (i = 2; i < argc; i++)
+        {
+            if (!host_main_parse_num(argv[i], UINT16_MAX, &arg[0]))
+            {
+                return WICED_FALSE;
+            }
+            handles[2 * (i - 2)] = (uint8_t)(arg[0] & 0xFFu);
+            handles[(2 * (i - 2)) + 1] = (uint8_t)(arg[0] >> 8);
+        }
+        req.read_multiple_req.num_handles = argc - 2;
+        req.read_multiple_req.p_handle_stream = handles;
+        (void)host_bt_stack_request((uint16_t)conn_id,
+                                    (0 == strcmp(p_cmd, "read_multi")) ? GATT_REQ_READ_MULTI
+                                                                       : GATT_REQ_READ_MULTI_VAR_LENGTH,
+                                    &req);
+        return WICED_TRUE;
+    }
+
+    printf("! unknown command %s\n", p_cmd);
+    return WICED_FALSE;
+}
+
+/*******************************************************************************
+* Function Name: host_main_expect
+********************************************************************************
+* Summary:
+*   Checks the PDU the last command caused.
+*
+*   expect none                                  : The command sent no PDU
+*   expect <response> [<bytes>]                  : The last PDU has this opcode,
+*                                                  and this value if bytes are given
+*   expect error <opcode> <handle> <status>      : The last PDU is an Error
+*                                                  Response with these fields
+*
+* Parameters:
+*   int argc   : Number of arguments
+*   char **argv: Arguments
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the PDU matches
+*
+*******************************************************************************/
+static wiced_bool_t host_main_expect(int argc, char **argv)
+{
+    static const struct
+    {
+        const char *p_name;
+        uint8_t     opcode;
+    } names[] =
+    {
+        { "mtu",            GATT_RSP_MTU },
+        { "read",           GATT_RSP_READ },
+        { "read_blob",      GATT_RSP_READ_BLOB },
+        { "read_by_type",   GATT_RSP_READ_BY_TYPE },
+        { "read_multi",     GATT_RSP_READ_MULTI },
+        { "read_multi_var", GATT_RSP_READ_MULTI_VAR_LENGTH },
+        { "write",          GATT_RSP_WRITE },
+        { "prepare",        GATT_RSP_PREPARE_WRITE },
+        { "execute",        GATT_RSP_EXECUTE_WRITE },
+        { "notification",   GATT_HANDLE_VALUE_NOTIF },
+        { "indication",     GATT_HANDLE_VALUE_IND },
+    };
+    static uint8_t value[HOST_BT_STACK_MAX_PDU_LEN];
+    const host_bt_stack_pdu_t *p_pdu = host_bt_stack_get_last_pdu();
+    wiced_bool_t is_new = (host_bt_stack_get_pdu_count() != host_main_pdu_mark);
+    uint32_t arg[3];
+    int len;
+    uint8_t i;
+
+    if (argc < 1)
+    {
+        return WICED_FALSE;
+    }
+
+    if (0 == strcmp(argv[0], "none"))
+    {
+        return !is_new;
+    }
+
+    if (0 == strcmp(argv[0], "error"))
+    {
+        if ((4 != argc) || !host_main_parse_num(argv[1], UINT8_MAX, &arg[0]) ||
+            !host_main_parse_num(argv[2], UINT16_MAX, &arg[1]) ||
+            !host_main_parse_num(argv[3], UINT8_MAX, &arg[2]))
+        {
+            return WICED_FALSE;
+        }
+        return is_new && (GATT_RSP_ERROR == p_pdu->opcode) && (arg[0] == p_pdu->req_opcode) &&
+               (arg[1] == p_pdu->handle) && (arg[2] == p_pdu->status);
+    }
+
+    for (i = 0; i < (sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (0 == strcmp(argv[0], names[i].p_name))
+        {
+            break;
+        }
+    }
+    if ((i == (sizeof(names) / sizeof(names[0]))) || !is_new || (names[i].opcode != p_pdu->opcode))
+    {
+        return WICED_FALSE;
+    }
+    if (1 == argc)
+    {
+        return WICED_TRUE;
+    }
+
+    len = host_main_parse_bytes(argc - 1, &argv[1], value, sizeof(value));
+
+    return (len == p_pdu->len) && (0 == memcmp(value, p_pdu->data, (size_t)len));
+}
+
+/*******************************************************************************
+* Function Name: host_main_parse_num
+********************************************************************************
+* Summary:
+*   Parses a number in C notation.
+*
+* Parameters:
+*   const char *p_str: Number
+*   uint32_t max     : Largest valid value
+*   uint32_t *p_value: Set to the number
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the number is valid
+*
+*******************************************************************************/
+static wiced_bool_t host_main_parse_num(const char *p_str, uint32_t max, uint32_t *p_value)
+{
+    unsigned long value;
+    char *p_end;
+
+    value = strtoul(p_str, &p_end, 0);
+    if (('\0' == *p_str) || ('\0' != *p_end) || (value > max))
+    {
+        printf("! invalid number %s\n", p_str);
+        return WICED_FALSE;
+    }
+
+    *p_value = (uint32_t)value;
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_main_parse_bda
+********************************************************************************
+* Summary:
+*   Parses a device address, most significant byte first as in
+*   00:a0:50:12:34:56.
+*
+* Parameters:
+*   const char *p_str                : Address
+*   wiced_bt_device_address_t bd_addr: Set to the address
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if the address is valid
+*
+*******************************************************************************/
+static wiced_bool_t host_main_parse_bda(const char *p_str, wiced_bt_device_address_t bd_addr)
+{
+    unsigned int bytes[BD_ADDR_LEN];
+    char end;
+    uint8_t i;
+
+    if (BD_ADDR_LEN != sscanf(p_str, "%2x:%2x:%2x:%2x:%2x:%2x%c", &bytes[0], &bytes[1], &bytes[2],
+                              &bytes[3], &bytes[4], &bytes[5], &end))
+    {
+        printf("! invalid address %s\n", p_str);
+        return WICED_FALSE;
+    }
+
+    for (i = 0; i < BD_ADDR_LEN; i++)
+    {
+        bd_addr[i] = (uint8_t)bytes[i];
+    }
+
+    return WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_main_parse_bytes
+********************************************************************************
+* Summary:
+*   Parses a value given as hexadecimal bytes, one or more per token, as in
+*   "01 02" or "0102".
+*
+* Parameters:
+*   int argc       : Number of tokens
+*   char **argv    : Tokens
+*   uint8_t *p_buf : Set to the value
+*   int buf_len    : Size of the buffer
+*
+* Return:
+*   int: Length of the value, -1 if it is not valid
+*
+*******************************************************************************/
+static int host_main_parse_bytes(int argc, char **argv, uint8_t *p_buf, int buf_len)
+{
+    unsigned int byte;
+    const char *p_char;
+    int len = 0;
+    int i;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (0u != (strlen(argv[i]) % 2u))
+        {
+            printf("! invalid bytes %s\n", argv[i]);
+            return -1;
+        }
+        for (p_char = argv[i]; '\0' != *p_char; p_char += 2)
+        {
+            if ((len == buf_len) || (1 != sscanf(p_char, "%2x", &byte)))
+            {
+                printf("! invalid bytes %s\n", argv[i]);
+                return -1;
+            }
+            p_buf[len++] = (uint8_t)byte;
+        }
+    }
+
+    return len;
+}
+
+/* END OF FILE [] */
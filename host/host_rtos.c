@@ -0,0 +1,469 @@
+/******************************************************************************
+* File Name:   host_rtos.c
+*
+* Description: FreeRTOS stand-in of the host build. Each task is a thread of the host
+*              program, but only one thread runs at a time: the stack thread, which is the
+*              thread of main(), gives the processor to the tasks in host_rtos_idle() and
+*              gets it back once every task waits, so that the output of a replay does
+*              not depend on the host scheduler. Ticks are milliseconds of simulated time.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cy_utils.h"
+#include "host_sim.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HOST_RTOS_MAX_TASKS             (4u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+struct host_rtos_task_s
+{
+    pthread_t       thread;
+    pthread_cond_t  cond;
+    TaskFunction_t  code;
+    void           *p_param;
+    const char     *p_name;
+    uint32_t        notify_count;
+    wiced_bool_t    waiting;            /* Blocked in ulTaskNotifyTake */
+};
+
+/*******************************************************************************
+* Variable Definitions
+*******************************************************************************/
+/* Held by the thread that runs, released while it waits */
+static pthread_mutex_t          host_rtos_cpu = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t           host_rtos_idle_cond = PTHREAD_COND_INITIALIZER;
+
+static struct host_rtos_task_s  host_rtos_tasks[HOST_RTOS_MAX_TASKS];
+static uint8_t                  host_rtos_num_tasks;
+static wiced_bool_t             host_rtos_running;
+static wiced_bool_t             host_rtos_tasks_disabled;
+static uint32_t                 host_rtos_now;
+
+static host_sim_driver_t        host_rtos_driver;
+static int                      host_rtos_argc;
+static char                   **host_rtos_argv;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void *host_rtos_thread(void *arg);
+static wiced_bool_t host_rtos_all_waiting(void);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: host_rtos_set_driver
+********************************************************************************
+* Summary:
+*   Sets the driver vTaskStartScheduler() runs on the stack thread once the
+*   tasks are started and the stack is enabled.
+*
+* Parameters:
+*   host_sim_driver_t driver: Replay or benchmark
+*   int argc                : Arguments of the driver
+*   char **argv             : Arguments of the driver
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_rtos_set_driver(host_sim_driver_t driver, int argc, char **argv)
+{
+    host_rtos_driver = driver;
+    host_rtos_argc = argc;
+    host_rtos_argv = argv;
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_disable_tasks
+********************************************************************************
+* Summary:
+*   Keeps the application tasks from running. Benchmarks measure the stack
+*   thread alone; records written to the log are counted as dropped once the
+*   log ring buffer is full.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_rtos_disable_tasks(void)
+{
+    host_rtos_tasks_disabled = WICED_TRUE;
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_idle
+********************************************************************************
+* Summary:
+*   Gives the processor to the tasks until every one of them waits for a
+*   notification, as the lower priority tasks of the firmware run whenever
+*   the stack thread waits for the next event.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_rtos_idle(void)
+{
+    if (!host_rtos_running)
+    {
+        return;
+    }
+
+    while (!host_rtos_all_waiting())
+    {
+        pthread_cond_wait(&host_rtos_idle_cond, &host_rtos_cpu);
+    }
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_get_time
+********************************************************************************
+* Summary:
+*   Returns the simulated time.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   uint32_t: Milliseconds since the program started
+*
+*******************************************************************************/
+uint32_t host_rtos_get_time(void)
+{
+    return host_rtos_now;
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_set_time
+********************************************************************************
+* Summary:
+*   Moves the simulated time forward, see host_bt_stack_advance().
+*
+* Parameters:
+*   uint32_t now_ms: Milliseconds since the program started
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void host_rtos_set_time(uint32_t now_ms)
+{
+    host_rtos_now = now_ms;
+}
+
+/*******************************************************************************
+* Function Name: xTaskCreateStatic
+********************************************************************************
+* Summary:
+*   Registers a task. Its thread starts with the scheduler.
+*
+* Parameters:
+*   See the FreeRTOS documentation. The stack and the control block of the
+*   task are not used, the thread has its own.
+*
+* Return:
+*   TaskHandle_t: Handle of the task
+*
+*******************************************************************************/
+TaskHandle_t xTaskCreateStatic(TaskFunction_t pxTaskCode, const char *pcName,
+                               const uint32_t ulStackDepth, void *pvParameters,
+                               UBaseType_t uxPriority, StackType_t *puxStackBuffer,
+                               StaticTask_t *pxTaskBuffer)
+{
+    struct host_rtos_task_s *p_task;
+
+    CY_UNUSED_PARAMETER(ulStackDepth);
+    CY_UNUSED_PARAMETER(uxPriority);
+    CY_UNUSED_PARAMETER(puxStackBuffer);
+    CY_UNUSED_PARAMETER(pxTaskBuffer);
+
+    CY_ASSERT(host_rtos_num_tasks < HOST_RTOS_MAX_TASKS);
+    CY_ASSERT(!host_rtos_running);
+
+    p_task = &host_rtos_tasks[host_rtos_num_tasks++];
+    p_task->code = pxTaskCode;
+    p_task->p_param = pvParameters;
+    p_task->p_name = pcName;
+    pthread_cond_init(&p_task->cond, NULL);
+
+    return p_task;
+}
+
+/*******************************************************************************
+* Function Name: vTaskStartScheduler
+********************************************************************************
+* Summary:
+*   Starts the tasks, enables the simulated stack and runs the driver on the
+*   stack thread. Like the firmware, it does not return: the program exits
+*   with the status of the driver.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void vTaskStartScheduler(void)
+{
+    uint8_t i;
+    int status = EXIT_FAILURE;
+
+    pthread_mutex_lock(&host_rtos_cpu);
+
+    if (!host_rtos_tasks_disabled)
+    {
+        host_rtos_running = WICED_TRUE;
+        for (i = 0; i < host_rtos_num_tasks; i++)
+        {
+            if (0 != pthread_create(&host_rtos_tasks[i].thread, NULL, host_rtos_thread, &host_rtos_tasks[i]))
+            {
+                printf("Failed to start task %s\n", host_rtos_tasks[i].p_name);
+                CY_ASSERT(0);
+            }
+        }
+    }
+
+    host_bt_stack_enable();
+    host_rtos_idle();
+
+    if (NULL != host_rtos_driver)
+    {
+        status = host_rtos_driver(host_rtos_argc, host_rtos_argv);
+    }
+
+    host_rtos_idle();
+    fflush(stdout);
+    exit(status);
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetTickCount
+********************************************************************************
+* Summary:
+*   Returns the tick count, one tick per millisecond of simulated time.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   TickType_t: Tick count
+*
+*******************************************************************************/
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)host_rtos_now;
+}
+
+/*******************************************************************************
+* Function Name: ulTaskNotifyTake
+********************************************************************************
+* Summary:
+*   Waits for the notification of the calling task. Only portMAX_DELAY is
+*   supported, which is what the application uses.
+*
+* Parameters:
+*   BaseType_t xClearCountOnExit: pdTRUE to clear the count, pdFALSE to
+*                                 decrement it
+*   TickType_t xTicksToWait     : portMAX_DELAY
+*
+* Return:
+*   uint32_t: Notification count before it was cleared or decremented
+*
+*******************************************************************************/
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+    struct host_rtos_task_s *p_task = NULL;
+    uint32_t count;
+    uint8_t i;
+
+    CY_ASSERT(portMAX_DELAY == xTicksToWait);
+
+    for (i = 0; i < host_rtos_num_tasks; i++)
+    {
+        if (pthread_equal(host_rtos_tasks[i].thread, pthread_self()))
+        {
+            p_task = &host_rtos_tasks[i];
+        }
+    }
+    CY_ASSERT(NULL != p_task);
+
+    while (0u == p_task->notify_count)
+    {
+        p_task->waiting = WICED_TRUE;
+        pthread_cond_broadcast(&host_rtos_idle_cond);
+        pthread_cond_wait(&p_task->cond, &host_rtos_cpu);
+    }
+    p_task->waiting = WICED_FALSE;
+
+    count = p_task->notify_count;
+    p_task->notify_count = (pdFALSE != xClearCountOnExit) ? 0u : (count - 1u);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: xTaskNotifyGive
+********************************************************************************
+* Summary:
+*   Notifies a task. The task runs when the stack thread is idle.
+*
+* Parameters:
+*   TaskHandle_t xTaskToNotify: Task to notify
+*
+* Return:
+*   BaseType_t: pdPASS
+*
+*******************************************************************************/
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+    xTaskToNotify->notify_count++;
+    pthread_cond_signal(&xTaskToNotify->cond);
+
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: pvPortMalloc
+********************************************************************************
+* Summary:
+*   Allocates memory from the host heap.
+*
+* Parameters:
+*   size_t xWantedSize: Size of the allocation
+*
+* Return:
+*   void*: Allocated memory, NULL if none is left
+*
+*******************************************************************************/
+void *pvPortMalloc(size_t xWantedSize)
+{
+    return malloc(xWantedSize);
+}
+
+/*******************************************************************************
+* Function Name: vPortFree
+********************************************************************************
+* Summary:
+*   Frees memory allocated by pvPortMalloc().
+*
+* Parameters:
+*   void *pv: Memory to free
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void vPortFree(void *pv)
+{
+    free(pv);
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_thread
+********************************************************************************
+* Summary:
+*   Thread of a task. The task only runs while its thread holds the processor.
+*
+* Parameters:
+*   void *arg: Task
+*
+* Return:
+*   void*: Not used, tasks do not return
+*
+*******************************************************************************/
+static void *host_rtos_thread(void *arg)
+{
+    struct host_rtos_task_s *p_task = (struct host_rtos_task_s *)arg;
+
+    pthread_mutex_lock(&host_rtos_cpu);
+    p_task->code(p_task->p_param);
+
+    printf("Task %s returned\n", p_task->p_name);
+    CY_ASSERT(0);
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_all_waiting
+********************************************************************************
+* Summary:
+*   Checks whether every task waits for a notification that is not pending.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   wiced_bool_t: WICED_TRUE if no task can run
+*
+*******************************************************************************/
+static wiced_bool_t host_rtos_all_waiting(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < host_rtos_num_tasks; i++)
+    {
+        if ((!host_rtos_tasks[i].waiting) || (0u != host_rtos_tasks[i].notify_count))
+        {
+            return WICED_FALSE;
+        }
+    }
+
+    return WICED_TRUE;
+}
+
+/* END OF FILE [] */
@@ -0,0 +1,123 @@
+/******************************************************************************
+* File Name:   host_sim.h
+*
+* Description: Interfaces between the modules of the host build: the task emulation of
+*              host_rtos.c, the board of host_hal.c, the simulated stack of host_bt_stack.c
+*              and the replay and benchmark drivers of host_main.c and host_bench.c.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __HOST_SIM_H__
+#define __HOST_SIM_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include <stdint.h>
+#include "wiced_bt_gatt.h"
+#include "wiced_bt_dev.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Simulated links, more than the application accepts so that a full
+ * connection table is exercised */
+#ifndef HOST_BT_STACK_MAX_LINKS
+#define HOST_BT_STACK_MAX_LINKS         (16u)
+#endif
+
+/* Largest response or notification kept for the driver, the largest ATT_MTU */
+#define HOST_BT_STACK_MAX_PDU_LEN       (517u)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+/* Last PDU sent by the GATT server */
+typedef struct
+{
+    uint16_t conn_id;
+    uint8_t  opcode;        /* Response opcode, GATT_RSP_ERROR, or a handle value PDU */
+    uint8_t  req_opcode;    /* Request of an error response */
+    uint16_t handle;        /* Handle of an error response or a handle value PDU */
+    uint16_t status;        /* Status of an error response */
+    uint16_t len;
+    uint8_t  data[HOST_BT_STACK_MAX_PDU_LEN];
+} host_bt_stack_pdu_t;
+
+/* A driver of the host build: runs a replay or a benchmark once the stack is
+ * enabled and returns the exit status of the program */
+typedef int (*host_sim_driver_t)(int argc, char **argv);
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+/* host_main.c */
+extern wiced_bool_t host_sim_quiet;
+int app_main(void);
+
+/* host_bench.c */
+int host_bench_run(int argc, char **argv);
+void host_bench_list(void);
+
+/* host_rtos.c */
+void host_rtos_set_driver(host_sim_driver_t driver, int argc, char **argv);
+void host_rtos_disable_tasks(void);
+void host_rtos_idle(void);
+uint32_t host_rtos_get_time(void);
+void host_rtos_set_time(uint32_t now_ms);
+
+/* host_hal.c */
+void host_hal_press_button(void);
+wiced_bool_t host_hal_flash_load(const char *p_path);
+wiced_bool_t host_hal_flash_save(const char *p_path);
+
+/* host_bt_stack.c */
+void host_bt_stack_enable(void);
+void host_bt_stack_pump(void);
+void host_bt_stack_advance(uint32_t ms);
+wiced_bool_t host_bt_stack_connect(uint16_t conn_id, const wiced_bt_device_address_t bd_addr,
+                                   wiced_bt_ble_address_type_t addr_type);
+wiced_bool_t host_bt_stack_disconnect(uint16_t conn_id, wiced_bt_gatt_disconn_reason_t reason);
+wiced_bt_gatt_status_t host_bt_stack_request(uint16_t conn_id, wiced_bt_gatt_opcode_t opcode,
+                                             wiced_bt_gatt_request_data_t *p_data);
+wiced_bool_t host_bt_stack_pair(uint16_t conn_id);
+wiced_bool_t host_bt_stack_encrypt(uint16_t conn_id);
+void host_bt_stack_congest(uint16_t conn_id, wiced_bool_t congested);
+const host_bt_stack_pdu_t *host_bt_stack_get_last_pdu(void);
+uint32_t host_bt_stack_get_pdu_count(void);
+uint32_t host_bt_stack_get_error_count(void);
+
+#endif      /* __HOST_SIM_H__ */
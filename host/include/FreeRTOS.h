@@ -0,0 +1,81 @@
+/******************************************************************************
+* File Name:   FreeRTOS.h
+*
+* Description: Host stand-in for the FreeRTOS kernel configuration and types. Tasks run
+*              as threads of the host program, one at a time, see host_rtos.c.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __FREERTOS_H__
+#define __FREERTOS_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+#define configMAX_PRIORITIES            (7)
+#define configMINIMAL_STACK_SIZE        (128)
+#define configTICK_RATE_HZ              (1000u)
+
+#define pdFALSE                         ((BaseType_t)0)
+#define pdTRUE                          ((BaseType_t)1)
+#define pdPASS                          (pdTRUE)
+#define pdFAIL                          (pdFALSE)
+
+#define portMAX_DELAY                   ((TickType_t)0xFFFFFFFFu)
+#define portTICK_PERIOD_MS              ((TickType_t)(1000u / configTICK_RATE_HZ))
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(((TickType_t)(ms) * configTICK_RATE_HZ) / 1000u))
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef uint32_t      TickType_t;
+typedef long          BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t      StackType_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+void *pvPortMalloc(size_t xWantedSize);
+void vPortFree(void *pv);
+
+#endif      /* __FREERTOS_H__ */
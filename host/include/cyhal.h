@@ -0,0 +1,175 @@
+/******************************************************************************
+* File Name:   cyhal.h
+*
+* Description: Host stand-in for the HAL: the PWM, GPIO and flash drivers used by the
+*              application, implemented by host_hal.c.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __CYHAL_H__
+#define __CYHAL_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_result.h"
+#include "cy_utils.h"
+#include "cmsis_compiler.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Drivers provided by the host stand-in */
+#define CYHAL_DRIVER_AVAILABLE_FLASH    (1)
+#define CYHAL_DRIVER_AVAILABLE_PWM      (1)
+#define CYHAL_DRIVER_AVAILABLE_GPIO     (1)
+
+/* Pin that is not connected */
+#define NC                              ((cyhal_gpio_t)0xFFu)
+
+/******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+typedef enum
+{
+    CYHAL_PWM_LEFT_ALIGN,
+    CYHAL_PWM_RIGHT_ALIGN,
+    CYHAL_PWM_CENTER_ALIGN,
+} cyhal_pwm_alignment_t;
+
+typedef enum
+{
+    CYHAL_GPIO_DIR_INPUT,
+    CYHAL_GPIO_DIR_OUTPUT,
+    CYHAL_GPIO_DIR_BIDIRECTIONAL,
+} cyhal_gpio_direction_t;
+
+typedef enum
+{
+    CYHAL_GPIO_DRIVE_NONE,
+    CYHAL_GPIO_DRIVE_ANALOG,
+    CYHAL_GPIO_DRIVE_PULLUP,
+    CYHAL_GPIO_DRIVE_PULLDOWN,
+    CYHAL_GPIO_DRIVE_OPENDRAINDRIVESLOW,
+    CYHAL_GPIO_DRIVE_OPENDRAINDRIVESHIGH,
+    CYHAL_GPIO_DRIVE_STRONG,
+    CYHAL_GPIO_DRIVE_PULLUPDOWN,
+    CYHAL_GPIO_DRIVE_PULL_NONE,
+} cyhal_gpio_drive_mode_t;
+
+typedef enum
+{
+    CYHAL_GPIO_IRQ_NONE = 0,
+    CYHAL_GPIO_IRQ_RISE = 1,
+    CYHAL_GPIO_IRQ_FALL = 2,
+    CYHAL_GPIO_IRQ_BOTH = 3,
+} cyhal_gpio_event_t;
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef uint32_t cyhal_gpio_t;
+
+typedef struct
+{
+    int unused;
+} cyhal_clock_t;
+
+typedef struct
+{
+    cyhal_gpio_t pin;
+    bool         running;
+    float        duty_cycle;            /* Percent of the period the output is high */
+    uint32_t     frequency_hz;
+} cyhal_pwm_t;
+
+typedef void (*cyhal_gpio_event_callback_t)(void *callback_arg, cyhal_gpio_event_t event);
+
+typedef struct cyhal_gpio_callback_data_s
+{
+    cyhal_gpio_event_callback_t         callback;
+    void                               *callback_arg;
+    struct cyhal_gpio_callback_data_s  *next;
+    cyhal_gpio_t                        pin;
+} cyhal_gpio_callback_data_t;
+
+typedef struct
+{
+    bool opened;
+} cyhal_flash_t;
+
+typedef struct
+{
+    uint32_t start_address;
+    uint32_t size;
+    uint32_t sector_size;
+    uint32_t page_size;
+    uint8_t  erase_value;
+} cyhal_flash_block_info_t;
+
+typedef struct
+{
+    uint8_t                         block_count;
+    const cyhal_flash_block_info_t *blocks;
+} cyhal_flash_info_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+cy_rslt_t cyhal_pwm_init_adv(cyhal_pwm_t *obj, cyhal_gpio_t pin, cyhal_gpio_t compl_pin,
+                             cyhal_pwm_alignment_t pwm_alignment, bool continuous,
+                             uint32_t dead_time_us, bool invert, const cyhal_clock_t *clk);
+cy_rslt_t cyhal_pwm_set_duty_cycle(cyhal_pwm_t *obj, float duty_cycle, uint32_t frequencyhal_hz);
+cy_rslt_t cyhal_pwm_start(cyhal_pwm_t *obj);
+cy_rslt_t cyhal_pwm_stop(cyhal_pwm_t *obj);
+
+cy_rslt_t cyhal_gpio_init(cyhal_gpio_t pin, cyhal_gpio_direction_t direction,
+                          cyhal_gpio_drive_mode_t drive_mode, bool init_val);
+void cyhal_gpio_register_callback(cyhal_gpio_t pin, cyhal_gpio_callback_data_t *callback_data);
+void cyhal_gpio_enable_event(cyhal_gpio_t pin, cyhal_gpio_event_t event, uint8_t intr_priority,
+                             bool enable);
+
+cy_rslt_t cyhal_flash_init(cyhal_flash_t *obj);
+void cyhal_flash_free(cyhal_flash_t *obj);
+void cyhal_flash_get_info(const cyhal_flash_t *obj, cyhal_flash_info_t *info);
+cy_rslt_t cyhal_flash_read(cyhal_flash_t *obj, uint32_t address, uint8_t *data, size_t size);
+cy_rslt_t cyhal_flash_erase(cyhal_flash_t *obj, uint32_t address);
+cy_rslt_t cyhal_flash_program(cyhal_flash_t *obj, uint32_t address, const uint32_t *data);
+
+#endif      /* __CYHAL_H__ */
@@ -0,0 +1,83 @@
+/******************************************************************************
+* File Name:   task.h
+*
+* Description: Host stand-in for the FreeRTOS task API.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __TASK_H__
+#define __TASK_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "FreeRTOS.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+#define tskIDLE_PRIORITY                ((UBaseType_t)0u)
+
+/* Only one task runs at a time, see host_rtos.c */
+#define taskENTER_CRITICAL()            do { } while (0)
+#define taskEXIT_CRITICAL()             do { } while (0)
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef void (*TaskFunction_t)(void *pvParameters);
+
+typedef struct host_rtos_task_s *TaskHandle_t;
+
+/* Storage of a statically allocated task, holds the host task */
+typedef struct
+{
+    uint64_t reserved[16];
+} StaticTask_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+TaskHandle_t xTaskCreateStatic(TaskFunction_t pxTaskCode, const char *pcName,
+                               const uint32_t ulStackDepth, void *pvParameters,
+                               UBaseType_t uxPriority, StackType_t *puxStackBuffer,
+                               StaticTask_t *pxTaskBuffer);
+void vTaskStartScheduler(void);
+TickType_t xTaskGetTickCount(void);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+
+#endif      /* __TASK_H__ */
@@ -0,0 +1,226 @@
+/******************************************************************************
+* File Name:   wiced_bt_ble.h
+*
+* Description: Host stand-in for the LE part of the AIROC(TM) BTSTACK device API:
+*              advertising, PHY and data length, implemented by host_bt_stack.c.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __WICED_BT_BLE_H__
+#define __WICED_BT_BLE_H__
+
+/******************************************************************************
+ * Header Files
+ ******************************************************************************/
+#include "wiced_bt_types.h"
+
+/******************************************************************************
+ * Constants
+ ******************************************************************************/
+/* Address types */
+#define BLE_ADDR_PUBLIC                 (0x00u)
+#define BLE_ADDR_RANDOM                 (0x01u)
+#define BLE_ADDR_PUBLIC_ID              (0x02u)
+#define BLE_ADDR_RANDOM_ID              (0x03u)
+
+/* Advertising data types */
+#define BTM_BLE_ADVERT_TYPE_FLAG                (0x01u)
+#define BTM_BLE_ADVERT_TYPE_16SRV_PARTIAL       (0x02u)
+#define BTM_BLE_ADVERT_TYPE_16SRV_COMPLETE      (0x03u)
+#define BTM_BLE_ADVERT_TYPE_128SRV_PARTIAL      (0x06u)
+#define BTM_BLE_ADVERT_TYPE_128SRV_COMPLETE     (0x07u)
+#define BTM_BLE_ADVERT_TYPE_NAME_SHORT          (0x08u)
+#define BTM_BLE_ADVERT_TYPE_NAME_COMPLETE       (0x09u)
+#define BTM_BLE_ADVERT_TYPE_TX_POWER            (0x0Au)
+#define BTM_BLE_ADVERT_TYPE_APPEARANCE          (0x19u)
+#define BTM_BLE_ADVERT_TYPE_MANUFACTURER        (0xFFu)
+
+/* Advertising flags */
+#define BTM_BLE_LIMITED_DISCOVERABLE_FLAG       (0x01u)
+#define BTM_BLE_GENERAL_DISCOVERABLE_FLAG       (0x02u)
+#define BTM_BLE_BREDR_NOT_SUPPORTED             (0x04u)
+
+/* Advertising channels */
+#define BTM_BLE_ADVERT_CHNL_37                  (0x01u)
+#define BTM_BLE_ADVERT_CHNL_38                  (0x02u)
+#define BTM_BLE_ADVERT_CHNL_39                  (0x04u)
+
+/* Advertising filter policies */
+#define BTM_BLE_ADV_POLICY_ACCEPT_CONN_AND_SCAN (0x00u)
+
+/* PHY preferences */
+#define BTM_BLE_PREFER_1M_PHY                   (0x01u)
+#define BTM_BLE_PREFER_2M_PHY                   (0x02u)
+#define BTM_BLE_PREFER_LELR_PHY                 (0x04u)
+#define BTM_BLE_PREFER_NO_LELR                  (0x0000u)
+
+/* PHYs reported by a PHY update */
+#define BTM_BLE_PHY_1M                          (0x01u)
+#define BTM_BLE_PHY_2M                          (0x02u)
+
+/* Extended advertising event properties */
+#define WICED_BT_BLE_EXT_ADV_EVENT_NON_CONN_NON_SCAN_UNDIRECTED         (0x0000u)
+#define WICED_BT_BLE_EXT_ADV_EVENT_CONNECTABLE_ADV                      (0x0001u)
+#define WICED_BT_BLE_EXT_ADV_EVENT_SCANNABLE_ADV                        (0x0002u)
+#define WICED_BT_BLE_EXT_ADV_EVENT_DIRECTED_ADV                         (0x0004u)
+#define WICED_BT_BLE_EXT_ADV_EVENT_HIGH_DUTY_DIRECTED_CONNECTABLE_ADV   (0x0008u)
+#define WICED_BT_BLE_EXT_ADV_EVENT_LEGACY_ADV                           (0x0010u)
+
+#define WICED_BT_BLE_EXT_ADV_PHY_1M                 (0x01u)
+#define WICED_BT_BLE_EXT_ADV_PHY_2M                 (0x02u)
+#define WICED_BT_BLE_EXT_ADV_PHY_LE_CODED           (0x03u)
+
+#define WICED_BT_BLE_EXT_ADV_SCAN_REQ_NOTIFY_DISABLE    (0x00u)
+
+/******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+/* Advertising modes */
+enum wiced_bt_ble_advert_mode_e
+{
+    BTM_BLE_ADVERT_OFF,
+    BTM_BLE_ADVERT_DIRECTED_HIGH,
+    BTM_BLE_ADVERT_DIRECTED_LOW,
+    BTM_BLE_ADVERT_UNDIRECTED_HIGH,
+    BTM_BLE_ADVERT_UNDIRECTED_LOW,
+    BTM_BLE_ADVERT_NONCONN_HIGH,
+    BTM_BLE_ADVERT_NONCONN_LOW,
+    BTM_BLE_ADVERT_DISCOVERABLE_HIGH,
+    BTM_BLE_ADVERT_DISCOVERABLE_LOW,
+};
+
+/******************************************************************************
+ * Structures
+ ******************************************************************************/
+typedef uint8_t  wiced_bt_ble_address_type_t;
+typedef uint8_t  wiced_bt_ble_advert_mode_t;
+typedef uint8_t  wiced_bt_ble_advert_type_t;
+typedef uint8_t  wiced_bt_ble_advert_chnl_map_t;
+typedef uint8_t  wiced_bt_ble_advert_filter_policy_t;
+
+typedef uint8_t  wiced_bt_ble_ext_adv_handle_t;
+typedef uint16_t wiced_bt_ble_ext_adv_event_property_t;
+typedef uint32_t wiced_bt_ble_ext_adv_interval_t;
+typedef uint8_t  wiced_bt_ble_ext_adv_phy_t;
+typedef uint8_t  wiced_bt_ble_ext_adv_sid_t;
+typedef uint8_t  wiced_bt_ble_ext_adv_scan_req_notification_setting_t;
+
+/* One AD structure of the advertising data */
+typedef struct
+{
+    uint8_t                     *p_data;
+    uint16_t                     len;
+    wiced_bt_ble_advert_type_t   advert_type;
+} wiced_bt_ble_advert_elem_t;
+
+typedef struct
+{
+    wiced_bt_ble_ext_adv_handle_t adv_handle;
+    uint16_t                      adv_duration;         /* Units of 10 ms, 0 for no limit */
+    uint8_t                       max_ext_adv_events;   /* 0 for no limit */
+} wiced_bt_ble_ext_adv_duration_config_t;
+
+typedef struct
+{
+    wiced_bt_device_address_t remote_bd_addr;
+    uint8_t                   tx_phys;
+    uint8_t                   rx_phys;
+    uint16_t                  phy_opts;
+} wiced_bt_ble_phy_preferences_t;
+
+typedef struct
+{
+    uint8_t                   status;
+    wiced_bt_device_address_t bd_addr;
+    uint16_t                  conn_interval;
+    uint16_t                  conn_latency;
+    uint16_t                  supervision_timeout;
+} wiced_bt_ble_connection_param_update_t;
+
+typedef struct
+{
+    uint8_t                   status;
+    wiced_bt_device_address_t bd_address;
+    uint8_t                   tx_phy;
+    uint8_t                   rx_phy;
+} wiced_bt_ble_phy_update_t;
+
+typedef struct
+{
+    wiced_bt_device_address_t bd_address;
+    uint16_t                  max_tx_octets;
+    uint16_t                  max_tx_time;
+    uint16_t                  max_rx_octets;
+    uint16_t                  max_rx_time;
+} wiced_bt_ble_phy_data_length_update_t;
+
+/****************************************************************************
+ * FUNCTION DECLARATIONS
+ ***************************************************************************/
+wiced_result_t wiced_bt_ble_set_raw_advertisement_data(uint8_t num_elem,
+                                                       wiced_bt_ble_advert_elem_t *p_data);
+wiced_result_t wiced_bt_start_advertisements(wiced_bt_ble_advert_mode_t advert_mode,
+                                             wiced_bt_ble_address_type_t directed_advertisement_bdaddr_type,
+                                             wiced_bt_device_address_t directed_advertisement_bdaddr_ptr);
+wiced_bt_ble_advert_mode_t wiced_bt_ble_get_current_advert_mode(void);
+
+wiced_result_t wiced_bt_ble_set_ext_adv_parameters(wiced_bt_ble_ext_adv_handle_t adv_handle,
+                                                   wiced_bt_ble_ext_adv_event_property_t event_properties,
+                                                   wiced_bt_ble_ext_adv_interval_t primary_adv_int_min,
+                                                   wiced_bt_ble_ext_adv_interval_t primary_adv_int_max,
+                                                   wiced_bt_ble_advert_chnl_map_t primary_adv_channel_map,
+                                                   wiced_bt_ble_address_type_t own_addr_type,
+                                                   wiced_bt_ble_address_type_t peer_addr_type,
+                                                   wiced_bt_device_address_t peer_addr,
+                                                   wiced_bt_ble_advert_filter_policy_t adv_filter_policy,
+                                                   int8_t adv_tx_power,
+                                                   wiced_bt_ble_ext_adv_phy_t primary_adv_phy,
+                                                   uint8_t secondary_adv_max_skip,
+                                                   wiced_bt_ble_ext_adv_phy_t secondary_adv_phy,
+                                                   wiced_bt_ble_ext_adv_sid_t adv_sid,
+                                                   wiced_bt_ble_ext_adv_scan_req_notification_setting_t scan_request_not);
+wiced_result_t wiced_bt_ble_set_ext_adv_data(wiced_bt_ble_ext_adv_handle_t adv_handle,
+                                             uint16_t data_len, uint8_t *p_data);
+wiced_result_t wiced_bt_ble_start_ext_adv(uint8_t enable, uint8_t num_sets,
+                                          wiced_bt_ble_ext_adv_duration_config_t *p_set_duration_param);
+
+wiced_result_t wiced_bt_ble_set_phy(wiced_bt_ble_phy_preferences_t *p_phy_preferences);
+wiced_result_t wiced_bt_ble_set_data_packet_length(wiced_bt_device_address_t bd_addr,
+                                                   uint16_t tx_pdu_length, uint16_t tx_time);
+
+void wiced_bt_ble_security_grant(wiced_bt_device_address_t bd_addr, uint8_t res);
+
+#endif      /* __WICED_BT_BLE_H__ */
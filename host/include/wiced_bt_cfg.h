@@ -0,0 +1,67 @@
+/******************************************************************************
+* File Name:   wiced_bt_cfg.h
+*
+* Description: Host stand-in for the AIROC(TM) BTSTACK configuration settings. Only the
+*              fields the application and the simulated stack read are kept.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __WICED_BT_CFG_H__
+#define __WICED_BT_CFG_H__
+
+#include "wiced_bt_types.h"
+
+typedef struct
+{
+    uint16_t max_mtu_size;
+    uint16_t max_db_service_modules;
+    uint16_t max_eatt_bearers;
+} wiced_bt_cfg_gatt_t;
+
+typedef struct
+{
+    uint16_t client_max_links;
+    uint16_t server_max_links;
+} wiced_bt_cfg_ble_t;
+
+typedef struct
+{
+    const uint8_t             *device_name;
+    const wiced_bt_cfg_ble_t  *p_ble_cfg;
+    const wiced_bt_cfg_gatt_t *p_gatt_cfg;
+} wiced_bt_cfg_settings_t;
+
+#endif      /* __WICED_BT_CFG_H__ */
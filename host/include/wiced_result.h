@@ -0,0 +1,70 @@
+/******************************************************************************
+* File Name:   wiced_result.h
+*
+* Description: Host stand-in for the result codes of the AIROC(TM) BTSTACK.
+*
+* Related Document: See README.md
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+#ifndef __WICED_RESULT_H__
+#define __WICED_RESULT_H__
+
+/******************************************************************************
+ * Enumerations
+ ******************************************************************************/
+typedef enum
+{
+    WICED_SUCCESS                       = 0,
+    WICED_PENDING                       = 1,
+    WICED_TIMEOUT                       = 2,
+    WICED_BADARG                        = 5,
+    WICED_OUT_OF_HEAP_SPACE             = 8,
+    WICED_ERROR                         = 4,
+    WICED_UNSUPPORTED                   = 7,
+
+    WICED_BT_SUCCESS                    = 0,
+    WICED_BT_PENDING                    = 8001,
+    WICED_BT_ERROR                      = 8002,
+    WICED_BT_UNSUPPORTED                = 8003,
+    WICED_BT_BUSY                       = 8004,
+    WICED_BT_NO_RESOURCES               = 8005,
+    WICED_BT_ILLEGAL_VALUE              = 8006,
+    WICED_BT_ILLEGAL_ACTION             = 8007,
+    WICED_BT_WRONG_MODE                 = 8008,
+    WICED_BT_BADARG                     = 8009,
+    WICED_BT_NOT_AUTHORIZED             = 8010,
+} wiced_result_t;
+
+#endif      /* __WICED_RESULT_H__ */
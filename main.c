@@ -58,7 +58,22 @@
 #include "GeneratedSource/cycfg_bt_settings.h"
 #include "GeneratedSource/cycfg_gap.h"
 #include "wiced_bt_dev.h"
+#include "wiced_bt_uuid.h"
 #include "app_bt_utils.h"
+#include "app_gatt_db_index.h"
+#include "app_gatt_stream.h"
+#include "app_gatt_prep_write.h"
+#include "app_gatt_notify.h"
+#include "app_nv.h"
+#include "app_bt_bond.h"
+#include "app_bt_adv.h"
+#include "app_bt_ext_adv.h"
+#include "app_bt_adv_status.h"
+#include "app_bt_buffer_pool.h"
+#include "app_bt_conn.h"
+#include "app_bt_link.h"
+#include "app_bt_conn_param.h"
+#include "app_log.h"
 #include "cybsp_bt_config.h"
 
 
@@ -78,6 +93,13 @@ enum
     LED_OFF_DUTY_CYCLE = 100
 } led_duty_cycles;
 
+/* Largest handle-value pair of a read-by-type response: the pair length is
+ * carried in one byte */
+#define APP_BT_READ_BY_TYPE_MAX_PAIR_LEN    (255u)
+
+/* Interrupt priority of the user button */
+#define USER_BTN_IRQ_PRIORITY           (7u)
+
 /* IAS Alert Levels */
 #define IAS_ALERT_LEVEL_LOW             (0u)
 #define IAS_ALERT_LEVEL_MID             (1u)
@@ -89,7 +111,8 @@ typedef enum
 {
     APP_BT_ADV_OFF_CONN_OFF,
     APP_BT_ADV_ON_CONN_OFF,
-    APP_BT_ADV_OFF_CONN_ON
+    APP_BT_ADV_OFF_CONN_ON,
+    APP_BT_ADV_ON_CONN_ON
 } app_bt_adv_conn_mode_t;
 
 /*******************************************************************************
@@ -99,13 +122,20 @@ typedef enum
 /* create PWM object for Alert LED */
 static cyhal_pwm_t ias_led_pwm;
 
+/* Alert level currently shown on the IAS LED */
+static uint8_t     ias_led_alert_level = IAS_ALERT_LEVEL_LOW;
+
 /* CYBSP_USER_LED2 is only present on some kits. For those kits,it is used to indicate advertising/connection status */
 /* create PWM object for second LED only if it exists */
 #ifdef CYBSP_USER_LED2
 static cyhal_pwm_t                adv_led_pwm;
 #endif
 
-static uint16_t                  bt_connection_id = 0;
+/* A press of the user button restarts fast advertising */
+#ifdef CYBSP_USER_BTN
+static cyhal_gpio_callback_data_t user_btn_callback_data;
+#endif
+
 static app_bt_adv_conn_mode_t    app_bt_adv_conn_state = APP_BT_ADV_OFF_CONN_OFF;
 
 /* This enables RTOS aware debugging. */
@@ -115,9 +145,24 @@ volatile int uxTopUsedPriority;
 * Function Prototypes
 ********************************************************************************/
 static void                   ias_led_update                 (void);
+static void                   ias_alert_level_update         (void);
+static void                   le_app_service_changed         (app_bt_conn_t *p_conn);
+static wiced_bt_gatt_status_t le_app_service_changed_produce (uint16_t conn_id,
+                                                              uint16_t handle,
+                                                              uint16_t offset,
+                                                              uint8_t *p_buf,
+                                                              uint16_t buf_len,
+                                                              uint16_t *p_len,
+                                                              uint16_t *p_total_len);
 static void                   adv_led_update                 (void);
+#ifdef CYBSP_USER_BTN
+static void                   user_btn_init                  (void);
+static void                   user_btn_interrupt_handler     (void *handler_arg, cyhal_gpio_event_t event);
+static void                   user_btn_pressed               (void *p_data);
+#endif
 static void                   le_app_init                    (void);
-static void*                  app_alloc_buffer               (int len);
+static void                   app_bt_update_adv_conn_state   (wiced_bool_t adv_on);
+static void*                  app_alloc_buffer               (uint16_t conn_id, int len);
 
 static void                   app_free_buffer                (uint8_t *p_event_data);
 
@@ -135,6 +180,19 @@ static wiced_bt_gatt_status_t le_app_read_handler           (uint16_t conn_id,
                                                               wiced_bt_gatt_read_t *p_read_req,
                                                               uint16_t len_req, 
                                                               uint16_t *p_error_handle);
+static wiced_bt_gatt_status_t le_app_prep_write_handler     (uint16_t conn_id,
+                                                              wiced_bt_gatt_opcode_t opcode,
+                                                              wiced_bt_gatt_write_req_t *p_write_req,
+                                                              uint16_t *p_error_handle);
+static wiced_bt_gatt_status_t le_app_exec_write_handler     (uint16_t conn_id,
+                                                              wiced_bt_gatt_opcode_t opcode,
+                                                              wiced_bt_gatt_execute_write_req_t exec_flag,
+                                                              uint16_t *p_error_handle);
+static wiced_bt_gatt_status_t le_app_read_stream            (uint16_t conn_id,
+                                                              wiced_bt_gatt_opcode_t opcode,
+                                                              wiced_bt_gatt_read_t *p_read_req,
+                                                              uint16_t len_req,
+                                                              app_gatt_stream_producer_t producer);
 static wiced_bt_gatt_status_t le_app_connect_handler        (wiced_bt_gatt_connection_status_t *p_conn_status);
 static wiced_bt_gatt_status_t le_app_server_handler         (wiced_bt_gatt_attribute_request_t *p_attr_req, 
                                                               uint16_t *p_error_handle);
@@ -149,6 +207,21 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler (uint16_t con
                                                                     wiced_bt_gatt_read_by_type_t *p_read_req, 
                                                                     uint16_t len_requested, 
                                                                     uint16_t *p_error_handle);
+static uint16_t               app_bt_gatt_read_by_type_rsp_len (uint16_t conn_id,
+                                                                const app_gatt_db_type_entry_t *p_match,
+                                                                uint16_t num_matches,
+                                                                uint16_t len_requested,
+                                                                uint16_t *p_error_handle);
+static wiced_bt_gatt_status_t app_bt_gatt_req_read_multi_handler (uint16_t conn_id,
+                                                                  wiced_bt_gatt_opcode_t opcode,
+                                                                  wiced_bt_gatt_read_multiple_req_t *p_read_req,
+                                                                  uint16_t len_requested,
+                                                                  uint16_t *p_error_handle);
+static wiced_bool_t           le_app_get_value                (uint16_t conn_id,
+                                                              uint16_t handle,
+                                                              uint8_t *p_cccd_buf,
+                                                              uint8_t **pp_data,
+                                                              uint16_t *p_len);
 
 /******************************************************************************
  * Function Definitions
@@ -182,6 +255,18 @@ int main()
 
     printf("************* Find Me Profile Application Start ************************\n");
 
+    /* Set up the GATT response buffer pools before the stack can request buffers */
+    app_bt_buffer_pool_init();
+
+    /* Start the task that prints the log records written by the BT callbacks */
+    app_log_init();
+
+    /* Open the flash record store that keeps the bonds and the CCCDs of
+     * bonded peers, and load the bonds. The stack requests the local
+     * identity keys during its initialization */
+    (void)app_nv_init();
+    app_bt_bond_init();
+
    /* Configure platform specific settings for the BT device */
    cybt_platform_config_init(&cybsp_bt_platform_cfg);
 
@@ -226,6 +311,7 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
     wiced_result_t wiced_result = WICED_BT_SUCCESS;
     wiced_bt_device_address_t bda = { 0 };
     wiced_bt_ble_advert_mode_t *p_adv_mode = NULL;
+    app_bt_conn_t *p_conn;
 
     switch (event)
     {
@@ -235,15 +321,14 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
             {
                 wiced_bt_set_local_bdaddr((uint8_t *)cy_bt_device_address, BLE_ADDR_PUBLIC);
                 wiced_bt_dev_read_local_addr(bda);
-                printf("Local Bluetooth Address: ");
-                print_bd_address(bda);
+                APP_LOG_BDA(APP_LOG_ID_LOCAL_BDA, bda);
 
                 /* Perform application-specific initialization */
                 le_app_init();
             }
             else
             {
-                printf( "Bluetooth Disabled \n" );
+                APP_LOG(APP_LOG_ID_BT_DISABLED);
             }
 
             break;
@@ -252,28 +337,21 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
 
             /* Advertisement State Changed */
             p_adv_mode = &p_event_data->ble_advert_state_changed;
-            printf("Advertisement State Change: %s\n", get_bt_advert_mode_name(*p_adv_mode));
+            APP_LOG(APP_LOG_ID_ADV_STATE_CHANGE, *p_adv_mode);
 
             if (BTM_BLE_ADVERT_OFF == *p_adv_mode)
             {
                 /* Advertisement Stopped */
-                printf("Advertisement stopped\n");
+                APP_LOG(APP_LOG_ID_ADV_STOPPED);
 
                 /* Check connection status after advertisement stops */
-                if(0 == bt_connection_id)
-                {
-                    app_bt_adv_conn_state = APP_BT_ADV_OFF_CONN_OFF;
-                }
-                else
-                {
-                    app_bt_adv_conn_state = APP_BT_ADV_OFF_CONN_ON;
-                }
+                app_bt_update_adv_conn_state(WICED_FALSE);
             }
             else
             {
                 /* Advertisement Started */
-                printf("Advertisement started\n");
-                app_bt_adv_conn_state = APP_BT_ADV_ON_CONN_OFF;
+                APP_LOG(APP_LOG_ID_ADV_STARTED);
+                app_bt_update_adv_conn_state(WICED_TRUE);
             }
 
             /* Update Advertisement LED to reflect the updated state */
@@ -281,15 +359,107 @@ wiced_result_t app_bt_management_callback(wiced_bt_management_evt_t event,
             break;
 
         case BTM_BLE_CONNECTION_PARAM_UPDATE:
-            printf("Connection parameter update status:%d, Connection Interval: %d, Connection Latency: %d, Connection Timeout: %d\n",
-                                           p_event_data->ble_connection_param_update.status,
-                                           p_event_data->ble_connection_param_update.conn_interval,
-                                           p_event_data->ble_connection_param_update.conn_latency,
-                                           p_event_data->ble_connection_param_update.supervision_timeout);
+            APP_LOG(APP_LOG_ID_CONN_PARAM_UPDATE,
+                    p_event_data->ble_connection_param_update.status,
+                    p_event_data->ble_connection_param_update.conn_interval,
+                    p_event_data->ble_connection_param_update.conn_latency,
+                    p_event_data->ble_connection_param_update.supervision_timeout);
+            app_bt_conn_param_update(&p_event_data->ble_connection_param_update);
+            break;
+
+        case BTM_BLE_PHY_UPDATE_EVT:
+            app_bt_link_phy_update(&p_event_data->ble_phy_update_event);
+            break;
+
+        case BTM_BLE_DATA_LENGTH_UPDATE_EVENT:
+            app_bt_link_data_length_update(&p_event_data->ble_data_length_update_event);
+            break;
+
+        case BTM_PAIRING_IO_CAPABILITIES_BLE_REQUEST_EVT:
+            /* No display or keyboard: Just Works pairing with LE Secure
+             * Connections and bonding */
+            p_event_data->pairing_io_capabilities_ble_request.local_io_cap = BTM_IO_CAPABILITIES_NONE;
+            p_event_data->pairing_io_capabilities_ble_request.oob_data = BTM_OOB_NONE;
+            p_event_data->pairing_io_capabilities_ble_request.auth_req = BTM_LE_AUTH_REQ_SC_BOND;
+            p_event_data->pairing_io_capabilities_ble_request.max_key_size = 16;
+            p_event_data->pairing_io_capabilities_ble_request.init_keys = BTM_LE_KEY_PENC | BTM_LE_KEY_PID;
+            p_event_data->pairing_io_capabilities_ble_request.resp_keys = BTM_LE_KEY_PENC | BTM_LE_KEY_PID;
+            break;
+
+        case BTM_SECURITY_REQUEST_EVT:
+            wiced_bt_ble_security_grant(p_event_data->security_request.bd_addr, WICED_BT_SUCCESS);
+            break;
+
+        case BTM_PAIRING_COMPLETE_EVT:
+            APP_LOG(APP_LOG_ID_PAIRING_COMPLETE,
+                    p_event_data->pairing_complete.pairing_complete_info.ble.status,
+                    p_event_data->pairing_complete.pairing_complete_info.ble.reason);
+            break;
+
+        case BTM_PAIRED_DEVICE_LINK_KEYS_UPDATE_EVT:
+            /* Keep the keys of the new bond. The link was encrypted before
+             * the keys were distributed, store the CCCDs the client has
+             * configured so far */
+            if (!app_bt_bond_save_keys(&p_event_data->paired_device_link_keys_update))
+            {
+                APP_LOG_BDA(APP_LOG_ID_BOND_SAVE_FAILED, p_event_data->paired_device_link_keys_update.bd_addr);
+            }
+            p_conn = app_bt_conn_find_by_bda(p_event_data->paired_device_link_keys_update.bd_addr);
+            if (NULL != p_conn)
+            {
+                p_conn->bonded = WICED_TRUE;
+                app_bt_conn_save_cccd(p_conn);
+            }
+            break;
+
+        case BTM_PAIRED_DEVICE_LINK_KEYS_REQUEST_EVT:
+            /* The stack reports an unknown peer through the result */
+            if (!app_bt_bond_load_keys(&p_event_data->paired_device_link_keys_request))
+            {
+                wiced_result = WICED_BT_ERROR;
+            }
+            break;
+
+        case BTM_LOCAL_IDENTITY_KEYS_UPDATE_EVT:
+            (void)app_bt_bond_save_local_keys(&p_event_data->local_identity_keys_update);
+            break;
+
+        case BTM_LOCAL_IDENTITY_KEYS_REQUEST_EVT:
+            /* Without stored keys the stack generates new ones */
+            if (!app_bt_bond_load_local_keys(&p_event_data->local_identity_keys_request))
+            {
+                wiced_result = WICED_BT_ERROR;
+            }
+            break;
+
+        case BTM_ENCRYPTION_STATUS_EVT:
+            APP_LOG(APP_LOG_ID_ENCRYPTION_STATUS, p_event_data->encryption_status.result);
+            p_conn = app_bt_conn_find_by_bda(p_event_data->encryption_status.bd_addr);
+            if ((WICED_BT_SUCCESS == p_event_data->encryption_status.result) && (NULL != p_conn))
+            {
+                /* The link is encrypted with a bond: restore the CCCDs the
+                 * client configured in an earlier connection, or keep the
+                 * ones it configured in this one */
+                p_conn->bonded = app_bt_bond_is_bonded(p_conn->bd_addr);
+                if (p_conn->bonded && app_bt_conn_restore_cccd(p_conn))
+                {
+                    APP_LOG(APP_LOG_ID_CCCD_RESTORED, p_conn->conn_id);
+
+                    /* The client cached the attributes of an earlier GATT DB */
+                    if (p_conn->db_hash != app_gatt_db_index_get_hash())
+                    {
+                        le_app_service_changed(p_conn);
+                    }
+                }
+                else
+                {
+                    app_bt_conn_save_cccd(p_conn);
+                }
+            }
             break;
 
         default:
-            printf("Unhandled Bluetooth Management Event: 0x%x %s\n", event, get_btm_event_name(event));
+            APP_LOG(APP_LOG_ID_UNHANDLED_BTM_EVT, event, event);
             break;
     }
 
@@ -321,6 +491,24 @@ static void le_app_init(void)
     printf("**Discover device with \"Find Me Target\" name*\n");
     printf("***********************************************\n\n");
 
+    /* Start with no connected clients */
+    app_bt_conn_init();
+    app_bt_conn_param_init();
+
+    /* Attributes produced on demand. Service Changed carries a value per
+     * client, so it is built when it is sent rather than kept in the GATT DB */
+    app_gatt_stream_init();
+    app_gatt_stream_register(HDLC_GATT_SERVICE_CHANGED_VALUE, le_app_service_changed_produce);
+
+    /* No prepared writes are pending */
+    app_gatt_prep_write_init();
+
+    /* No notifications or indications are queued */
+    app_gatt_notify_init();
+
+    /* Bonded peers using resolvable private addresses are recognized */
+    app_bt_bond_stack_enabled();
+
     /* Initialize the PWM used for IAS alert level LED */
     cy_result = cyhal_pwm_init_adv(&ias_led_pwm, CYBSP_USER_LED1 , NC, CYHAL_PWM_RIGHT_ALIGN, true, 0u, false, NULL);
 
@@ -347,22 +535,43 @@ static void le_app_init(void)
     }
 #endif
 
-    wiced_bt_set_pairable_mode(FALSE, FALSE);
+    /* Accept bonding so that clients reconnect with encryption and keep their
+     * CCCDs and discovery cache */
+    wiced_bt_set_pairable_mode(WICED_TRUE, FALSE);
 
     /* Set Advertisement Data */
-    wiced_bt_ble_set_raw_advertisement_data(CY_BT_ADV_PACKET_DATA_SIZE, cy_bt_adv_packet_data);
+#ifdef APP_BT_EXT_ADV
+    /* Configure the Find Me and beacon advertising sets and start the beacon */
+    if (WICED_BT_SUCCESS != app_bt_ext_adv_init())
+    {
+        printf("Extended advertising initialization has failed! \n");
+        CY_ASSERT(0);
+    }
+#endif
+    /* Generated advertising data followed by the alert level for locators */
+    app_bt_adv_status_init();
 
     /* Register with BT stack to receive GATT callback */
     gatt_status = wiced_bt_gatt_register(le_app_gatt_event_callback);
-    printf("GATT event Handler registration status: %s \n",get_bt_gatt_status_name(gatt_status));
+    APP_LOG(APP_LOG_ID_GATT_REGISTER_STATUS, gatt_status);
 
     /* Initialize GATT Database */
     gatt_status = wiced_bt_gatt_db_init(gatt_database, gatt_database_len, NULL);
-    printf("GATT database initialization status: %s \n",get_bt_gatt_status_name(gatt_status));
+    APP_LOG(APP_LOG_ID_GATT_DB_INIT_STATUS, gatt_status);
 
-    /* Start Undirected LE Advertisements on device startup.
-     * The corresponding parameters are contained in 'app_bt_cfg.c' */
-    wiced_result = wiced_bt_start_advertisements(BTM_BLE_ADVERT_UNDIRECTED_HIGH, 0, NULL);
+    /* Build the handle index used by the read and write paths, and the type
+     * index used by read-by-type, which walks the GATT DB */
+    if (WICED_TRUE != app_gatt_db_index_init())
+    {
+        printf("GATT DB handle index initialization has failed! \n");
+        CY_ASSERT(0);
+    }
+
+    /* Start Undirected LE Advertisements on device startup, fast first and
+     * slower while no client connects. The stages are set in app_bt_adv.h,
+     * the corresponding intervals are contained in 'app_bt_cfg.c' */
+    app_bt_adv_init();
+    wiced_result = app_bt_adv_start(APP_BT_ADV_EVENT_STARTUP);
 
     /* Failed to start advertisement. Stop program execution */
     if (WICED_BT_SUCCESS != wiced_result)
@@ -370,6 +579,37 @@ static void le_app_init(void)
         printf("failed to start advertisement! \n");
         CY_ASSERT(0);
     }
+
+#ifdef CYBSP_USER_BTN
+    /* The user button restarts fast advertising once the scheduler runs */
+    user_btn_init();
+#endif
+}
+
+/**************************************************************************************************
+* Function Name: app_bt_update_adv_conn_state
+***************************************************************************************************
+* Summary:
+*   This function combines the advertising state with the number of connected clients into
+*   the adv/conn state used by the LEDs.
+*
+* Parameters:
+*   wiced_bool_t adv_on: WICED_TRUE if advertisements are running
+*
+* Return:
+*  None
+*
+*************************************************************************************************/
+static void app_bt_update_adv_conn_state(wiced_bool_t adv_on)
+{
+    if (0 == app_bt_conn_count())
+    {
+        app_bt_adv_conn_state = adv_on ? APP_BT_ADV_ON_CONN_OFF : APP_BT_ADV_OFF_CONN_OFF;
+    }
+    else
+    {
+        app_bt_adv_conn_state = adv_on ? APP_BT_ADV_ON_CONN_ON : APP_BT_ADV_OFF_CONN_ON;
+    }
 }
 
 /**************************************************************************************************
@@ -415,7 +655,7 @@ static wiced_bt_gatt_status_t le_app_gatt_event_callback(wiced_bt_gatt_evt_t eve
 
         case GATT_GET_RESPONSE_BUFFER_EVT: /* GATT buffer request, typically sized to max of bearer mtu - 1 */
             p_event_data->buffer_request.buffer.p_app_rsp_buffer =
-            app_alloc_buffer(p_event_data->buffer_request.len_requested);
+            app_alloc_buffer(0, p_event_data->buffer_request.len_requested);
             p_event_data->buffer_request.buffer.p_app_ctxt = (void *)app_free_buffer;
             gatt_status = WICED_BT_GATT_SUCCESS;
             break;
@@ -432,6 +672,11 @@ static wiced_bt_gatt_status_t le_app_gatt_event_callback(wiced_bt_gatt_evt_t eve
         }
             break;
 
+        case GATT_CONGESTION_EVT:
+            app_gatt_notify_congestion(p_event_data->congestion.conn_id,
+                                       p_event_data->congestion.congested);
+            gatt_status = WICED_BT_GATT_SUCCESS;
+            break;
 
         default:
             gatt_status = WICED_BT_GATT_ERROR;
@@ -450,6 +695,7 @@ static wiced_bt_gatt_status_t le_app_gatt_event_callback(wiced_bt_gatt_evt_t eve
 *   whose starting address is passed as one of the function parameters
 *
 * Parameters:
+* @param conn_id      Connection ID of the writing client
 * @param attr_handle  GATT attribute handle
 * @param p_val        Pointer to LE GATT write request value
 * @param len          length of GATT write request
@@ -459,55 +705,74 @@ static wiced_bt_gatt_status_t le_app_gatt_event_callback(wiced_bt_gatt_evt_t eve
 *   wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e in wiced_bt_gatt.h
 *
 **************************************************************************************************/
-static wiced_bt_gatt_status_t le_app_set_value(uint16_t attr_handle,
+static wiced_bt_gatt_status_t le_app_set_value(uint16_t conn_id,
+                                                uint16_t attr_handle,
                                                 uint8_t *p_val,
                                                 uint16_t len)
 {
     wiced_bool_t isHandleInTable = WICED_FALSE;
     wiced_bool_t validLen = WICED_FALSE;
     wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_INVALID_HANDLE;
+    gatt_db_lookup_table_t *puAttribute;
+    app_bt_conn_t *p_conn = app_bt_conn_find(conn_id);
+    uint16_t *p_cccd;
+
+    /* A Client Characteristic Configuration value is always two bytes */
+    if ((HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG == attr_handle) && (2 != len))
+    {
+        return WICED_BT_GATT_INVALID_ATTR_LEN;
+    }
+
+    /* Client Characteristic Configuration descriptors hold a value per
+     * client, kept in flash for bonded clients; the shared value in the GATT
+     * DB is never written. The application is not going to change its GATT
+     * DB, so Service Changed needs no other action */
+    p_cccd = (NULL != p_conn) ? app_bt_conn_get_cccd(p_conn, attr_handle) : NULL;
+    if (NULL != p_cccd)
+    {
+        *p_cccd = (uint16_t)(p_val[0] | (p_val[1] << 8));
+        app_bt_conn_save_cccd(p_conn);
+        return WICED_BT_GATT_SUCCESS;
+    }
+
     /* Check for a matching handle entry */
-    for (int i = 0; i < app_gatt_db_ext_attr_tbl_size; i++)
+    puAttribute = le_app_find_by_handle(attr_handle);
+    if (NULL != puAttribute)
     {
-        if (app_gatt_db_ext_attr_tbl[i].handle == attr_handle)
-        {
-            /* Detected a matching handle in external lookup table */
-            isHandleInTable = WICED_TRUE;
+        /* Detected a matching handle in external lookup table */
+        isHandleInTable = WICED_TRUE;
 
-            /* Check if the buffer has space to store the data */
-            validLen = (app_gatt_db_ext_attr_tbl[i].max_len >= len);
+        /* Check if the buffer has space to store the data */
+        validLen = (puAttribute->max_len >= len);
 
-            if (validLen)
-            {
-                /* Value fits within the supplied buffer; copy over the value */
-                app_gatt_db_ext_attr_tbl[i].cur_len = len;
-                memcpy(app_gatt_db_ext_attr_tbl[i].p_data, p_val, len);
-                gatt_status = WICED_BT_GATT_SUCCESS;
+        if (validLen)
+        {
+            /* Value fits within the supplied buffer; copy over the value */
+            puAttribute->cur_len = len;
+            memcpy(puAttribute->p_data, p_val, len);
+            gatt_status = WICED_BT_GATT_SUCCESS;
 
-                /* Add code for any action required when this attribute is written.
-                 * In this case, we update the IAS led based on the IAS alert
-                 * level characteristic value */
+            /* Add code for any action required when this attribute is written.
+             * In this case, we update the IAS led based on the IAS alert
+             * level characteristic value */
 
-                switch ( attr_handle )
-                {
-                    case HDLC_IAS_ALERT_LEVEL_VALUE:
-                        printf("Alert Level = %d\n", app_ias_alert_level[0]);
-                        ias_led_update();
-                        break;
-
-                    /* The application is not going to change its GATT DB,
-                     * So this case is not handled */
-                    case HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG:
-                        gatt_status = WICED_BT_GATT_SUCCESS;
-                        break;
-                }
-            }
-            else
+            switch ( attr_handle )
             {
-                /* Value to write does not meet size constraints */
-                gatt_status = WICED_BT_GATT_INVALID_ATTR_LEN;
+                case HDLC_IAS_ALERT_LEVEL_VALUE:
+                    APP_LOG(APP_LOG_ID_ALERT_LEVEL, app_ias_alert_level[0], conn_id);
+                    /* Keep the level of each client, the LED follows the highest one */
+                    if (NULL != p_conn)
+                    {
+                        p_conn->alert_level = app_ias_alert_level[0];
+                    }
+                    ias_alert_level_update();
+                    break;
             }
-            break;
+        }
+        else
+        {
+            /* Value to write does not meet size constraints */
+            gatt_status = WICED_BT_GATT_INVALID_ATTR_LEN;
         }
     }
 
@@ -522,7 +787,7 @@ static wiced_bt_gatt_status_t le_app_set_value(uint16_t attr_handle,
         {
             default:
                 /* The write operation was not performed for the indicated handle */
-                printf("Write Request to Invalid Handle: 0x%x\n", attr_handle);
+                APP_LOG(APP_LOG_ID_WRITE_INVALID_HANDLE, attr_handle);
                 gatt_status = WICED_BT_GATT_WRITE_NOT_PERMIT;
                 break;
         }
@@ -558,13 +823,14 @@ static wiced_bt_gatt_status_t le_app_write_handler(uint16_t conn_id,
     *p_error_handle = p_write_req->handle;
 
     /* Attempt to perform the Write Request */
-    gatt_status = le_app_set_value(p_write_req->handle,
+    gatt_status = le_app_set_value(conn_id,
+                                   p_write_req->handle,
                                 p_write_req->p_val,
                                p_write_req->val_len);
 
     if( WICED_BT_GATT_SUCCESS != gatt_status )
     {
-        printf("WARNING: GATT set attr status 0x%x\n", gatt_status);
+        APP_LOG(APP_LOG_ID_SET_ATTR_FAILED, gatt_status, gatt_status);
     }
     else
     {
@@ -574,6 +840,88 @@ static wiced_bt_gatt_status_t le_app_write_handler(uint16_t conn_id,
     return (gatt_status);
 }
 
+/**************************************************************************************************
+* Function Name: le_app_prep_write_handler
+***************************************************************************************************
+* Summary:
+*   This function handles Prepare Write Requests received from the client device. The fragment
+*   is queued and echoed back; the attribute is only written on Execute Write
+*
+* Parameters:
+*  @param conn_id       Connection ID
+*  @param opcode        LE GATT request type opcode
+*  @param p_write_req   Pointer to LE GATT write request with the handle, offset and value
+*
+* Return:
+*  wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e in wiced_bt_gatt.h
+*
+**************************************************************************************************/
+static wiced_bt_gatt_status_t le_app_prep_write_handler(uint16_t conn_id,
+                                                         wiced_bt_gatt_opcode_t opcode,
+                                                         wiced_bt_gatt_write_req_t *p_write_req,
+                                                         uint16_t *p_error_handle)
+{
+    wiced_bt_gatt_status_t gatt_status;
+    uint8_t *p_echo;
+
+    *p_error_handle = p_write_req->handle;
+
+    gatt_status = app_gatt_prep_write_prepare(conn_id, p_write_req, &p_echo);
+    if (WICED_BT_GATT_SUCCESS != gatt_status)
+    {
+        return gatt_status;
+    }
+
+    /* The queued copy stays valid until Execute Write, so it can be echoed without a buffer */
+    return wiced_bt_gatt_server_send_prepare_write_rsp(conn_id, opcode, p_write_req->handle,
+                                                      p_write_req->offset, p_write_req->val_len,
+                                                      p_echo, NULL);
+}
+
+/**************************************************************************************************
+* Function Name: le_app_exec_write_handler
+***************************************************************************************************
+* Summary:
+*   This function handles Execute Write Requests received from the client device. All the
+*   values queued by the client are written through le_app_set_value, or none if any of them is
+*   invalid
+*
+* Parameters:
+*  @param conn_id       Connection ID
+*  @param opcode        LE GATT request type opcode
+*  @param exec_flag     GATT_PREPARE_WRITE_EXEC to write the queue, GATT_PREPARE_WRITE_CANCEL to drop it
+*
+* Return:
+*  wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e in wiced_bt_gatt.h
+*
+**************************************************************************************************/
+static wiced_bt_gatt_status_t le_app_exec_write_handler(uint16_t conn_id,
+                                                         wiced_bt_gatt_opcode_t opcode,
+                                                         wiced_bt_gatt_execute_write_req_t exec_flag,
+                                                         uint16_t *p_error_handle)
+{
+    wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_SUCCESS;
+
+    *p_error_handle = 0;
+
+    if (GATT_PREPARE_WRITE_EXEC == exec_flag)
+    {
+        gatt_status = app_gatt_prep_write_execute(conn_id, le_app_set_value, p_error_handle);
+    }
+    else
+    {
+        app_gatt_prep_write_cancel(conn_id);
+    }
+
+    if (WICED_BT_GATT_SUCCESS != gatt_status)
+    {
+        APP_LOG(APP_LOG_ID_EXEC_WRITE_FAILED, gatt_status, *p_error_handle);
+        return gatt_status;
+    }
+
+    return wiced_bt_gatt_server_send_execute_write_rsp(conn_id, opcode);
+}
+
 /**************************************************************************************************
 * Function Name: le_app_read_handler
 ***************************************************************************************************
@@ -597,31 +945,140 @@ static wiced_bt_gatt_status_t le_app_read_handler( uint16_t conn_id,
                                                     uint16_t *p_error_handle)
 {
 
-    gatt_db_lookup_table_t  *puAttribute;
-    int          attr_len_to_copy;
+    uint16_t     attr_len_to_copy;
     uint8_t     *from;
     int          to_send;
+    uint8_t      cccd_value[2];
+    app_gatt_stream_producer_t producer;
 
     *p_error_handle = p_read_req->handle;
 
-    puAttribute = le_app_find_by_handle(p_read_req->handle);
-    if ( NULL == puAttribute )
+    /* Streamed attributes are produced straight into the response buffer */
+    producer = app_gatt_stream_find(p_read_req->handle);
+    if (NULL != producer)
+    {
+        return le_app_read_stream(conn_id, opcode, p_read_req, len_req, producer);
+    }
+
+    if (!le_app_get_value(conn_id, p_read_req->handle, cccd_value, &from, &attr_len_to_copy))
     {
         return WICED_BT_GATT_INVALID_HANDLE;
     }
 
-    attr_len_to_copy = puAttribute->cur_len;
-    if (p_read_req->offset >= puAttribute->cur_len)
+    if (p_read_req->offset >= attr_len_to_copy)
     {
         return WICED_BT_GATT_INVALID_OFFSET;
     }
 
     to_send = MIN(len_req, attr_len_to_copy - p_read_req->offset);
-    from = ((uint8_t *)puAttribute->p_data) + p_read_req->offset;
+    from += p_read_req->offset;
 
     return wiced_bt_gatt_server_send_read_handle_rsp(conn_id, opcode, to_send, from, NULL); /* No need for context, as buff not allocated */;
 }
 
+/**************************************************************************************************
+* Function Name: le_app_get_value
+***************************************************************************************************
+* Summary:
+*   This function returns the value of an attribute as seen by a client. Client Characteristic
+*   Configuration descriptors hold a value per client, which is formatted into the caller's
+*   buffer; all other values are returned in place from the GATT DB lookup table
+*
+* Parameters:
+* @param conn_id       Connection ID of the reading client
+* @param handle        Attribute handle
+* @param p_cccd_buf    Two byte buffer for the value of a descriptor
+* @param pp_data       Returns the first byte of the value
+* @param p_len         Returns the length of the value
+*
+* Return:
+*  wiced_bool_t: WICED_FALSE if the handle is not in the lookup table
+*
+**************************************************************************************************/
+static wiced_bool_t le_app_get_value(uint16_t conn_id,
+                                     uint16_t handle,
+                                     uint8_t *p_cccd_buf,
+                                     uint8_t **pp_data,
+                                     uint16_t *p_len)
+{
+    gatt_db_lookup_table_t *puAttribute;
+    app_bt_conn_t *p_conn;
+    uint16_t *p_cccd = NULL;
+
+    puAttribute = le_app_find_by_handle(handle);
+    if (NULL == puAttribute)
+    {
+        return WICED_FALSE;
+    }
+
+    *pp_data = (uint8_t *)puAttribute->p_data;
+    *p_len = puAttribute->cur_len;
+
+    /* Client Characteristic Configuration descriptors hold a value per client */
+    p_conn = app_bt_conn_find(conn_id);
+    if (NULL != p_conn)
+    {
+        p_cccd = app_bt_conn_get_cccd(p_conn, handle);
+    }
+    if (NULL != p_cccd)
+    {
+        p_cccd_buf[0] = (uint8_t)(*p_cccd & 0xFF);
+        p_cccd_buf[1] = (uint8_t)(*p_cccd >> 8);
+        *pp_data = p_cccd_buf;
+        *p_len = 2;
+    }
+
+    return WICED_TRUE;
+}
+
+/**************************************************************************************************
+* Function Name: le_app_read_stream
+***************************************************************************************************
+* Summary:
+*   This function serves a Read or Read Blob request of a streamed attribute. The producer
+*   writes the value at the requested offset directly into a response buffer that is handed to
+*   the BT stack and freed once transmitted, so the value is never copied by the application
+*
+* Parameters:
+* @param conn_id       Connection ID
+* @param opcode        LE GATT request type opcode
+* @param p_read_req    Pointer to read request containing the handle and offset to read
+* @param len_req       length of data requested
+* @param producer      Producer of the attribute value
+*
+* Return:
+*  wiced_bt_gatt_status_t: See possible status codes in wiced_bt_gatt_status_e in wiced_bt_gatt.h
+*
+**************************************************************************************************/
+static wiced_bt_gatt_status_t le_app_read_stream(uint16_t conn_id,
+                                                  wiced_bt_gatt_opcode_t opcode,
+                                                  wiced_bt_gatt_read_t *p_read_req,
+                                                  uint16_t len_req,
+                                                  app_gatt_stream_producer_t producer)
+{
+    wiced_bt_gatt_status_t gatt_status;
+    uint16_t to_send = 0;
+    uint16_t total_len;
+    uint8_t *p_rsp;
+
+    len_req = app_bt_conn_get_max_rsp_len(conn_id, len_req);
+    p_rsp = app_alloc_buffer(conn_id, len_req);
+    if (NULL == p_rsp)
+    {
+        return WICED_BT_GATT_INSUF_RESOURCE;
+    }
+
+    gatt_status = producer(conn_id, p_read_req->handle, p_read_req->offset, p_rsp, len_req,
+                           &to_send, &total_len);
+    if (WICED_BT_GATT_SUCCESS != gatt_status)
+    {
+        app_free_buffer(p_rsp);
+        return gatt_status;
+    }
+
+    return wiced_bt_gatt_server_send_read_handle_rsp(conn_id, opcode, to_send, p_rsp, (void *)app_free_buffer);
+}
+
 /**************************************************************************************************
 * Function Name: le_app_connect_handler
 ***************************************************************************************************
@@ -638,40 +1095,95 @@ static wiced_bt_gatt_status_t le_app_read_handler( uint16_t conn_id,
 static wiced_bt_gatt_status_t le_app_connect_handler(wiced_bt_gatt_connection_status_t *p_conn_status)
 {
     wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_SUCCESS ;
+    wiced_bool_t adv_on;
+    app_bt_conn_t *p_conn;
 
     if ( NULL != p_conn_status )
     {
         if ( p_conn_status->connected )
         {
             /* Device has connected */
-            printf("Connected : BDA " );
-            print_bd_address(p_conn_status->bd_addr);
-            printf("Connection ID '%d' \n", p_conn_status->conn_id );
+            APP_LOG_BDA(APP_LOG_ID_CONNECTED, p_conn_status->bd_addr);
+            APP_LOG(APP_LOG_ID_CONNECTION_ID, p_conn_status->conn_id);
+
+            /* Store the connection in the connection table */
+            p_conn = app_bt_conn_add(p_conn_status->conn_id,
+                                     p_conn_status->bd_addr,
+                                     p_conn_status->addr_type);
+            if (NULL == p_conn)
+            {
+                APP_LOG(APP_LOG_ID_CONN_TABLE_FULL, p_conn_status->conn_id);
+                wiced_bt_gatt_disconnect(p_conn_status->conn_id);
+                return WICED_BT_GATT_ERROR;
+            }
+            APP_LOG(APP_LOG_ID_CONN_COUNT, app_bt_conn_count(), APP_BT_MAX_CONNECTIONS);
+
+            /* Ask for the 2M PHY and long LL payloads */
+            app_bt_link_start(p_conn);
 
-            /* Store the connection ID */
-            bt_connection_id = p_conn_status->conn_id;
+            /* Adapt the connection interval to the ATT traffic of this link */
+            app_bt_conn_param_start(p_conn);
+
+            /* Start the notification queue of this link */
+            app_gatt_notify_conn_up(p_conn_status->conn_id);
+
+            /* The controller stops advertising on a connection. Keep
+             * advertising while more clients can be accepted */
+            app_bt_adv_connected(p_conn_status->bd_addr);
+            adv_on = WICED_FALSE;
+            if (app_bt_conn_has_free_slot())
+            {
+                adv_on = (WICED_BT_SUCCESS == app_bt_adv_start(APP_BT_ADV_EVENT_CONNECT));
+            }
 
             /* Update the adv/conn state */
-            app_bt_adv_conn_state = APP_BT_ADV_OFF_CONN_ON;
+            app_bt_update_adv_conn_state(adv_on);
         }
         else
         {
             /* Device has disconnected */
-            printf("Disconnected : BDA " );
-            print_bd_address(p_conn_status->bd_addr);
-            printf("Connection ID '%d', Reason '%s'\n", p_conn_status->conn_id, get_bt_gatt_disconn_reason_name(p_conn_status->reason) );
+            APP_LOG_BDA(APP_LOG_ID_DISCONNECTED, p_conn_status->bd_addr);
+            APP_LOG(APP_LOG_ID_DISCONNECT_REASON, p_conn_status->reason, p_conn_status->conn_id);
+
+            /* Release the entry of this connection */
+            p_conn = app_bt_conn_find(p_conn_status->conn_id);
+            if (NULL != p_conn)
+            {
+                app_bt_conn_param_stop(p_conn);
+            }
+            app_bt_conn_remove(p_conn_status->conn_id);
 
-            /* Set the connection id to zero to indicate disconnected state */
-            bt_connection_id = 0;
+            /* Drop the prepared writes the client did not execute */
+            app_gatt_prep_write_cancel(p_conn_status->conn_id);
 
-            /* Restart the advertisements */
-            wiced_bt_start_advertisements(BTM_BLE_ADVERT_UNDIRECTED_HIGH, 0, NULL);
+            /* Drop the notifications queued for this client */
+            app_gatt_notify_conn_down(p_conn_status->conn_id);
+            APP_LOG(APP_LOG_ID_CONN_COUNT, app_bt_conn_count(), APP_BT_MAX_CONNECTIONS);
 
-            /* Update the adv/conn state */
-            app_bt_adv_conn_state = APP_BT_ADV_ON_CONN_OFF;
+            /* The client that left is likely to come back: invite it with
+             * directed advertising, then advertise fast again. This also
+             * restarts the advertisements if they stopped when the table
+             * was full */
+            adv_on = (WICED_BT_SUCCESS == app_bt_adv_reconnect(p_conn_status->bd_addr,
+                                                                p_conn_status->addr_type));
 
-            /* Turn Off the IAS LED on a disconnection */
-            ias_led_update();
+            /* Update the adv/conn state */
+            app_bt_update_adv_conn_state(adv_on);
+
+            /* Drop the alert level of this client; the IAS LED turns off
+             * when the last client disconnects */
+            ias_alert_level_update();
+
+            /* Report how the GATT response buffers, connection parameter
+             * regimes, prepared write queues and notification queues were
+             * used on this link, and how fast clients connect in each
+             * advertising stage */
+            app_bt_buffer_pool_log_stats();
+            app_bt_conn_param_log_stats();
+            app_gatt_prep_write_log_stats();
+            app_gatt_notify_log_stats();
+            app_bt_adv_log_stats();
+            app_bt_adv_status_log_stats();
         }
 
         /* Update Advertisement LED to reflect the updated state */
@@ -700,6 +1212,14 @@ static wiced_bt_gatt_status_t le_app_server_handler (wiced_bt_gatt_attribute_req
                                                       uint16_t *p_error_handle)
 {
     wiced_bt_gatt_status_t gatt_status = WICED_BT_GATT_SUCCESS;
+    app_bt_conn_t *p_conn = app_bt_conn_find(p_attr_req->conn_id);
+
+    if (NULL != p_conn)
+    {
+        p_conn->last_activity_time = xTaskGetTickCount();
+        app_bt_conn_param_on_traffic(p_conn);
+    }
+
     switch ( p_attr_req->opcode )
     {
         case GATT_REQ_READ:
@@ -720,13 +1240,53 @@ static wiced_bt_gatt_status_t le_app_server_handler (wiced_bt_gatt_attribute_req
                                                p_error_handle );
 
              break;
+        case GATT_REQ_PREPARE_WRITE:
+             /* Long write fragment, queued until Execute Write */
+            gatt_status = le_app_prep_write_handler(p_attr_req->conn_id,
+                                                    p_attr_req->opcode,
+                                                    &p_attr_req->data.write_req,
+                                                    p_error_handle);
+             break;
+        case GATT_REQ_EXECUTE_WRITE:
+            gatt_status = le_app_exec_write_handler(p_attr_req->conn_id,
+                                                    p_attr_req->opcode,
+                                                    p_attr_req->data.exec_write_req,
+                                                    p_error_handle);
+             break;
         case GATT_REQ_MTU:
+            /* Offer up to APP_BT_MAX_MTU; the link uses the smaller of both MTUs */
             gatt_status = wiced_bt_gatt_server_send_mtu_rsp(p_attr_req->conn_id,
                                                        p_attr_req->data.remote_mtu,
-                                                       CY_BT_MTU_SIZE);
+                                                       APP_BT_MAX_MTU);
+            if (NULL != p_conn)
+            {
+                APP_LOG(APP_LOG_ID_CONN_MTU, p_conn->conn_id,
+                        app_bt_conn_set_mtu(p_conn, p_attr_req->data.remote_mtu));
+            }
              break;
         case GATT_HANDLE_VALUE_NOTIF:
-                    printf("Notfication send complete\n");
+                    APP_LOG(APP_LOG_ID_NOTIFICATION_SENT);
+             break;
+        case GATT_HANDLE_VALUE_CONF:
+            /* The client confirmed an indication, send the next one */
+            app_gatt_notify_confirmed(p_attr_req->conn_id);
+
+            /* After Service Changed the client knows the current GATT DB,
+             * which is remembered for its next connection */
+            if ((HDLC_GATT_SERVICE_CHANGED_VALUE == p_attr_req->data.confirm_handle) &&
+                (NULL != p_conn) && (p_conn->db_hash != app_gatt_db_index_get_hash()))
+            {
+                p_conn->db_hash = app_gatt_db_index_get_hash();
+                app_bt_conn_save_cccd(p_conn);
+            }
+             break;
+        case GATT_REQ_READ_MULTI:
+        case GATT_REQ_READ_MULTI_VAR_LENGTH:
+            gatt_status = app_bt_gatt_req_read_multi_handler(p_attr_req->conn_id,
+                                                             p_attr_req->opcode,
+                                                             &p_attr_req->data.read_multiple_req,
+                                                             p_attr_req->len_requested,
+                                                             p_error_handle);
              break;
         case GATT_REQ_READ_BY_TYPE:
             gatt_status = app_bt_gatt_req_read_by_type_handler(p_attr_req->conn_id, 
@@ -735,9 +1295,10 @@ static wiced_bt_gatt_status_t le_app_server_handler (wiced_bt_gatt_attribute_req
                                                                p_attr_req->len_requested, 
                                                                p_error_handle);
              break;
-
+        /* Find Information, Find By Type Value and Read By Group Type are answered by the
+         * stack from gatt_database and are not forwarded to the application */
         default:
-                printf("ERROR: Unhandled GATT Connection Request case: %d\n", p_attr_req->opcode);
+                APP_LOG(APP_LOG_ID_UNHANDLED_GATT_REQ, p_attr_req->opcode);
                 gatt_status = WICED_BT_GATT_ERROR;
                 break;
     }
@@ -745,6 +1306,82 @@ static wiced_bt_gatt_status_t le_app_server_handler (wiced_bt_gatt_attribute_req
     return gatt_status;
 }
 
+#ifdef CYBSP_USER_BTN
+/*******************************************************************************
+* Function Name: user_btn_init
+********************************************************************************
+*
+* Summary:
+*   This function configures the user button to interrupt on a press.
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void user_btn_init(void)
+{
+    cy_rslt_t cy_result;
+
+    cy_result = cyhal_gpio_init(CYBSP_USER_BTN, CYHAL_GPIO_DIR_INPUT, CYBSP_USER_BTN_DRIVE, CYBSP_BTN_OFF);
+    if (CY_RSLT_SUCCESS != cy_result)
+    {
+        printf("User button init failed! \n");
+        CY_ASSERT(0);
+    }
+
+    user_btn_callback_data.callback = user_btn_interrupt_handler;
+    user_btn_callback_data.callback_arg = NULL;
+    cyhal_gpio_register_callback(CYBSP_USER_BTN, &user_btn_callback_data);
+    cyhal_gpio_enable_event(CYBSP_USER_BTN, CYHAL_GPIO_IRQ_FALL, USER_BTN_IRQ_PRIORITY, true);
+}
+
+/*******************************************************************************
+* Function Name: user_btn_interrupt_handler
+********************************************************************************
+*
+* Summary:
+*   This interrupt handler runs when the user button is pressed. The
+*   advertising scheduler belongs to the BT stack task, so the press is
+*   passed on to that task.
+*
+* Parameters:
+*   void *handler_arg         : Not used
+*   cyhal_gpio_event_t event  : Not used
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void user_btn_interrupt_handler(void *handler_arg, cyhal_gpio_event_t event)
+{
+    (void)wiced_bt_app_serialize_function(user_btn_pressed, NULL);
+}
+
+/*******************************************************************************
+* Function Name: user_btn_pressed
+********************************************************************************
+*
+* Summary:
+*   This function handles a press of the user button in the BT stack task: a
+*   locator is likely to be looking for the target, so advertising goes back
+*   to the fast stage.
+*
+* Parameters:
+*   void *p_data: Not used
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void user_btn_pressed(void *p_data)
+{
+    app_bt_adv_kick(APP_BT_ADV_EVENT_BUTTON);
+}
+#endif
+
 /*******************************************************************************
 * Function Name: adv_led_update
 ********************************************************************************
@@ -769,8 +1406,8 @@ void adv_led_update(void)
     cyhal_pwm_stop(&adv_led_pwm);
 
     /* Update LED state based on LE advertising/connection state.
-     * LED OFF for no advertisement/connection, LED blinking for advertisement
-     * state, and LED ON for connected state  */
+     * LED OFF for no advertisement/connection, LED blinking while advertising
+     * (even with clients connected), and LED ON for connected state  */
     switch(app_bt_adv_conn_state)
     {
         case APP_BT_ADV_OFF_CONN_OFF:
@@ -778,6 +1415,7 @@ void adv_led_update(void)
             break;
 
         case APP_BT_ADV_ON_CONN_OFF:
+        case APP_BT_ADV_ON_CONN_ON:
             cy_result = cyhal_pwm_set_duty_cycle(&adv_led_pwm, LED_BLINKING_DUTY_CYCLE, ADV_LED_PWM_FREQUENCY);
             break;
 
@@ -793,14 +1431,14 @@ void adv_led_update(void)
     /* Check if update to PWM parameters is successful*/
     if (CY_RSLT_SUCCESS != cy_result)
     {
-         printf("Failed to set duty cycle parameters!!");
+         APP_LOG(APP_LOG_ID_PWM_DUTY_CYCLE_FAILED);
     }
 
     cy_result = cyhal_pwm_start(&adv_led_pwm);
     /* Check if PWM started successfully */
     if (CY_RSLT_SUCCESS != cy_result)
     {
-         printf("Failed to start PWM !!");
+         APP_LOG(APP_LOG_ID_PWM_START_FAILED);
     }
 #endif
 }
@@ -826,12 +1464,12 @@ static void ias_led_update(void)
     /* Stop the IAS led pwm */
     cyhal_pwm_stop(&ias_led_pwm);
 
-    /* Update LED based on IAS alert level only when the device is connected */
-    if(APP_BT_ADV_OFF_CONN_ON == app_bt_adv_conn_state)
+    /* Update LED based on IAS alert level only when a client is connected */
+    if(0 != app_bt_conn_count())
     {
         /* Update LED state based on IAS alert level. LED OFF for low level,
          * LED blinking for mid level, and LED ON for high level  */
-        switch(app_ias_alert_level[0])
+        switch(ias_led_alert_level)
         {
             case IAS_ALERT_LEVEL_LOW:
                 cy_result = cyhal_pwm_set_duty_cycle(&ias_led_pwm, LED_OFF_DUTY_CYCLE, IAS_LED_PWM_FREQUENCY);
@@ -860,21 +1498,138 @@ static void ias_led_update(void)
     /* Check if update to PWM parameters is successful*/
     if (CY_RSLT_SUCCESS != cy_result)
     {
-         printf("Failed to set duty cycle parameters!!");
+         APP_LOG(APP_LOG_ID_PWM_DUTY_CYCLE_FAILED);
     }
 
     cy_result = cyhal_pwm_start(&ias_led_pwm);
     /* Check if PWM started successfully */
     if (CY_RSLT_SUCCESS != cy_result)
     {
-         printf("Failed to start PWM !!");
+         APP_LOG(APP_LOG_ID_PWM_START_FAILED);
     }
 }
+
+/*******************************************************************************
+* Function Name: ias_alert_level_update
+********************************************************************************
+*
+* Summary:
+*   This function aggregates the alert levels written by the connected clients
+*   (highest level wins) and updates the IAS LED only when the aggregated level
+*   changes, so that writes from several clients do not restart the PWM
+*
+* Parameters:
+*   None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void ias_alert_level_update(void)
+{
+    uint8_t level = app_bt_conn_get_max_alert_level();
+
+    /* The GATT DB value reflects the aggregated level rather than the last writer */
+    app_ias_alert_level[0] = level;
+
+    if (level != ias_led_alert_level)
+    {
+        ias_led_alert_level = level;
+        APP_LOG(APP_LOG_ID_ALERT_LEVEL_LED, level, app_bt_conn_count());
+        ias_led_update();
+        app_bt_adv_status_set_alert_level(level);
+
+        /* A locator looking for this target may be about to connect */
+        app_bt_adv_kick(APP_BT_ADV_EVENT_ALERT);
+    }
+}
+
+/*******************************************************************************
+* Function Name: le_app_service_changed
+********************************************************************************
+*
+* Summary:
+*   Indicates Service Changed over the whole handle range to a bonded client
+*   whose attribute cache predates the current GATT DB, for example after a
+*   firmware update. The client then discovers the database again. A client
+*   that has not enabled the indication cannot be told and does not keep a
+*   cache it relies on, so the current GATT DB is recorded for it right away.
+*
+* Parameters:
+*   app_bt_conn_t *p_conn: Connection of the client
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+static void le_app_service_changed(app_bt_conn_t *p_conn)
+{
+    uint16_t *p_cccd = app_bt_conn_get_cccd(p_conn, HDLD_GATT_SERVICE_CHANGED_CLIENT_CHAR_CONFIG);
+
+    if ((NULL == p_cccd) || (0 == (*p_cccd & APP_GATT_NOTIFY_CCCD_INDICATION)))
+    {
+        p_conn->db_hash = app_gatt_db_index_get_hash();
+        app_bt_conn_save_cccd(p_conn);
+        return;
+    }
+
+    APP_LOG(APP_LOG_ID_SERVICE_CHANGED, p_conn->conn_id);
+    app_gatt_notify_value_changed_conn(p_conn->conn_id, HDLC_GATT_SERVICE_CHANGED_VALUE);
+}
+
+/*******************************************************************************
+* Function Name: le_app_service_changed_produce
+********************************************************************************
+*
+* Summary:
+*   Produces the Service Changed value, the range of affected attribute
+*   handles, into the buffer of the indication. The whole range 0x0001 to
+*   0xFFFF is always reported, so the value is the same for every client and
+*   the shared GATT DB entry is never written.
+*
+* Parameters:
+*   uint16_t conn_id : Connection ID of the client
+*   uint16_t handle  : HDLC_GATT_SERVICE_CHANGED_VALUE
+*   uint16_t offset  : First byte of the value to produce
+*   uint8_t *p_buf   : Destination of the value
+*   uint16_t buf_len : Size of the destination
+*   uint16_t *p_len  : Returns the number of bytes produced
+*   uint16_t *p_total_len: Returns the length of the whole value
+*
+* Return:
+*   wiced_bt_gatt_status_t: WICED_BT_GATT_INVALID_OFFSET beyond the end of
+*                           the value
+*
+*******************************************************************************/
+static wiced_bt_gatt_status_t le_app_service_changed_produce(uint16_t conn_id,
+                                                             uint16_t handle,
+                                                             uint16_t offset,
+                                                             uint8_t *p_buf,
+                                                             uint16_t buf_len,
+                                                             uint16_t *p_len,
+                                                             uint16_t *p_total_len)
+{
+    /* Start and end of the affected handle range, little endian */
+    static const uint8_t range[] = { 0x01, 0x00, 0xFF, 0xFF };
+
+    if (offset > sizeof(range))
+    {
+        return WICED_BT_GATT_INVALID_OFFSET;
+    }
+
+    *p_total_len = sizeof(range);
+    *p_len = MIN(buf_len, (uint16_t)(sizeof(range) - offset));
+    memcpy(p_buf, &range[offset], *p_len);
+
+    return WICED_BT_GATT_SUCCESS;
+}
+
 /*******************************************************************************
  * Function Name: app_free_buffer
  *******************************************************************************
  * Summary:
- *  This function frees up the memory buffer
+ *  This function returns the memory buffer to its buffer pool, or to the
+ *  heap if it was allocated from there
  *
  *
  * Parameters:
@@ -883,28 +1638,38 @@ static void ias_led_update(void)
  ******************************************************************************/
 static void app_free_buffer(uint8_t *p_buf)
 {
-    vPortFree(p_buf);
+    app_bt_buffer_pool_free(p_buf);
 }
 
 /*******************************************************************************
  * Function Name: app_alloc_buffer
  *******************************************************************************
  * Summary:
- *  This function allocates a memory buffer.
+ *  This function allocates a memory buffer from the fixed-block buffer pools.
+ *  The FreeRTOS heap is used only when the pools are exhausted. For a known
+ *  connection the length is limited to the negotiated MTU of that link, so
+ *  clients on a small MTU are served from the small block class.
  *
  *
  * Parameters:
+ *  uint16_t conn_id: Connection ID the buffer is for, 0 if not known
  *  int len: Length to allocate
  *
  ******************************************************************************/
-static void* app_alloc_buffer(int len)
+static void* app_alloc_buffer(uint16_t conn_id, int len)
 {
-    return pvPortMalloc(len);
+    if ((len < 0) || (len > UINT16_MAX))
+    {
+        return NULL;
+    }
+
+    return app_bt_buffer_pool_alloc(app_bt_conn_get_max_rsp_len(conn_id, (uint16_t)len));
 }
 /*******************************************************************************
  * Function Name : le_app_find_by_handle
  * *****************************************************************************
- * Summary : @brief  Find attribute description by handle
+ * Summary : @brief  Find attribute description by handle using the handle
+ *                   index built in le_app_init
  *
  * @param handle    handle to look up
  *
@@ -912,15 +1677,7 @@ static void* app_alloc_buffer(int len)
  ******************************************************************************/
 static gatt_db_lookup_table_t  *le_app_find_by_handle(uint16_t handle)
 {
-    int i;
-    for (i = 0; i < app_gatt_db_ext_attr_tbl_size; i++)
-    {
-        if (handle == app_gatt_db_ext_attr_tbl[i].handle )
-        {
-            return (&app_gatt_db_ext_attr_tbl[i]);
-        }
-    }
-    return NULL;
+    return app_gatt_db_index_find(handle);
 }
 /**
  * Function Name:
@@ -942,16 +1699,56 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
                                                                    uint16_t len_requested,
                                                                    uint16_t *p_error_handle)
 {
-    gatt_db_lookup_table_t *puAttribute;
     uint16_t last_handle = 0;
     uint16_t attr_handle = p_read_req->s_handle;
-    uint8_t *p_rsp = app_alloc_buffer(len_requested);
+    uint8_t *p_rsp;
+    uint8_t *p_data;
+    uint8_t cccd_value[2];
+    uint16_t value_len;
     uint8_t pair_len = 0;
     int used_len = 0;
+    const app_gatt_db_type_entry_t *p_match = NULL;
+    uint16_t num_matches;
+    uint16_t match = 0;
+    uint16_t rsp_len;
+
+    /* The response never exceeds one ATT PDU on this connection */
+    len_requested = app_bt_conn_get_max_rsp_len(conn_id, len_requested);
+
+    /* Attributes of the requested type within the range, from the type index */
+    num_matches = app_gatt_db_index_find_by_type(&p_read_req->uuid, p_read_req->s_handle,
+                                                 p_read_req->e_handle, &p_match);
 
+    if (APP_GATT_DB_TYPE_NOT_INDEXED != num_matches)
+    {
+        /* Most requests during discovery match nothing; answer those without a buffer.
+         * Attribute Not Found tells the client that discovery of the range is complete */
+        if (0 == num_matches)
+        {
+            *p_error_handle = p_read_req->s_handle;
+            APP_LOG(APP_LOG_ID_RBT_NOT_FOUND, p_read_req->s_handle, p_read_req->e_handle,
+                    p_read_req->uuid.uu.uuid16);
+            return WICED_BT_GATT_ATTRIBUTE_NOT_FOUND;
+        }
+
+        rsp_len = app_bt_gatt_read_by_type_rsp_len(conn_id, p_match, num_matches, len_requested,
+                                                   p_error_handle);
+        if (0 == rsp_len)
+        {
+            APP_LOG(APP_LOG_ID_RBT_NO_ATTRIBUTE, *p_error_handle);
+            return WICED_BT_GATT_ATTRIBUTE_NOT_FOUND;
+        }
+    }
+    else
+    {
+        /* The type is not indexed; the size of the match set is unknown */
+        rsp_len = len_requested;
+    }
+
+    p_rsp = app_alloc_buffer(conn_id, rsp_len);
     if (NULL == p_rsp)
     {
-        printf("No memory, len_requested: %d!!\r\n",len_requested);
+        APP_LOG(APP_LOG_ID_RBT_NO_MEMORY, rsp_len);
         return WICED_BT_GATT_INSUF_RESOURCE;
     }
 
@@ -960,21 +1757,36 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
     {
         *p_error_handle = attr_handle;
         last_handle = attr_handle;
-        attr_handle = wiced_bt_gatt_find_handle_by_type(attr_handle, p_read_req->e_handle,
-                                                        &p_read_req->uuid);
-        if (0 == attr_handle )
-            break;
 
-        if ( NULL == (puAttribute = le_app_find_by_handle(attr_handle)))
+        if (APP_GATT_DB_TYPE_NOT_INDEXED != num_matches)
         {
-            printf("found type but no attribute for %d \r\n",last_handle);
+            /* Only the attributes of the requested type are visited */
+            if (match >= num_matches)
+                break;
+
+            attr_handle = p_match[match].handle;
+            match++;
+        }
+        else
+        {
+            /* Walk the database */
+            attr_handle = wiced_bt_gatt_find_handle_by_type(attr_handle, p_read_req->e_handle,
+                                                            &p_read_req->uuid);
+            if (0 == attr_handle )
+                break;
+        }
+
+        /* Descriptors that hold a value per client are read as this client sees them */
+        if (!le_app_get_value(conn_id, attr_handle, cccd_value, &p_data, &value_len))
+        {
+            APP_LOG(APP_LOG_ID_RBT_NO_ATTRIBUTE, last_handle);
             app_free_buffer(p_rsp);
             return WICED_BT_GATT_INVALID_HANDLE;
         }
 
         {
-            int filled = wiced_bt_gatt_put_read_by_type_rsp_in_stream(p_rsp + used_len, len_requested - used_len, &pair_len,
-                                                                attr_handle, puAttribute->cur_len, puAttribute->p_data);
+            int filled = wiced_bt_gatt_put_read_by_type_rsp_in_stream(p_rsp + used_len, rsp_len - used_len, &pair_len,
+                                                                attr_handle, value_len, p_data);
             if (0 == filled)
             {
                 break;
@@ -988,10 +1800,10 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
 
     if (0 == used_len)
     {
-       printf("attr not found  start_handle: 0x%04x  end_handle: 0x%04x  Type: 0x%04x\r\n",
-               p_read_req->s_handle, p_read_req->e_handle, p_read_req->uuid.uu.uuid16);
+        APP_LOG(APP_LOG_ID_RBT_NOT_FOUND, p_read_req->s_handle, p_read_req->e_handle,
+                p_read_req->uuid.uu.uuid16);
         app_free_buffer(p_rsp);
-        return WICED_BT_GATT_INVALID_HANDLE;
+        return WICED_BT_GATT_ATTRIBUTE_NOT_FOUND;
     }
 
     /* Send the response */
@@ -999,4 +1811,182 @@ static wiced_bt_gatt_status_t app_bt_gatt_req_read_by_type_handler(uint16_t conn
     return wiced_bt_gatt_server_send_read_by_type_rsp(conn_id, opcode, pair_len, used_len, p_rsp, (void *)app_free_buffer);
 }
 
+/**
+ * Function Name:
+ * app_bt_gatt_read_by_type_rsp_len
+ *
+ * Function Description:
+ * @brief  Compute the length of a read-by-type response from its match set. A response only holds
+ *         handle-value pairs of the same length as the first one, each value limited to what fits
+ *         in the PDU, so the buffer is sized to exactly the pairs that will be sent
+ *
+ * @param conn_id        Connection ID of the reading client
+ * @param p_match        Attributes of the requested type within the range, in handle order
+ * @param num_matches    Number of attributes in p_match, at least one
+ * @param len_requested  Largest response the connection can carry
+ * @param p_error_handle Set to the handle of an attribute missing from the lookup table
+ *
+ * @return uint16_t  Response length, 0 if the first attribute is missing from the lookup table
+ */
+static uint16_t app_bt_gatt_read_by_type_rsp_len(uint16_t conn_id,
+                                                 const app_gatt_db_type_entry_t *p_match,
+                                                 uint16_t num_matches,
+                                                 uint16_t len_requested,
+                                                 uint16_t *p_error_handle)
+{
+    uint16_t i;
+    uint8_t *p_data;
+    uint8_t cccd_value[2];
+    uint16_t attr_len;
+    uint16_t value_len;
+    uint16_t pair_len = 0;
+    uint16_t rsp_len = 0;
+
+    for (i = 0; i < num_matches; i++)
+    {
+        if ((NULL == p_match[i].p_attr) ||
+            (!le_app_get_value(conn_id, p_match[i].handle, cccd_value, &p_data, &attr_len)))
+        {
+            /* The response stops here; the caller reports a missing first attribute */
+            if (0 == i)
+            {
+                *p_error_handle = p_match[i].handle;
+            }
+            break;
+        }
+
+        /* A pair is the 2 byte handle and the value, truncated to fit in one pair */
+        value_len = MIN(attr_len, MIN(len_requested, APP_BT_READ_BY_TYPE_MAX_PAIR_LEN) - 2);
+        if (0 == i)
+        {
+            pair_len = 2 + value_len;
+        }
+        else if ((2 + value_len) != pair_len)
+        {
+            break;
+        }
+
+        if ((rsp_len + pair_len) > len_requested)
+        {
+            break;
+        }
+        rsp_len += pair_len;
+    }
+
+    return rsp_len;
+}
+
+/**
+ * Function Name:
+ * app_bt_gatt_req_read_multi_handler
+ *
+ * Function Description:
+ * @brief  Process Read Multiple and Read Multiple Variable Length requests. The values of all the
+ *         requested handles are packed into one response buffer, so a client reads several
+ *         attributes in one round trip. Read Multiple concatenates the values; Read Multiple
+ *         Variable Length prefixes each value with its full length, also when the value is cut
+ *         at the end of the PDU
+ *
+ * @param conn_id       Connection ID
+ * @param opcode        GATT_REQ_READ_MULTI or GATT_REQ_READ_MULTI_VAR_LENGTH
+ * @param p_read_req    Pointer to the list of handles to read
+ * @param len_requested length of data requested
+ *
+ * @return wiced_bt_gatt_status_t  LE GATT status
+ */
+static wiced_bt_gatt_status_t app_bt_gatt_req_read_multi_handler(uint16_t conn_id,
+                                                                 wiced_bt_gatt_opcode_t opcode,
+                                                                 wiced_bt_gatt_read_multiple_req_t *p_read_req,
+                                                                 uint16_t len_requested,
+                                                                 uint16_t *p_error_handle)
+{
+    wiced_bt_gatt_status_t gatt_status;
+    app_gatt_stream_producer_t producer;
+    uint8_t *p_rsp;
+    uint8_t *p_data;
+    uint8_t cccd_value[2];
+    uint16_t handle;
+    uint16_t value_len;
+    uint16_t copy_len;
+    uint16_t header_len = (GATT_REQ_READ_MULTI_VAR_LENGTH == opcode) ? 2 : 0;
+    int used_len = 0;
+    int filled;
+    int room;
+    int xx;
+
+    /* The response never exceeds one ATT PDU on this connection */
+    len_requested = app_bt_conn_get_max_rsp_len(conn_id, len_requested);
+    p_rsp = app_alloc_buffer(conn_id, len_requested);
+    if (NULL == p_rsp)
+    {
+        APP_LOG(APP_LOG_ID_RBT_NO_MEMORY, len_requested);
+        return WICED_BT_GATT_INSUF_RESOURCE;
+    }
+
+    for (xx = 0; xx < p_read_req->num_handles; xx++)
+    {
+        handle = wiced_bt_gatt_get_handle_from_stream(p_read_req->p_handle_stream, xx);
+        *p_error_handle = handle;
+
+        /* Streamed attributes are produced straight into the response */
+        producer = app_gatt_stream_find(handle);
+        if (NULL != producer)
+        {
+            if ((used_len + header_len) >= len_requested)
+            {
+                break;
+            }
+
+            copy_len = 0;
+            value_len = 0;
+            gatt_status = producer(conn_id, handle, 0, p_rsp + used_len + header_len,
+                                   len_requested - used_len - header_len, &copy_len, &value_len);
+            if (WICED_BT_GATT_SUCCESS != gatt_status)
+            {
+                app_free_buffer(p_rsp);
+                return gatt_status;
+            }
+
+            if (0 != header_len)
+            {
+                p_rsp[used_len] = (uint8_t)(value_len & 0xFF);
+                p_rsp[used_len + 1] = (uint8_t)(value_len >> 8);
+            }
+            used_len += header_len + copy_len;
+            continue;
+        }
+
+        if (!le_app_get_value(conn_id, handle, cccd_value, &p_data, &value_len))
+        {
+            APP_LOG(APP_LOG_ID_READ_MULTI_NO_ATTRIBUTE, handle);
+            app_free_buffer(p_rsp);
+            return WICED_BT_GATT_INVALID_HANDLE;
+        }
+
+        filled = wiced_bt_gatt_put_read_multi_rsp_in_stream(opcode, p_rsp + used_len, len_requested - used_len,
+                                                            handle, value_len, p_data);
+        if (0 == filled)
+        {
+            /* ATT truncates the response at the end of the PDU, so the value
+             * that does not fit is cut rather than dropped; the client reads
+             * the rest separately */
+            room = len_requested - used_len - header_len;
+            if (room > 0)
+            {
+                if (0 != header_len)
+                {
+                    p_rsp[used_len] = (uint8_t)(value_len & 0xFF);
+                    p_rsp[used_len + 1] = (uint8_t)(value_len >> 8);
+                }
+                memcpy(p_rsp + used_len + header_len, p_data, room);
+                used_len += header_len + room;
+            }
+            break;
+        }
+        used_len += filled;
+    }
+
+    return wiced_bt_gatt_server_send_read_multiple_rsp(conn_id, opcode, used_len, p_rsp, (void *)app_free_buffer);
+}
+
 /* END OF FILE [] */
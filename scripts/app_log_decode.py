@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+################################################################################
+# File Name: app_log_decode.py
+#
+# Description: Expands the tokenized log lines printed by the application when
+#              it is built with APP_LOG_TOKENIZED=1. The record formats are read
+#              from app_log.h and the enum names are resolved from the BTSTACK
+#              headers with the same table list the firmware name tables are
+#              generated from (gen_bt_enum_tables.py).
+#
+#              Usage:
+#                python scripts/app_log_decode.py --stack ../mtb_shared/btstack \
+#                       [capture.txt]
+#              Lines that are not tokenized are passed through unchanged.
+#
+# Related Document: See README.md
+#
+################################################################################
+# Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer
+# of such system or application assumes all risk of such use and in doing
+# so agrees to indemnify Cypress against all liability.
+################################################################################
+
+import argparse
+import os
+import re
+import sys
+
+from bt_enum_values import EnumValues
+from gen_bt_enum_tables import TABLES, resolve_table
+
+TOKEN_MARKER = '~'
+_RECORD_RE = re.compile(r'X\(\s*(APP_LOG_ID_\w+)\s*,\s*(APP_LOG_ARG_\w+)\s*,\s*("(?:[^"\\]|\\.)*")\s*\)')
+_KIND_RE = re.compile(r'case\s+(APP_LOG_ARG_\w+)\s*:\s*return\s+(\w+)\s*\(')
+_CONVERSION_RE = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?[hlLzjt]*[diouxXcs]')
+
+
+def c_string(literal):
+    """Converts a C string literal, quotes included, to a Python string."""
+    return literal[1:-1].encode('latin-1').decode('unicode_escape')
+
+
+def load_records(app_dir):
+    """Returns the (kind, format) of every log record, indexed by record id."""
+    with open(os.path.join(app_dir, 'app_log.h'), encoding='utf-8') as header:
+        return [(kind, c_string(fmt)) for _, kind, fmt in _RECORD_RE.findall(header.read())]
+
+
+def load_name_tables(app_dir, enums):
+    """Returns {argument kind: {value: name}} for the argument kinds decoded in app_log.c."""
+    with open(os.path.join(app_dir, 'app_log.c'), encoding='utf-8') as source:
+        kind_functions = dict(_KIND_RE.findall(source.read()))
+    anchors = {function: anchor for _, function, anchor in TABLES}
+
+    tables = {}
+    for kind, function in kind_functions.items():
+        if function in anchors:
+            _, tables[kind] = resolve_table(enums, anchors[function])
+    return tables
+
+
+def decode_line(line, records, name_tables):
+    """Expands one tokenized line, or returns None if the line is not tokenized."""
+    if not line.startswith(TOKEN_MARKER):
+        return None
+    try:
+        fields = [int(field, 16) for field in line[1:].split()]
+    except ValueError:
+        return None
+    if len(fields) < 2 or fields[1] >= len(records):
+        return None
+
+    timestamp, record_id, args = fields[0], fields[1], fields[2:]
+    kind, fmt = records[record_id]
+    num_conversions = len(_CONVERSION_RE.findall(fmt.replace('%%', '')))
+    args = (args + [0] * num_conversions)[:num_conversions]
+
+    if kind != 'APP_LOG_ARG_NONE' and args:
+        args[0] = name_tables.get(kind, {}).get(args[0], 'UNKNOWN (0x%x)' % args[0])
+
+    return '[%8u] ' % timestamp + fmt % tuple(args)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode tokenized application logs')
+    parser.add_argument('capture', nargs='?', help='captured UART output (default: stdin)')
+    parser.add_argument('--stack', action='append', default=[], required=True,
+                        help='BTSTACK directory or header to resolve enum values from')
+    parser.add_argument('--app-dir', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'),
+                        help='application directory containing app_log.h')
+    options = parser.parse_args()
+
+    enums = EnumValues()
+    enums.add_headers(options.stack)
+    records = load_records(options.app_dir)
+    try:
+        name_tables = load_name_tables(options.app_dir, enums)
+    except ValueError as error:
+        sys.exit('app_log_decode.py: error: %s' % error)
+
+    capture = open(options.capture, encoding='utf-8', errors='replace') if options.capture else sys.stdin
+    with capture:
+        for line in capture:
+            line = line.rstrip('\r\n')
+            decoded = decode_line(line, records, name_tables)
+            print(line if decoded is None else decoded.rstrip('\n'))
+
+
+if __name__ == '__main__':
+    main()
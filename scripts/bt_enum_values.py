@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+################################################################################
+# File Name: bt_enum_values.py
+#
+# Description: Resolves the numeric values of the enumerators and object-like
+#              macros declared in the AIROC(TM) BTSTACK headers, so that host
+#              tools can map the numbers found in logs back to names.
+#
+# Related Document: See README.md
+#
+################################################################################
+# Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer
+# of such system or application assumes all risk of such use and in doing
+# so agrees to indemnify Cypress against all liability.
+################################################################################
+
+import os
+import re
+
+_COMMENT_RE = re.compile(r'/\*.*?\*/|//[^\n]*', re.S)
+_DEFINE_RE = re.compile(r'^[ \t]*#[ \t]*define[ \t]+([A-Za-z_]\w*)[ \t]+(.+?)[ \t]*$', re.M)
+_ENUM_RE = re.compile(r'\benum\b\s*\w*\s*\{(.*?)\}', re.S)
+_CAST_RE = re.compile(r'\(\s*(?:unsigned|signed|const|u?int(?:8|16|32|64)_t|int|char|short|long|\s)+\)')
+_SUFFIX_RE = re.compile(r'\b(0[xX][0-9A-Fa-f]+|\d+)[uUlL]+\b')
+_NAME_RE = re.compile(r'\b[A-Za-z_]\w*\b')
+_SAFE_RE = re.compile(r'^[\s0-9A-Fa-fxX()+\-*/%<>|&^~]*$')
+
+
+class EnumValues:
+    """Symbol table of the integer constants declared in a set of C headers."""
+
+    def __init__(self):
+        self._exprs = {}
+        self._values = {}
+        self._enums = []
+
+    def add_headers(self, roots):
+        """Collects #define and enum constants from every .h file found below roots."""
+        for root in roots:
+            if os.path.isfile(root):
+                self.add_file(root)
+                continue
+            for dirpath, _, filenames in os.walk(root):
+                for filename in sorted(filenames):
+                    if filename.endswith('.h'):
+                        self.add_file(os.path.join(dirpath, filename))
+
+    def add_file(self, path):
+        with open(path, encoding='utf-8', errors='replace') as header:
+            self.add_source(header.read(), os.path.basename(path))
+
+    def add_source(self, text, origin=None):
+        text = _COMMENT_RE.sub(' ', text)
+        text = text.replace('\\\n', ' ')
+
+        for name, expr in _DEFINE_RE.findall(text):
+            self._exprs.setdefault(name, expr)
+
+        for body in _ENUM_RE.findall(text):
+            previous = None
+            members = []
+            for item in body.split(','):
+                item = item.strip()
+                if not item:
+                    continue
+                name, _, expr = item.partition('=')
+                name = name.strip()
+                if not re.match(r'^[A-Za-z_]\w*$', name):
+                    continue
+                if expr.strip():
+                    expr = expr.strip()
+                elif previous is None:
+                    expr = '0'
+                else:
+                    expr = '(%s) + 1' % previous
+                self._exprs.setdefault(name, expr)
+                members.append(name)
+                previous = name
+            if members:
+                self._enums.append((origin, members))
+
+    def enum_containing(self, name):
+        """Returns (header name, enumerator names) of the enum that declares name, or None."""
+        for origin, members in self._enums:
+            if name in members:
+                return origin, members
+        return None
+
+    def value(self, name, _depth=0):
+        """Returns the integer value of a constant, or None if it cannot be resolved."""
+        if name in self._values:
+            return self._values[name]
+        expr = self._exprs.get(name)
+        if expr is None or _depth > 32:
+            return None
+
+        expr = _CAST_RE.sub(' ', expr)
+        expr = _SUFFIX_RE.sub(r'\1', expr)
+
+        unresolved = []
+
+        def substitute(match):
+            token = match.group(0)
+            if re.match(r'^0[xX]', token) or token[0].isdigit():
+                return token
+            resolved = self.value(token, _depth + 1)
+            if resolved is None:
+                unresolved.append(token)
+                return '0'
+            return '(%d)' % resolved
+
+        expr = _NAME_RE.sub(substitute, expr)
+        if unresolved or not _SAFE_RE.match(expr):
+            return None
+
+        try:
+            result = int(eval(expr.replace('/', '//'), {'__builtins__': {}}, {}))
+        except (SyntaxError, ArithmeticError, TypeError, ValueError):
+            return None
+
+        self._values[name] = result
+        return result
+
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+################################################################################
+# File Name: gen_bt_enum_tables.py
+#
+# Description: Generates the enum name tables used by app_bt_utils.c from the
+#              AIROC(TM) BTSTACK headers. Run as a PREBUILD step from the
+#              Makefile. Fails the build when an enum cannot be found or one of
+#              its values cannot be resolved.
+#
+# Related Document: See README.md
+#
+################################################################################
+# Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+# an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+#
+# This software, including source code, documentation and related
+# materials ("Software") is owned by Cypress Semiconductor Corporation
+# or one of its affiliates ("Cypress") and is protected by and subject to
+# worldwide patent protection (United States and foreign),
+# United States copyright laws and international treaty provisions.
+# Therefore, you may use this Software only as provided in the license
+# agreement accompanying the software package from which you
+# obtained this Software ("EULA").
+# If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+# non-transferable license to copy, modify, and compile the Software
+# source code solely for use in connection with Cypress's
+# integrated circuit products.  Any reproduction, modification, translation,
+# compilation, or representation of this Software except as specified
+# above is prohibited without the express written permission of Cypress.
+#
+# Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+# reserves the right to make changes to the Software without notice. Cypress
+# does not assume any liability arising out of the application or use of the
+# Software or any product or circuit described in the Software. Cypress does
+# not authorize its products for use in any products where a malfunction or
+# failure of the Cypress product may reasonably be expected to result in
+# significant property damage, injury or death ("High Risk Product"). By
+# including Cypress's product in a High Risk Product, the manufacturer
+# of such system or application assumes all risk of such use and in doing
+# so agrees to indemnify Cypress against all liability.
+################################################################################
+
+import argparse
+import os
+import sys
+
+from bt_enum_values import EnumValues
+
+# Name tables generated for app_bt_utils.c: (table name, name lookup function,
+# enumerator that identifies the enum in the stack headers)
+TABLES = [
+    ('app_bt_btm_event',        'get_btm_event_name',               'BTM_ENABLED_EVT'),
+    ('app_bt_advert_mode',      'get_bt_advert_mode_name',          'BTM_BLE_ADVERT_OFF'),
+    ('app_bt_disconn_reason',   'get_bt_gatt_disconn_reason_name',  'GATT_CONN_UNKNOWN'),
+    ('app_bt_gatt_status',      'get_bt_gatt_status_name',          'WICED_BT_GATT_SUCCESS'),
+    ('app_bt_smp_status',       'get_bt_smp_status_name',           'SMP_SUCCESS'),
+]
+
+# A table is stored densely, indexed by value, unless gaps would make it more
+# than this many times larger than the number of names
+DENSE_MAX_SPREAD = 2
+
+NO_NAME = 0xFFFF
+
+
+def resolve_table(enums, anchor):
+    """Returns (header name, {value: name}) of the enum that declares anchor.
+    The first enumerator declared for a value wins, aliases are skipped."""
+    found = enums.enum_containing(anchor)
+    if found is None:
+        raise ValueError('enum declaring %s not found in the stack headers' % anchor)
+
+    origin, members = found
+    names = {}
+    for name in members:
+        value = enums.value(name)
+        if value is None:
+            raise ValueError('value of %s (%s) cannot be resolved' % (name, origin))
+        if not 0 <= value < NO_NAME:
+            raise ValueError('value of %s (%s) out of range: %d' % (name, origin, value))
+        names.setdefault(value, name)
+    return origin, names
+
+
+def wrap(items, per_line=8):
+    """Formats array initializer items, per_line items per line."""
+    return ['    ' + ', '.join(items[i:i + per_line]) + ',' for i in range(0, len(items), per_line)]
+
+
+def emit_table(out, table, function, names):
+    values = sorted(names)
+    first, last = values[0], values[-1]
+    dense = (last - first + 1) <= DENSE_MAX_SPREAD * len(values)
+
+    offsets = {}
+    out.append('/* Names for %s() */' % function)
+    out.append('static const char %s_names[] =' % table)
+    offset = 0
+    for value in values:
+        offsets[value] = offset
+        out.append('    "%s\\0"' % names[value])
+        offset += len(names[value]) + 1
+    out[-1] += ';'
+    if offset >= NO_NAME:
+        raise ValueError('%s names exceed %d bytes' % (table, NO_NAME))
+
+    if dense:
+        entries = [offsets.get(value, NO_NAME) for value in range(first, last + 1)]
+        out.append('static const uint16_t %s_offsets[%d] =' % (table, len(entries)))
+        out.append('{')
+        out.extend(wrap(['APP_BT_ENUM_NO_NAME' if entry == NO_NAME else '%du' % entry for entry in entries]))
+        out.append('};')
+        out.append('static const app_bt_enum_table_t %s_table =' % table)
+        out.append('    { %s_names, %s_offsets, NULL, %du, %du };' % (table, table, first, len(entries)))
+    else:
+        out.append('static const uint16_t %s_values[%d] =' % (table, len(values)))
+        out.append('{')
+        out.extend(wrap(['%du' % value for value in values]))
+        out.append('};')
+        out.append('static const uint16_t %s_offsets[%d] =' % (table, len(values)))
+        out.append('{')
+        out.extend(wrap(['%du' % offsets[value] for value in values]))
+        out.append('};')
+        out.append('static const app_bt_enum_table_t %s_table =' % table)
+        out.append('    { %s_names, %s_offsets, %s_values, 0u, %du };' % (table, table, table, len(values)))
+
+    # Catch any disagreement between this parser and the compiler
+    for value in values:
+        out.append('_Static_assert((%s) == %d, "%s changed, rebuild to regenerate the name tables");'
+                   % (names[value], value, names[value]))
+    out.append('')
+
+
+def generate(enums):
+    headers = []
+    body = []
+    for table, function, anchor in TABLES:
+        origin, names = resolve_table(enums, anchor)
+        if origin not in headers:
+            headers.append(origin)
+        emit_table(body, table, function, names)
+
+    out = ['/* Generated by scripts/gen_bt_enum_tables.py from the BTSTACK headers. Do not edit. */',
+           '#ifndef __APP_BT_ENUM_TABLES_H__',
+           '#define __APP_BT_ENUM_TABLES_H__',
+           '']
+    out.extend('#include "%s"' % header for header in headers)
+    out.append('')
+    out.extend(body)
+    out.append('#endif      /* __APP_BT_ENUM_TABLES_H__ */')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the BTSTACK enum name tables')
+    parser.add_argument('--stack', action='append', default=[], required=True,
+                        help='BTSTACK directory or header to read the enums from')
+    parser.add_argument('--output', required=True, help='header file to generate')
+    options = parser.parse_args()
+
+    enums = EnumValues()
+    enums.add_headers(options.stack)
+    try:
+        text = generate(enums)
+    except ValueError as error:
+        sys.exit('gen_bt_enum_tables.py: error: %s' % error)
+
+    # Keep the timestamp unchanged when nothing changed to avoid needless rebuilds
+    if os.path.isfile(options.output):
+        with open(options.output, encoding='utf-8') as current:
+            if current.read() == text:
+                return
+    os.makedirs(os.path.dirname(os.path.abspath(options.output)), exist_ok=True)
+    with open(options.output, 'w', encoding='utf-8') as output:
+        output.write(text)
+
+
+if __name__ == '__main__':
+    main()